@@ -8,8 +8,8 @@ Application::Application(Platform::Input& p_input, Platform::Window& p_window) n
 	, m_scene_system{m_texture_system, m_mesh_system}
 	, m_openGL_renderer{m_window, m_scene_system, m_mesh_system, m_texture_system}
 	, m_grid_renderer{}
-	, m_collision_system{m_scene_system}
-	, m_physics_system{m_scene_system, m_collision_system}
+	, m_collision_system{m_scene_system.m_scene}
+	, m_physics_system{m_scene_system.m_scene, m_collision_system}
 	, m_input_system{m_input, m_window, m_scene_system}
 	, m_editor{m_input, m_window, m_texture_system, m_mesh_system, m_scene_system, m_collision_system, m_openGL_renderer}
 	, m_simulation_loop_params_changed{false}
@@ -17,6 +17,7 @@ Application::Application(Platform::Input& p_input, Platform::Window& p_window) n
 	, m_render_ticks_per_second{120}
 	, m_input_ticks_per_second{120}
 	, maxFrameDelta{std::chrono::milliseconds(250)}
+	, m_physics_recording_path{}
 {
 	Logger::s_editor_sink = &m_editor;
 }
@@ -225,4 +226,61 @@ void Application::simulation_loop()
 		// Reset this flag to not exit the next simulation_loop when looping back around this While().
 		m_simulation_loop_params_changed = false;
 	}
+
+	if (m_physics_recording_path)
+	{
+		m_physics_system.stop_recording().save(*m_physics_recording_path);
+		m_physics_recording_path.reset();
+	}
+}
+
+void Application::record_physics(const std::filesystem::path& p_path)
+{
+	m_physics_recording_path = p_path;
+	m_physics_system.start_recording();
+}
+
+bool Application::replay_physics(const std::filesystem::path& p_path)
+{
+	const auto recording = System::PhysicsRecording::load(p_path);
+	if (!recording)
+		return false;
+
+	LOG("[REPLAY] Replaying {} ticks of {} bodies from '{}'", recording->m_ticks.size(), recording->m_bodies.size(), p_path.string());
+	const auto report = m_physics_system.replay(*recording);
+
+	using Duration = System::PhysicsSystem::StageTimings::Duration;
+	System::PhysicsSystem::StageTimings total = {};
+	for (size_t i = 0; i < report.m_tick_timings.size(); i++)
+	{
+		const auto& timings = report.m_tick_timings[i];
+		LOG("[REPLAY] Tick {}: integration {} | CCD {} | broadphase {} | narrow phase {} | response {} | sleeping {} | checksum {:016x}{}",
+			i, timings.m_integration, timings.m_continuous_collision, timings.m_broadphase, timings.m_narrow_phase, timings.m_collision_response, timings.m_sleeping,
+			report.m_checksums[i], report.m_checksums[i] == recording->m_ticks[i].m_checksum ? "" : " MISMATCH");
+
+		total.m_integration          += timings.m_integration;
+		total.m_continuous_collision += timings.m_continuous_collision;
+		total.m_broadphase           += timings.m_broadphase;
+		total.m_narrow_phase         += timings.m_narrow_phase;
+		total.m_collision_response   += timings.m_collision_response;
+		total.m_sleeping             += timings.m_sleeping;
+	}
+
+	const Duration total_time = total.m_integration + total.m_continuous_collision + total.m_broadphase + total.m_narrow_phase + total.m_collision_response + total.m_sleeping;
+	LOG("------------------------------------------------------------------------");
+	LOG("[REPLAY] Total: {} over {} ticks", total_time, report.m_tick_timings.size());
+	LOG("[REPLAY] Integration:          {}", total.m_integration);
+	LOG("[REPLAY] Continuous collision: {}", total.m_continuous_collision);
+	LOG("[REPLAY] Broadphase:           {}", total.m_broadphase);
+	LOG("[REPLAY] Narrow phase:         {}", total.m_narrow_phase);
+	LOG("[REPLAY] Collision response:   {}", total.m_collision_response);
+	LOG("[REPLAY] Sleeping:             {}", total.m_sleeping);
+
+	if (report.m_first_mismatch)
+	{
+		LOG_ERROR("[REPLAY] Diverged from the recording at tick {}", *report.m_first_mismatch);
+		return false;
+	}
+	LOG("[REPLAY] Every tick matched the recording");
+	return true;
 }
\ No newline at end of file
@@ -22,6 +22,9 @@
 #include "Utility/Stopwatch.hpp"
 
 #include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string_view>
 
 // Application manages the ownership and calling of all the Systems.
 // Taking an OS window it renders and updates the state of an ECS.
@@ -31,6 +34,11 @@ public:
 	Application(Platform::Input& p_input, Platform::Window& p_window) noexcept;
 	~Application() noexcept;
 	void simulation_loop();
+	// Record the physics from now until simulation_loop returns, then save the recording to p_path.
+	void record_physics(const std::filesystem::path& p_path);
+	// Re-simulate the physics recorded at p_path without rendering. Logs the time spent in each stage and the state checksum per tick.
+	//@return True if every tick matched the recorded checksum.
+	bool replay_physics(const std::filesystem::path& p_path);
 
 private:
 	Platform::Input& m_input;
@@ -54,6 +62,7 @@ private:
 	int m_render_ticks_per_second;               // The number of renders to perform per second. This is equivalent to the pRenderTicksPerSecond template param of simulation_loop.
 	int m_input_ticks_per_second;            // The number of input system updates to perform every second;
 	std::chrono::milliseconds maxFrameDelta; // If the time between loops is beyond this, cap at this duration
+	std::optional<std::filesystem::path> m_physics_recording_path; // Set by record_physics, where to save the recording on exit.
 
 	// This simulation loop uses a physics timestep based on integer type giving no truncation or round-off error.
 	// It's required to be templated to allow physicsTimestep to be set using std::ratio as the chrono::duration period.
@@ -120,14 +129,14 @@ private:
 			{
 				duration_since_last_physics_tick -= physicsTimestep;
 				physics_time                     += physicsTimestep;
-				m_physics_system.integrate(physicsTimestep); // PhysicsSystem::Integrate takes a floating point rep duration, conversion here is troublesome.
-				m_scene_system.update_scene_bounds();
+				m_physics_system.integrate(physicsTimestep); // PhysicsSystem::Integrate takes a floating point rep duration, conversion here is troublesome. Also updates the scene bounds.
 			}
 
 			if (duration_since_last_render_tick >= renderTimestep)
 			{
-				// Rendering is only relevant if the data changed in the physics update.
-				// Not neccessary to decrement duration_since_last_render_tick as in physics update above as repeated draws will be identical with no data changes.
+				// Not neccessary to decrement duration_since_last_render_tick as in physics update above, the render shows the latest state.
+				// The physics state is one tick behind real time, meshes are drawn between the previous and current tick by the time left over.
+				m_openGL_renderer.m_interpolation_alpha = std::chrono::duration<float>(duration_since_last_physics_tick) / std::chrono::duration<float>(physicsTimestep);
 				m_window.start_ImGui_frame();
 				m_openGL_renderer.start_frame();
 
@@ -164,6 +173,7 @@ private:
 
 int main(int argc, char* argv[])
 { (void)argv;
+	int exit_code = EXIT_SUCCESS;
 	{
 		Utility::Stopwatch stopwatch;
 
@@ -181,13 +191,32 @@ int main(int argc, char* argv[])
 		for (int index{}; index != argc; ++index)
 			LOG("Argument {}: {}", index + 1, argv[index]);
 
+		// --record <path>: Record the physics until the window closes.
+		// --replay <path>: Replay a physics recording without rendering and exit.
+		std::optional<std::filesystem::path> record_path;
+		std::optional<std::filesystem::path> replay_path;
+		for (int index = 1; index + 1 < argc; ++index)
+		{
+			if (std::string_view(argv[index]) == "--record")
+				record_path = argv[++index];
+			else if (std::string_view(argv[index]) == "--replay")
+				replay_path = argv[++index];
+		}
+
 		auto app = Application(input, window);
 		LOG("[INIT] initialisation took {}", stopwatch.duration_since_start<int, std::milli>());
 
-		app.simulation_loop();
+		if (replay_path)
+			exit_code = app.replay_physics(*replay_path) ? EXIT_SUCCESS : EXIT_FAILURE;
+		else
+		{
+			if (record_path)
+				app.record_physics(*record_path);
+			app.simulation_loop();
+		}
 	} // Window and input must go out of scope and destroy their resources before Core::cleanup
 
 	Platform::Core::cleanup();
 	OpenGL::DebugRenderer::deinit();
-	return EXIT_SUCCESS;
+	return exit_code;
 }
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "Component/Collider.hpp"
+#include "Component/CollisionMesh.hpp"
+#include "Component/RigidBody.hpp"
+#include "Component/Transform.hpp"
+#include "System/CollisionSystem.hpp"
+#include "System/PhysicsRecording.hpp"
+#include "System/PhysicsSystem.hpp"
+#include "System/SceneSystem.hpp"
+#include "Utility/Config.hpp"
+#include "Utility/Logger.hpp"
+
+#include "glm/vec3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+// Runs PhysicsSystem over generated scenes of falling bodies without a window or OpenGL context and reports the time spent in each stage.
+// The bodies collide using Data::CollisionMesh directly so no Data::Mesh is created.
+// A run can be recorded with --record and replayed with --replay to check the simulation is deterministic, e.g. in CI.
+namespace
+{
+	struct BenchOptions
+	{
+		std::vector<size_t> m_body_counts      = {1'000, 10'000, 100'000};
+		size_t m_ticks                         = 60;
+		System::Scene::Broadphase m_broadphase = System::Scene::Broadphase::SweepAndPrune;
+		std::filesystem::path m_record_path;   // Record the ticks of the scene to this path, empty to not record.
+		std::filesystem::path m_replay_path;   // Replay this recording instead of simulating, empty to simulate.
+	};
+
+	// The collision data shared by the generated bodies, must outlive the Colliders pointing at it.
+	struct BenchMeshes
+	{
+		Data::CollisionMesh m_cuboid; // Unit cube scaled by the Transform.
+		Data::CollisionMesh m_sphere;
+	};
+	Data::CollisionMesh make_collision_mesh(const Geometry::Shape& p_shape, const Geometry::AABB& p_AABB)
+	{
+		return Data::CollisionMesh{p_AABB, {p_shape}, Geometry::TriangleBVH{}};
+	}
+
+	// A static floor under a square column of bodies dropped from a height, spaced so they start apart and pile up as they land.
+	// The body layout comes from a fixed seed so every run of a body count simulates the same scene.
+	void populate_scene(System::Scene& p_scene, const BenchMeshes& p_meshes, const size_t& p_body_count)
+	{
+		constexpr float Spacing = 1.5f;
+		const size_t columns    = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(p_body_count) / 10.f)));
+		const float width       = static_cast<float>(columns) * Spacing;
+
+		{
+			auto floor_transform    = Component::Transform{glm::vec3(0.f, -0.5f, 0.f)};
+			floor_transform.m_scale = glm::vec3(width + 10.f, 1.f, width + 10.f);
+			Component::RigidBody floor_body;
+			floor_body.m_type = Component::RigidBody::Type::Static;
+			p_scene.m_entities.add_entity(floor_transform, floor_body, Component::Collider{p_meshes.m_cuboid});
+		}
+
+		std::mt19937 generator{42};
+		std::uniform_real_distribution<float> jitter{-0.2f, 0.2f};
+		for (size_t i = 0; i < p_body_count; i++)
+		{
+			const size_t layer    = i / (columns * columns);
+			const size_t in_layer = i % (columns * columns);
+			const auto position   = glm::vec3(
+				(static_cast<float>(in_layer % columns) - static_cast<float>(columns) * 0.5f) * Spacing + jitter(generator),
+				1.f + static_cast<float>(layer) * Spacing,
+				(static_cast<float>(in_layer / columns) - static_cast<float>(columns) * 0.5f) * Spacing + jitter(generator));
+
+			Component::RigidBody rigid_body;
+			rigid_body.m_apply_gravity = true;
+			p_scene.m_entities.add_entity(Component::Transform{position}, rigid_body, Component::Collider{i % 2 == 0 ? p_meshes.m_cuboid : p_meshes.m_sphere});
+		}
+	}
+
+	void run(const BenchOptions& p_options, const BenchMeshes& p_meshes, const size_t& p_body_count)
+	{
+		System::Scene scene;
+		scene.m_broadphase = p_options.m_broadphase;
+		populate_scene(scene, p_meshes, p_body_count);
+
+		System::CollisionSystem collision_system{scene};
+		System::PhysicsSystem physics_system{scene, collision_system};
+
+		using Duration = System::PhysicsSystem::StageTimings::Duration;
+		const auto delta_time = DeltaTime(1.f / 60.f);
+		if (!p_options.m_record_path.empty())
+			physics_system.start_recording();
+
+		System::PhysicsSystem::StageTimings total = {};
+		for (size_t tick = 0; tick < p_options.m_ticks; tick++)
+		{
+			physics_system.integrate(delta_time);
+
+			const auto& timings           = physics_system.get_stage_timings();
+			total.m_integration          += timings.m_integration;
+			total.m_continuous_collision += timings.m_continuous_collision;
+			total.m_broadphase           += timings.m_broadphase;
+			total.m_narrow_phase         += timings.m_narrow_phase;
+			total.m_collision_response   += timings.m_collision_response;
+			total.m_sleeping             += timings.m_sleeping;
+		}
+
+		const Duration total_time = total.m_integration + total.m_continuous_collision + total.m_broadphase + total.m_narrow_phase + total.m_collision_response + total.m_sleeping;
+		const float ticks         = static_cast<float>(p_options.m_ticks);
+		LOG("------------------------------------------------------------------------");
+		LOG("[BENCH] {} bodies, {} ticks, {} contacts on the last tick", p_body_count, p_options.m_ticks, physics_system.get_contacts().size());
+		LOG("[BENCH] Total: {} ({} per tick)", total_time, total_time / ticks);
+		LOG("[BENCH] Integration:          {}", total.m_integration / ticks);
+		LOG("[BENCH] Continuous collision: {}", total.m_continuous_collision / ticks);
+		LOG("[BENCH] Broadphase:           {}", total.m_broadphase / ticks);
+		LOG("[BENCH] Narrow phase:         {}", total.m_narrow_phase / ticks);
+		LOG("[BENCH] Collision response:   {}", total.m_collision_response / ticks);
+		LOG("[BENCH] Sleeping:             {}", total.m_sleeping / ticks);
+
+		if (!p_options.m_record_path.empty())
+			physics_system.stop_recording().save(p_options.m_record_path);
+	}
+
+	// Re-simulate a recording made with --record in the scene it was recorded in, rebuilt from the body count of the recording.
+	//@return True if every tick matched the recorded checksum.
+	bool replay(const BenchOptions& p_options, const BenchMeshes& p_meshes)
+	{
+		const auto recording = System::PhysicsRecording::load(p_options.m_replay_path);
+		if (!recording || recording->m_bodies.empty())
+			return false;
+
+		System::Scene scene;
+		scene.m_broadphase = p_options.m_broadphase;
+		populate_scene(scene, p_meshes, recording->m_bodies.size() - 1); // The floor is recorded too.
+
+		System::CollisionSystem collision_system{scene};
+		System::PhysicsSystem physics_system{scene, collision_system};
+		const auto report = physics_system.replay(*recording);
+
+		using Duration = System::PhysicsSystem::StageTimings::Duration;
+		Duration total_time = Duration::zero();
+		for (size_t i = 0; i < report.m_tick_timings.size(); i++)
+		{
+			const auto& timings       = report.m_tick_timings[i];
+			const Duration tick_time  = timings.m_integration + timings.m_continuous_collision + timings.m_broadphase + timings.m_narrow_phase + timings.m_collision_response + timings.m_sleeping;
+			total_time               += tick_time;
+			LOG("[REPLAY] Tick {}: {} | checksum {:016x}{}", i, tick_time, report.m_checksums[i], report.m_checksums[i] == recording->m_ticks[i].m_checksum ? "" : " MISMATCH");
+		}
+
+		LOG("------------------------------------------------------------------------");
+		LOG("[REPLAY] {} bodies, {} ticks from '{}'", recording->m_bodies.size(), recording->m_ticks.size(), p_options.m_replay_path.string());
+		LOG("[REPLAY] Total: {} ({} per tick)", total_time, total_time / static_cast<float>(std::max(report.m_tick_timings.size(), size_t(1))));
+		if (report.m_first_mismatch)
+		{
+			LOG_ERROR("[REPLAY] Tick {} diverged from the recording", *report.m_first_mismatch);
+			return false;
+		}
+		LOG("[REPLAY] Every tick matched the recording");
+		return true;
+	}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	BenchOptions options;
+	bool parsed = true;
+	for (int i = 1; i < argc && parsed; i++)
+	{
+		if (strcmp(argv[i], "--bodies") == 0 && i + 1 < argc)
+			options.m_body_counts = {std::strtoull(argv[++i], nullptr, 10)};
+		else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+			options.m_ticks = std::strtoull(argv[++i], nullptr, 10);
+		else if (strcmp(argv[i], "--grid") == 0)
+			options.m_broadphase = System::Scene::Broadphase::SpatialHashGrid;
+		else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+			options.m_record_path = argv[++i];
+		else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+			options.m_replay_path = argv[++i];
+		else
+			parsed = false;
+	}
+	if (!parsed || options.m_ticks == 0 || options.m_body_counts.front() == 0 || (!options.m_record_path.empty() && options.m_body_counts.size() != 1))
+	{
+		printf("Usage: %s [flags]\n", argv[0]);
+		printf("\nFlags:\n");
+		printf("  --bodies <count>        Simulate a single scene of count bodies instead of 1,000, 10,000 and 100,000\n");
+		printf("  --ticks <count>         Physics ticks simulated per scene, default 60\n");
+		printf("  --grid                  Use the SpatialHashGrid broadphase instead of SweepAndPrune\n");
+		printf("  --record <path>         Record the ticks of the scene to path, requires --bodies\n");
+		printf("  --replay <path>         Replay a recording made with --record and exit with 1 if any tick diverges from it\n");
+		printf("\n");
+		exit(1);
+	}
+
+	BenchMeshes meshes{
+		make_collision_mesh(Geometry::Cuboid{glm::vec3(0.f)}, Geometry::AABB(glm::vec3(-0.5f), glm::vec3(0.5f))),
+		make_collision_mesh(Geometry::Sphere{glm::vec3(0.f), 0.5f}, Geometry::AABB(glm::vec3(-0.5f), glm::vec3(0.5f)))};
+
+	if (!options.m_replay_path.empty())
+		return replay(options, meshes) ? 0 : 1;
+
+	for (const auto& body_count : options.m_body_counts)
+		run(options, meshes, body_count);
+
+	return 0;
+}
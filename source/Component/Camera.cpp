@@ -83,6 +83,7 @@ namespace Component
 			if (p_direction == Transform::MoveDirection::Left)     p_transform->m_position += (-right()   * adjusted_speed);
 			if (p_direction == Transform::MoveDirection::Up)       p_transform->m_position += (up()       * adjusted_speed);
 			if (p_direction == Transform::MoveDirection::Down)     p_transform->m_position += (-up()      * adjusted_speed);
+			p_transform->mark_dirty();
 		}
 	}
 
@@ -8,6 +8,16 @@ namespace Component
 	Collider::Collider()
 		: m_world_AABB{}
 		, m_collided(false)
+		, m_collision_mesh{nullptr}
+		, m_layer{Geometry::CollisionFilter::Default_Layer}
+		, m_mask{Geometry::CollisionFilter::All_Layers}
+	{}
+	Collider::Collider(const Data::CollisionMesh& p_collision_mesh)
+		: m_world_AABB{}
+		, m_collided(false)
+		, m_collision_mesh{&p_collision_mesh}
+		, m_layer{Geometry::CollisionFilter::Default_Layer}
+		, m_mask{Geometry::CollisionFilter::All_Layers}
 	{}
 
 	void Collider::draw_UI()
@@ -17,6 +27,8 @@ namespace Component
 			ImGui::Checkbox("Colliding", &m_collided);
 			ImGui::Text("World AABB min", m_world_AABB.m_min);
 			ImGui::Text("World AABB max", m_world_AABB.m_max);
+			ImGui::InputScalar("Layer", ImGuiDataType_U32, &m_layer, nullptr, nullptr, "%08X", ImGuiInputTextFlags_CharsHexadecimal);
+			ImGui::InputScalar("Mask",  ImGuiDataType_U32, &m_mask,  nullptr, nullptr, "%08X", ImGuiInputTextFlags_CharsHexadecimal);
 
 			ImGui::TreePop();
 		}
@@ -1,7 +1,14 @@
 #pragma once
 
 #include "Geometry/AABB.hpp"
+#include "Geometry/CollisionFilter.hpp"
 
+#include <cstdint>
+
+namespace Data
+{
+	struct CollisionMesh;
+}
 namespace Component
 {
 	struct Transform;
@@ -11,8 +18,14 @@ namespace Component
 	public:
 		Geometry::AABB m_world_AABB; // The world space AABB of the entity. PhysicsSystem is responsible for updating this.
 		bool m_collided;
+		// The object space collision data of the entity. CollisionSystem::update points this at the Data::Mesh of Entities with a Mesh.
+		// Entities without a Mesh (e.g. in PhysicsBench) set it themselves to a CollisionMesh outliving the Collider. Null Colliders are ignored.
+		const Data::CollisionMesh* m_collision_mesh;
+		uint32_t m_layer; // The collision layers this Collider is in, one bit per layer.
+		uint32_t m_mask;  // The collision layers this Collider collides with. A pair collides if each is in a layer of the other's mask.
 		// Constructs a collider from an object space AABB and initial world space transformation info.
 		Collider();
+		explicit Collider(const Data::CollisionMesh& p_collision_mesh);
 
 		void draw_UI();
 	};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Geometry/AABB.hpp"
+#include "Geometry/Shape.hpp"
+#include "Geometry/TriangleBVH.hpp"
+
+#include <vector>
+
+namespace Data
+{
+	// The object space collision data of a mesh, everything CollisionSystem and PhysicsSystem read.
+	// Holds no GPU resources so it can be built without an OpenGL context e.g. in PhysicsBench. Data::Mesh adds the render data.
+	struct CollisionMesh
+	{
+		Geometry::AABB AABB;                           // Object-space AABB for broad-phase collision detection.
+		std::vector<Geometry::Shape> collision_shapes; // Object-space shape for narrow-phase collision detection.
+		Geometry::TriangleBVH triangle_BVH;            // Object-space triangles for narrow-phase collision detection of meshes without collision_shapes. Empty unless requested.
+	};
+}
@@ -1,8 +1,7 @@
 #pragma once
 
+#include "Component/CollisionMesh.hpp"
 #include "Component/Vertex.hpp"
-#include "Geometry/AABB.hpp"
-#include "Geometry/Shape.hpp"
 #include "OpenGL/Types.hpp"
 #include "Utility/ResourceManager.hpp"
 
@@ -10,7 +9,8 @@
 
 namespace Data
 {
-	class Mesh
+	// The GPU vertex data of a mesh and its CollisionMesh.
+	class Mesh : public CollisionMesh
 	{
 		OpenGL::VAO VAO;
 		OpenGL::VBO VBO;
@@ -18,9 +18,6 @@ namespace Data
 		OpenGL::PrimitiveMode primitive_mode;
 
 	public:
-		Geometry::AABB AABB;                           // Object-space AABB for broad-phase collision detection.
-		std::vector<Geometry::Shape> collision_shapes; // Object-space shape for narrow-phase collision detection.
-
 		void draw()
 		{
 			VAO.bind();
@@ -34,13 +31,14 @@ namespace Data
 
 		template <typename VertexType>
 		requires is_valid_mesh_vert<VertexType>
-		Mesh(const std::vector<VertexType>& vertex_data, OpenGL::PrimitiveMode primitive_mode, const std::vector<Geometry::Shape>& shapes) noexcept
-			: VAO{}
+		//@param build_triangle_BVH Build triangle_BVH from the vertex positions, requires a Triangles primitive_mode. Meshes built every
+		// frame (e.g. debug geometry) or colliding with their collision_shapes don't need one.
+		Mesh(const std::vector<VertexType>& vertex_data, OpenGL::PrimitiveMode primitive_mode, const std::vector<Geometry::Shape>& shapes, bool build_triangle_BVH = false) noexcept
+			: CollisionMesh{Geometry::AABB{}, shapes, Geometry::TriangleBVH{}} // TODO: Feed AABB out of the MeshBuilder like shapes.
+			, VAO{}
 			, VBO{}
 			, draw_size{(GLsizei)vertex_data.size()}
 			, primitive_mode{primitive_mode}
-			, AABB{} // TODO: Feed AABB out of the MeshBuilder like shapes.
-			, collision_shapes{shapes}
 		{
 			static_assert(has_position_member<VertexType>, "VertexType must have a position member");
 
@@ -63,6 +61,16 @@ namespace Data
 					AABB.unite(vertex_data[i].position);
 			}
 
+			if (build_triangle_BVH)
+			{
+				ASSERT(primitive_mode == OpenGL::PrimitiveMode::Triangles, "Triangle BVH requires a Triangles mesh, every 3 vertices form a triangle.");
+				std::vector<Geometry::Triangle> triangles;
+				triangles.reserve(vertex_data.size() / 3);
+				for (size_t i = 0; i + 2 < vertex_data.size(); i += 3)
+					triangles.emplace_back(vertex_data[i].position, vertex_data[i + 1].position, vertex_data[i + 2].position);
+				triangle_BVH = Geometry::TriangleBVH(std::move(triangles));
+			}
+
 			if constexpr (has_normal_member<VertexType>)
 			{
 				OpenGL::vertex_attrib_pointer(
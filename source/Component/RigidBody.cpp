@@ -16,11 +16,20 @@ namespace Component
 		, m_inertia_tensor{glm::identity<glm::mat3>()}
 		, m_mass{1}
 		, m_apply_gravity{false}
+		, m_type{Type::Dynamic}
+		, m_asleep{false}
+		, m_sleep_timer{0.f}
 	{}
 
 	void RigidBody::apply_linear_force(const glm::vec3& p_force)
 	{
 		m_force += p_force;
+		wake();
+	}
+	void RigidBody::wake()
+	{
+		m_asleep      = false;
+		m_sleep_timer = 0.f;
 	}
 
 	void RigidBody::draw_UI()
@@ -45,7 +54,11 @@ namespace Component
 			ImGui::SliderFloat3("Angular Tensor 3   (kg m²)", &m_inertia_tensor[2][0], 0.001f, inertiaLimit);
 
 			ImGui::Separator();
+			static const std::vector<std::pair<Type, const char*>> type_options = {{Type::Static, "Static"}, {Type::Kinematic, "Kinematic"}, {Type::Dynamic, "Dynamic"}};
+			ImGui::ComboContainer("Type", m_type, type_options);
 			ImGui::Checkbox("Apply Gravity", &m_apply_gravity);
+			if (ImGui::Checkbox("Asleep", &m_asleep))
+				m_sleep_timer = 0.f;
 			ImGui::TreePop();
 
 			if (ImGui::Button("Reset"))
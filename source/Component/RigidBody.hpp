@@ -3,6 +3,8 @@
 #include "glm/vec3.hpp"
 #include "glm/mat3x3.hpp"
 
+#include <cstdint>
+
 namespace Component
 {
 	// An idealised body that exhibits 0 deformation. All units are in SI.
@@ -18,7 +20,7 @@ namespace Component
 
 		// Angular motion
 		// -----------------------------------------------------------------------------
-		glm::vec3 m_torque;          // Angular force T in Newton meters producing a change in rotational motion (kg m²/s²)
+		glm::vec3 m_torque;           // Angular force T in Newton meters producing a change in rotational motion (kg m²/s²), applied on a PhysicsSystem tick and reset to 0.
 		glm::vec3 m_angular_momentum; // Angular momentum L in Newton meter seconds, a conserved quantity if no external torque is applied (kg m²/s)
 		glm::vec3 m_angular_velocity; // Angular velocity ω representing how quickly (Hz) this body revolves relative to it's axis (/s)
 		glm::mat3 m_inertia_tensor;   // Moment of inertia tensor J, a symmetric matrix determining the torque needed for a desired angular acceleration about a rotational axis (kg m2)
@@ -27,9 +29,30 @@ namespace Component
 		bool m_apply_gravity;
 		// Position and orientation are stored in Component::Transform.
 
+		// Body type
+		// -----------------------------------------------------------------------------
+		enum class Type : uint8_t
+		{
+			Static,    // Never moves. Bodies collide with it but it doesn't respond to contacts e.g. level geometry.
+			Kinematic, // Moves with its momentum and angular momentum ignoring forces and contacts e.g. moving platforms.
+			Dynamic    // Moved by forces and contacts.
+		};
+		Type m_type; // Static and kinematic bodies never pair with each other in the broadphase.
+
+		// Sleeping
+		// -----------------------------------------------------------------------------
+		bool m_asleep;       // Sleeping bodies are skipped by the PhysicsSystem until woken by a force or a contact with an awake body.
+		float m_sleep_timer; // Time the body has been moving slower than the PhysicsSystem sleep velocities (s)
+
 		RigidBody();
-		// Apply a linear p_force (kg m/s²) on the body. Force is applied on a PhysicsSystem::update tick.
+		// Apply a linear p_force (kg m/s²) on the body. Force is applied on a PhysicsSystem::update tick. Wakes the body.
 		void apply_linear_force(const glm::vec3& p_force);
+		// Wake the body, the PhysicsSystem wakes the rest of its island on the next tick.
+		void wake();
 		void draw_UI();
 	};
+
+	// Owned by the Entities of the bodies System::PhysicsSystem put to sleep, in archetypes apart from the awake bodies so the per tick loops
+	// skip the sleeping bodies an archetype at a time. RigidBody::m_asleep is the sleeping state, only the PhysicsSystem adds and removes this.
+	struct Sleeping {};
 }
\ No newline at end of file
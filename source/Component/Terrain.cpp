@@ -12,6 +12,7 @@ Component::Terrain::Terrain(int p_size_x, int p_size_z) noexcept
 	, m_size_z{p_size_z}
 	, m_scale_factor{1.f}
 	, m_texture{}
+	, m_heightfield{generate_heightfield()}
 	, m_mesh{generate_mesh()}
 {}
 
@@ -20,22 +21,37 @@ float compute_height(float p_x, float p_z, float p_scale_factor, const siv::Perl
 	return static_cast<float>(perlin.noise2D(p_x * p_scale_factor, p_z * p_scale_factor));
 }
 
-Data::Mesh Component::Terrain::generate_mesh() noexcept
+Geometry::Heightfield Component::Terrain::generate_heightfield() noexcept
 {
 	// Use perlin noise to generate a heightmap in the xz plane.
-	auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
-	mb.reserve((m_size_x * m_size_z) * 6);
 	const siv::PerlinNoise::seed_type seed = 123456u;
 	const siv::PerlinNoise perlin{seed};
 
-	for (float x = 0; x < m_size_x; x++)
-		for (float z = 0; z < m_size_z; z++)
+	const auto vertices_x = static_cast<size_t>(m_size_x) + 1;
+	const auto vertices_z = static_cast<size_t>(m_size_z) + 1;
+	std::vector<float> heights;
+	heights.reserve(vertices_x * vertices_z);
+	for (size_t x = 0; x < vertices_x; x++)
+		for (size_t z = 0; z < vertices_z; z++)
+			heights.push_back(compute_height(static_cast<float>(x), static_cast<float>(z), m_scale_factor, perlin));
+
+	return Geometry::Heightfield(static_cast<size_t>(m_size_x), static_cast<size_t>(m_size_z), 1.f, std::move(heights));
+}
+
+Data::Mesh Component::Terrain::generate_mesh() noexcept
+{
+	auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
+	mb.reserve((m_size_x * m_size_z) * 6);
+
+	for (size_t x = 0; x < m_heightfield.cells_x(); x++)
+		for (size_t z = 0; z < m_heightfield.cells_z(); z++)
 		{
+			const auto triangles = m_heightfield.get_cell_triangles(x, z);
 			mb.add_quad(
-				glm::vec3(x + 1, compute_height(x + 1, z,     m_scale_factor, perlin), z),
-				glm::vec3(x + 1, compute_height(x + 1, z + 1, m_scale_factor, perlin), z + 1),
-				glm::vec3(x,     compute_height(x, z,         m_scale_factor, perlin), z),
-				glm::vec3(x,     compute_height(x, z + 1,     m_scale_factor, perlin), z  + 1));
+				triangles[0].m_point_1, // (x + 1, z)
+				triangles[1].m_point_3, // (x + 1, z + 1)
+				triangles[0].m_point_2, // (x, z)
+				triangles[0].m_point_3); // (x, z + 1)
 		}
 
 	return mb.get_mesh();
@@ -63,7 +79,10 @@ void Component::Terrain::draw_UI(System::TextureSystem& p_texture_system)
 		ImGui::Slider("Scale factor", m_scale_factor, 0.01f , 10.f);
 
 		if (ImGui::Button("Re-generate terrain"))
-			m_mesh = generate_mesh();
+		{
+			m_heightfield = generate_heightfield();
+			m_mesh        = generate_mesh();
+		}
 
 		ImGui::TreePop();
 	}
@@ -1,6 +1,8 @@
 #include "Component/Texture.hpp"
 #include "Component/Mesh.hpp"
 
+#include "Geometry/Heightfield.hpp"
+
 namespace System
 {
 	class TextureSystem;
@@ -9,6 +11,8 @@ namespace Component
 {
 	class Terrain
 	{
+		Geometry::Heightfield generate_heightfield() noexcept;
+		// Requires m_heightfield is generated.
 		Data::Mesh generate_mesh() noexcept;
 
 	public:
@@ -17,6 +21,7 @@ namespace Component
 		int m_size_z;
 		float m_scale_factor;
 		TextureRef m_texture;
+		Geometry::Heightfield m_heightfield; // The collision surface of the terrain, m_mesh is built from the same heights.
 		Data::Mesh m_mesh;
 
 		Terrain(int p_size_x, int p_size_z) noexcept;
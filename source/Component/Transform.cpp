@@ -9,17 +9,17 @@ namespace Component
 {
 	void Transform::rotateEulerDegrees(const glm::vec3& p_roll_pitch_yawDegrees)
 	{
-		m_roll_pitch_yaw = p_roll_pitch_yawDegrees;
-		m_orientation    = glm::normalize(Utility::to_quaternion(glm::radians(m_roll_pitch_yaw)));
-		m_direction      = glm::normalize(m_orientation * Starting_Forward_Direction);
+		m_orientation = glm::normalize(Utility::to_quaternion(glm::radians(p_roll_pitch_yawDegrees)));
+		m_direction   = glm::normalize(m_orientation * Starting_Forward_Direction);
+		mark_dirty();
 	}
 	void Transform::look_at(const glm::vec3& p_point)
 	{
 		if (p_point != m_position)
 		{
-			m_direction      = glm::normalize(p_point - m_position);
-			m_orientation    = Utility::get_rotation(Starting_Forward_Direction, m_direction);
-			m_roll_pitch_yaw = Utility::to_roll_pitch_yaw(m_orientation);
+			m_direction   = glm::normalize(p_point - m_position);
+			m_orientation = Utility::get_rotation(Starting_Forward_Direction, m_direction);
+			mark_dirty();
 		}
 	}
 
@@ -29,21 +29,58 @@ namespace Component
 		glm::vec4 perspective;
 		glm::decompose(p_model, m_scale, m_orientation, m_position, skew, perspective);
 
-		m_roll_pitch_yaw = Utility::to_roll_pitch_yaw(m_orientation);
-		m_direction      = glm::normalize(m_orientation * Starting_Forward_Direction);
-		m_model          = p_model;
+		m_direction = glm::normalize(m_orientation * Starting_Forward_Direction);
+		m_model     = p_model;
+		mark_dirty(); // m_model is current but the world AABBs are not.
+		store_previous_state(); // Moved outside of physics, don't interpolate from the old state.
+	}
+	void Transform::update_model()
+	{
+		m_model     = glm::mat4_cast(m_orientation);
+		m_model[0] *= m_scale.x;
+		m_model[1] *= m_scale.y;
+		m_model[2] *= m_scale.z;
+		m_model[3]  = glm::vec4(m_position, 1.f);
+	}
+	glm::vec3 Transform::get_roll_pitch_yaw() const
+	{
+		return glm::degrees(Utility::to_roll_pitch_yaw(m_orientation));
+	}
+	glm::mat4 Transform::get_interpolated_model(const float& p_alpha) const
+	{
+		// m_model is stale when moved outside of physics since the last CollisionSystem::update e.g. by the editor.
+		if (!m_dirty && m_previous_position == m_position && m_previous_orientation == m_orientation)
+			return m_model;
+
+		// Translate * Rotate * Scale as composed by the integrator.
+		auto model = glm::mat4_cast(glm::slerp(m_previous_orientation, m_orientation, p_alpha));
+		model[0]  *= m_scale.x;
+		model[1]  *= m_scale.y;
+		model[2]  *= m_scale.z;
+		model[3]   = glm::vec4(glm::mix(m_previous_position, m_position, p_alpha), 1.f);
+		return model;
 	}
 
 	void Transform::draw_UI()
 	{
 		if (ImGui::TreeNode("Transform"))
 		{
-			ImGui::Slider("Position", m_position, -50.f, 50.f, "%.3f m");
-			ImGui::Slider("Scale", m_scale, 0.1f, 10.f);
+			// Edits move the Transform outside of physics, renders jump straight to the edit instead of interpolating from the last tick.
+			if (ImGui::Slider("Position", m_position, -50.f, 50.f, "%.3f m"))
+			{
+				mark_dirty();
+				store_previous_state();
+			}
+			if (ImGui::Slider("Scale", m_scale, 0.1f, 10.f))
+				mark_dirty();
 
 			// Editor shows the rotation as Euler Roll, Pitch, Yaw, when set these need to be converted to quaternion orientation and unit direction.
-			if (ImGui::Slider("Roll Pitch Yaw", m_roll_pitch_yaw, -179.f, 179.f, "%.3f °"))
-				rotateEulerDegrees(m_roll_pitch_yaw);
+			auto roll_pitch_yaw = get_roll_pitch_yaw();
+			if (ImGui::Slider("Roll Pitch Yaw", roll_pitch_yaw, -179.f, 179.f, "%.3f °"))
+			{
+				rotateEulerDegrees(roll_pitch_yaw);
+				store_previous_state();
+			}
 
 			ImGui::Separator();
 			ImGui::Text("Directon",    m_direction);
@@ -51,17 +88,21 @@ namespace Component
 
 			ImGui::SeparatorText("Actions");
 			if (ImGui::Button("Focus on origin"))
+			{
 				look_at(glm::vec3(0.f));
+				store_previous_state();
+			}
 			ImGui::SameLine();
 
 			// https://glm.g-truc.net/0.9.2/api/a00259.html#
 			if (ImGui::Button("Reset"))
 			{
-				m_position       = glm::vec3(0.0f, 0.0f, 0.0f);
-				m_roll_pitch_yaw = glm::vec3(0.0f);
-				m_scale          = glm::vec3(1.0f);
-				m_direction      = Starting_Forward_Direction;
-				m_orientation    = glm::identity<glm::quat>();
+				m_position    = glm::vec3(0.0f, 0.0f, 0.0f);
+				m_scale       = glm::vec3(1.0f);
+				m_direction   = Starting_Forward_Direction;
+				m_orientation = glm::identity<glm::quat>();
+				mark_dirty();
+				store_previous_state();
 			}
 			ImGui::TreePop();
 		}
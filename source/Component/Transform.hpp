@@ -15,19 +15,33 @@ namespace Component
 
 		constexpr Transform(const glm::vec3& p_position = glm::vec3(0.f)) noexcept
 			: m_position{p_position}
-			, m_roll_pitch_yaw{glm::vec3(0.0f)}
 			, m_scale{glm::vec3(1.0f)}
 			, m_direction{Starting_Forward_Direction}
 			, m_orientation{glm::identity<glm::quat>()}
 			, m_model{glm::identity<glm::mat4>()}
+			, m_previous_position{p_position}
+			, m_previous_orientation{glm::identity<glm::quat>()}
+			, m_dirty{true}
 		{}
 
 		glm::vec3 m_position;       // World-space position.
-		glm::vec3 m_roll_pitch_yaw; // Roll, Pitch, Yaw rotation represented in Euler degree angles. Range [-180 - 180].
 		glm::vec3 m_scale;
 		glm::vec3 m_direction;      // World-space direction vector the entity is facing.
 		glm::quat m_orientation;    // Unit quaternion taking the Starting_Forward_Direction to the current orientation.
-		glm::mat4 m_model;
+		glm::mat4 m_model;          // Translate * Rotate * Scale as of the last update_model, stale while m_dirty is set.
+		glm::vec3 m_previous_position;    // m_position at the start of the last physics tick.
+		glm::quat m_previous_orientation; // m_orientation at the start of the last physics tick.
+		// Set when m_position, m_orientation or m_scale change. m_model and the Collider world AABB derived from them are only rebuilt for
+		// dirty Transforms, in one batched pass by System::CollisionSystem::update which then clears it. Every dirty Transform is rebuilt and
+		// cleared, with or without a Mesh or Collider. Transforms that don't move cost nothing per tick.
+		// Code writing the members directly must call mark_dirty, the member functions below mark the Transform themselves.
+		bool m_dirty;
+
+		void mark_dirty() { m_dirty = true; }
+		// Rebuild m_model from m_position, m_orientation and m_scale. Doesn't clear m_dirty as the world AABBs may still be stale.
+		void update_model();
+		// Roll, Pitch, Yaw rotation of m_orientation represented in Euler degree angles. Range [-180 - 180].
+		glm::vec3 get_roll_pitch_yaw() const;
 
 		// Rotate the object to roll pitch and yaw euler angles in the order XYZ. Angles suppled are in degrees.
 		void rotateEulerDegrees(const glm::vec3& p_roll_pitch_yawDegrees);
@@ -35,6 +49,11 @@ namespace Component
 		void look_at(const glm::vec3& p_point);
 
 		void set_model_matrix(const glm::mat4& p_model);
+		// Keep the current position and orientation as the state the next physics tick moves from.
+		void store_previous_state() { m_previous_position = m_position; m_previous_orientation = m_orientation; }
+		// The model matrix between the previous and current physics tick state. 0 is the previous state, 1 the current.
+		// Renders between physics ticks are drawn at the fraction of the tick elapsed so motion is smooth above the physics rate.
+		glm::mat4 get_interpolated_model(const float& p_alpha) const;
 
 		glm::vec3 forward() const { return m_direction; };
 		glm::vec3 right()   const { return glm::normalize(m_orientation * glm::vec3(1.f,0.f,0.f)); };
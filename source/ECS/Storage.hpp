@@ -5,8 +5,11 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <cstring>
 #include <iostream>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <typeindex>
 #include <typeinfo>
 #include <utility>
@@ -45,6 +48,7 @@ namespace ECS
 			: Destruct(nullptr)
 			, MoveAssign(nullptr)
 			, MoveConstruct(nullptr)
+			, CopyConstruct(nullptr)
 		{}
 
 		template <typename T>
@@ -65,6 +69,7 @@ namespace ECS
 								using Type = std::decay_t<T>;
 								new (p_destination_address) Type(std::move(*static_cast<Type*>(p_source_address)));
 							}}
+			, CopyConstruct{get_copy_construct<T>()}
 		{}
 
 		// Call the destructor of the object at p_address_to_destroy.
@@ -73,14 +78,29 @@ namespace ECS
 		void (*MoveAssign)(void* p_destination_address, void* p_source_address);
 		// placement-new move-construct the object pointed to by p_source_address into the memory pointed to by p_destination_address.
 		void (*MoveConstruct)(void* p_destination_address, void* p_source_address);
+		// placement-new copy-construct the object pointed to by p_source_address into the memory pointed to by p_destination_address.
+		// nullptr if the type is not copy constructible.
+		void (*CopyConstruct)(void* p_destination_address, const void* p_source_address);
+
+	private:
+		template <typename T>
+		static auto get_copy_construct() -> void (*)(void*, const void*)
+		{
+			using Type = std::decay_t<T>;
+			if constexpr (std::is_copy_constructible_v<Type>)
+				return [](void* p_destination_address, const void* p_source_address) { new (p_destination_address) Type(*static_cast<const Type*>(p_source_address)); };
+			else
+				return nullptr;
+		}
 	};
 
 	struct ComponentInfo
 	{
-		ComponentID ID    = 0;
-		size_t size       = 0;
-		size_t align      = 0;
-		MemberFuncs funcs = {};
+		ComponentID ID          = 0;
+		size_t size             = 0;
+		size_t align            = 0;
+		MemberFuncs funcs       = {};
+		bool trivially_copyable = false; // If true, the component can be copied with memcpy instead of funcs.CopyConstruct.
 	};
 
 	struct ComponentLayout
@@ -96,6 +116,9 @@ namespace ECS
 	class ComponentHelper
 	{
 	   static inline std::array<std::optional<ComponentInfo>, Max_Component_Count> Infos = {};
+	   // Guards Infos, allowing a Storage to be populated on a thread other than the main thread while others are read.
+	   // set_info takes it exclusively, get_info takes it shared so lookups don't serialise against each other.
+	   static inline std::shared_mutex infos_mutex;
 
 	   static inline ComponentID counter = 0;
 	   template <typename ComponentType>
@@ -130,10 +153,11 @@ namespace ECS
 		static inline ComponentID set_info()
 		{
 			auto ID = get_ID<ComponentType>();
+			std::unique_lock lock(infos_mutex);
 			if (!Infos[ID].has_value())
 			{
 				using DecayedComponentType = std::decay_t<ComponentType>;
-				Infos[ID]                  = std::make_optional<ComponentInfo>(ID, sizeof(DecayedComponentType), alignof(DecayedComponentType), Meta::PackArg<DecayedComponentType>());
+				Infos[ID]                  = std::make_optional<ComponentInfo>(ID, sizeof(DecayedComponentType), alignof(DecayedComponentType), Meta::PackArg<DecayedComponentType>(), std::is_trivially_copyable_v<DecayedComponentType>);
 				LOG("ComponentInfo set for {} ({}): ID: {}, size: {}, alignment: {}", typeid(ComponentType).name(), typeid(DecayedComponentType).name(), Infos[ID]->ID, Infos[ID]->size, Infos[ID]->align);
 			}
 			return ID;
@@ -147,11 +171,13 @@ namespace ECS
 		template <typename ComponentType>
 		static inline ComponentInfo get_info()
 		{
+			std::shared_lock lock(infos_mutex);
 			ASSERT(Infos[get_ID<ComponentType>()].has_value(), "Info for ComponentID {} is not set. Did you forget to call set_info for this ComponentType.", get_ID<ComponentType>());
 			return Infos[get_ID<ComponentType>()].value();
 		}
 		static inline ComponentInfo get_info(const ComponentID& p_ID)
 		{
+			std::shared_lock lock(infos_mutex);
 			ASSERT(Infos[p_ID].has_value(), "Info for ComponentID {} is not set. Did you forget to call set_info for this ComponentType.", p_ID);
 			return Infos[p_ID].value();
 		}
@@ -314,6 +340,102 @@ namespace ECS
 		return component_layouts;
 	}
 
+	// Copies the components of p_source laid out by p_components into p_destination.
+	// Trivially copyable components are memcpy'd, the rest are copy-constructed using their MemberFuncs::CopyConstruct.
+	inline void copy_construct_instance(std::byte* p_destination, const std::byte* p_source, const std::vector<ComponentLayout>& p_components)
+	{
+		for (const auto& component : p_components)
+		{
+			if (component.info.trivially_copyable)
+				std::memcpy(&p_destination[component.offset], &p_source[component.offset], component.info.size);
+			else
+				component.info.funcs.CopyConstruct(&p_destination[component.offset], &p_source[component.offset]);
+		}
+	}
+
+	// A Prefab is a snapshot of the components owned by an Entity. Prefabs are created using Storage::make_prefab.
+	// Storage::instantiate uses a Prefab to create copies of the Entity in bulk, resolving the archetype and reserving its capacity once.
+	// The components are stored with the same layout as the Archetype they were captured from so each new instance is a block copy.
+	class Prefab
+	{
+		friend class Storage;
+
+		ComponentBitset m_bitset;                  // The ComponentBitset of the Archetype the Prefab instantiates into.
+		std::vector<ComponentLayout> m_components; // Identical to the m_components of the Archetype the Prefab was captured from.
+		size_t m_instance_size;                    // Size in Bytes of the components in m_data.
+		bool m_trivially_copyable;                 // True if all the components are trivially copyable, allowing the whole instance to be copied with one memcpy.
+		std::byte* m_data;
+
+		Prefab(const ComponentBitset& p_bitset, const std::vector<ComponentLayout>& p_components, const size_t& p_instance_size, const std::byte* p_source) noexcept
+			: m_bitset{p_bitset}
+			, m_components{p_components}
+			, m_instance_size{p_instance_size}
+			, m_trivially_copyable{std::all_of(m_components.begin(), m_components.end(), [](const auto& p_component) { return p_component.info.trivially_copyable; })}
+			, m_data{(std::byte*)malloc(m_instance_size)}
+		{
+			if (m_trivially_copyable)
+				std::memcpy(m_data, p_source, m_instance_size);
+			else
+				copy_construct_instance(m_data, p_source, m_components);
+		}
+
+		// Call the destructor for all the components and free the heap memory.
+		void destroy()
+		{
+			if (m_data != nullptr)
+			{
+				for (auto& component : m_components)
+					component.info.funcs.Destruct(&m_data[component.offset]);
+
+				free(m_data);
+				m_data = nullptr;
+			}
+		}
+
+	public:
+		~Prefab() noexcept
+		{
+			destroy();
+		}
+
+		Prefab(Prefab&& p_other) noexcept
+			: m_bitset{std::move(p_other.m_bitset)}
+			, m_components{std::move(p_other.m_components)}
+			, m_instance_size{std::move(p_other.m_instance_size)}
+			, m_trivially_copyable{std::move(p_other.m_trivially_copyable)}
+			, m_data{std::exchange(p_other.m_data, nullptr)}
+		{}
+		Prefab& operator=(Prefab&& p_other) noexcept
+		{
+			if (this != &p_other)
+			{
+				destroy();
+				m_bitset             = std::move(p_other.m_bitset);
+				m_components         = std::move(p_other.m_components);
+				m_instance_size      = std::move(p_other.m_instance_size);
+				m_trivially_copyable = std::move(p_other.m_trivially_copyable);
+				m_data               = std::exchange(p_other.m_data, nullptr);
+			}
+			return *this;
+		}
+
+		// No copying prefabs
+		Prefab(const Prefab& p_other)            = delete;
+		Prefab& operator=(const Prefab& p_other) = delete;
+
+		// Get a const reference to the ComponentType stored in the Prefab.
+		template <typename ComponentType>
+		[[nodiscard]] const std::decay_t<ComponentType>& get_component() const
+		{
+			const auto component_ID = ComponentHelper::get_ID<ComponentType>();
+			auto it = std::find_if(m_components.begin(), m_components.end(), [&component_ID](const auto& p_component_layout)
+				{ return p_component_layout.info.ID == component_ID; });
+
+			ASSERT_THROW(it != m_components.end(), "Requested a ComponentType not present in this prefab.");
+			return *reinterpret_cast<const std::decay_t<ComponentType>*>(&m_data[it->offset]);
+		}
+	};
+
 	// A container of Entity objects and the components they own.
 	// Every unique combination of components makes an Archetype which is a contiguouse store of all the ComponentTypes.
 	// Storage is interfaced using Entity as a key.
@@ -375,7 +497,7 @@ namespace ECS
 				, m_components{std::move(p_other.m_components)}
 				, m_entities{std::move(p_other.m_entities)}
 				, m_instance_size{std::move(p_other.m_instance_size)}
-				, m_next_instance_ID{std::move(p_other.m_next_instance_ID)}
+				, m_next_instance_ID{std::exchange(p_other.m_next_instance_ID, 0)}
 				, m_capacity{std::move(p_other.m_capacity)}
 				, m_data{std::exchange(p_other.m_data, nullptr)}
 			{
@@ -396,7 +518,7 @@ namespace ECS
 					m_components       = std::move(p_other.m_components);
 					m_entities         = std::move(p_other.m_entities);
 					m_instance_size    = std::move(p_other.m_instance_size);
-					m_next_instance_ID = std::move(p_other.m_next_instance_ID);
+					m_next_instance_ID = std::exchange(p_other.m_next_instance_ID, 0);
 					m_capacity         = std::move(p_other.m_capacity);
 					m_data             = std::exchange(p_other.m_data, nullptr);
 				}
@@ -611,20 +733,25 @@ namespace ECS
 		struct ApplyFunction<Func, Meta::PackArgs<FunctionArgs...>>
 		{
 			static void apply_to_archetype(const Func& p_function, Archetype& p_archetype)
+			{
+				apply_to_archetype_range(p_function, p_archetype, 0, p_archetype.m_next_instance_ID);
+			}
+			// Call p_function on the instances [p_begin, p_end) of p_archetype.
+			static void apply_to_archetype_range(const Func& p_function, Archetype& p_archetype, const ArchetypeInstanceID& p_begin, const ArchetypeInstanceID& p_end)
 			{
 				const auto index_sequence = std::index_sequence_for<FunctionArgs...>{};
 				const auto offsets = getOffsets(p_archetype, index_sequence);
-				impl(p_function, p_archetype, offsets, index_sequence);
+				impl(p_function, p_archetype, p_begin, p_end, offsets, index_sequence);
 			}
 
 		private:
-			// Given a p_function and p_archetype, calls p_function on every ArchetypeInstanceID supplying the ComponentTypes as arguments.
+			// Given a p_function and p_archetype, calls p_function on every ArchetypeInstanceID in [p_begin, p_end) supplying the ComponentTypes as arguments.
 			// p_archetype_offsets: The mapping of p_function arguments to their offsets per ArchetypeInstanceID.
 			// index_sequence:    Provides a mechanism to execute a fold expression to retrieve all the arguments from the Archetype.
 			template <std::size_t... Is>
-			static void impl(const Func& p_function, Archetype& p_archetype, const std::array<BufferPosition, sizeof...(FunctionArgs)>& p_archetype_offsets, const std::index_sequence<Is...>&)
+			static void impl(const Func& p_function, Archetype& p_archetype, const ArchetypeInstanceID& p_begin, const ArchetypeInstanceID& p_end, const std::array<BufferPosition, sizeof...(FunctionArgs)>& p_archetype_offsets, const std::index_sequence<Is...>&)
 			{ // If we have reached this point we can guarantee p_archetype contains all the components in FunctionArgs.
-				for (ArchetypeInstanceID i = 0; i < p_archetype.m_next_instance_ID; i++)
+				for (ArchetypeInstanceID i = p_begin; i < p_end; i++)
 					p_function(*get_from_archetype<FunctionArgs>(p_archetype, i, p_archetype_offsets[Is])...);
 			}
 
@@ -711,6 +838,147 @@ namespace ECS
 
 			return new_entity;
 		}
+		// Capture a copy of all the components owned by p_entity into a Prefab.
+		// All the ComponentTypes owned by p_entity must be copy constructible.
+		[[nodiscard]] Prefab make_prefab(const Entity& p_entity) const
+		{
+			const auto& [archetype_ID, index] = *m_entity_to_archetype_ID[p_entity.ID];
+			const auto& archetype             = m_archetypes[archetype_ID];
+
+			for (const auto& component : archetype.m_components)
+				ASSERT_THROW(component.info.trivially_copyable || component.info.funcs.CopyConstruct != nullptr, "ComponentID {} is not copy constructible and cannot be captured in a Prefab.", component.info.ID);
+
+			return Prefab(archetype.m_bitset, archetype.m_components, archetype.m_instance_size, &archetype.m_data[archetype.m_instance_size * index]);
+		}
+
+		// Creates p_count Entities owning a copy of the components in p_prefab.
+		// The archetype is found and its capacity reserved once for all the new Entities, the components are then copied in as a block per Entity.
+		//@return The new Entities in the order they were created.
+		std::vector<Entity> instantiate(const Prefab& p_prefab, const size_t& p_count)
+		{
+			std::vector<Entity> new_entities;
+			if (p_count == 0)
+				return new_entities;
+
+			auto archetype_ID = get_matching_archetype(p_prefab.m_bitset);
+			if (!archetype_ID)
+			{// No matching archetype was found we add a new one for this ComponentBitset.
+				m_archetypes.push_back(Archetype(p_prefab.m_bitset));
+				archetype_ID = m_archetypes.size() - 1;
+			}
+
+			auto& archetype = m_archetypes[archetype_ID.value()];
+			ASSERT(archetype.m_instance_size == p_prefab.m_instance_size, "Prefab layout does not match the layout of the archetype it is instantiating into.");
+
+			const auto required_capacity = archetype.m_next_instance_ID + p_count;
+			if (required_capacity > archetype.m_capacity)
+				archetype.reserve(next_greater_power_of_2(required_capacity));
+			archetype.m_entities.reserve(required_capacity);
+			m_entity_to_archetype_ID.reserve(m_entity_to_archetype_ID.size() + p_count);
+			new_entities.reserve(p_count);
+
+			for (size_t i = 0; i < p_count; i++)
+			{
+				auto* instance_address = &archetype.m_data[archetype.m_instance_size * archetype.m_next_instance_ID];
+				if (p_prefab.m_trivially_copyable)
+					std::memcpy(instance_address, p_prefab.m_data, p_prefab.m_instance_size);
+				else
+					copy_construct_instance(instance_address, p_prefab.m_data, p_prefab.m_components);
+
+				const auto new_entity = Entity(m_next_entity_ID++);
+				archetype.m_entities.push_back(new_entity);
+				m_entity_to_archetype_ID.push_back(std::make_optional(std::make_pair(archetype_ID.value(), archetype.m_next_instance_ID)));
+				archetype.m_next_instance_ID++;
+				new_entities.push_back(new_entity);
+			}
+
+			return new_entities;
+		}
+		// Moves all the Entities and their components out of p_other into this Storage, leaving p_other empty.
+		// p_other can be populated on another thread and merged in once complete, the merge itself does no per-Entity construction:
+		// Archetypes not present in this Storage are taken over wholesale along with their buffers.
+		// Archetypes present in both are reserved once and the instances moved across as a block (memcpy if all the components are trivially copyable).
+		//@return The offset applied to the EntityIDs of p_other. Entity(ID) in p_other is Entity(ID + offset) in this Storage.
+		EntityID merge(Storage&& p_other)
+		{
+			const EntityID entity_ID_offset = m_next_entity_ID;
+
+			// Maps every ArchetypeID in p_other to [ ArchetypeID in this Storage, ArchetypeInstanceID its first instance was moved to ].
+			std::vector<std::pair<ArchetypeID, ArchetypeInstanceID>> archetype_remap;
+			archetype_remap.reserve(p_other.m_archetypes.size());
+
+			for (auto& other_archetype : p_other.m_archetypes)
+			{
+				for (auto& entity : other_archetype.m_entities)
+					entity.ID += entity_ID_offset;
+
+				const auto archetype_ID = get_matching_archetype(other_archetype.m_bitset);
+				if (!archetype_ID)
+				{// No matching archetype, take ownership of other_archetype as-is.
+					m_archetypes.push_back(std::move(other_archetype));
+					archetype_remap.push_back({m_archetypes.size() - 1, 0});
+					continue;
+				}
+
+				auto& archetype = m_archetypes[archetype_ID.value()];
+				archetype_remap.push_back({archetype_ID.value(), archetype.m_next_instance_ID});
+
+				if (archetype.m_next_instance_ID == 0)
+				{// Nothing to preserve in archetype, swap in the other_archetype buffer.
+					archetype = std::move(other_archetype);
+					continue;
+				}
+
+				// Identical bitsets produce identical layouts so the instances can be moved without remapping component offsets.
+				ASSERT(archetype.m_instance_size == other_archetype.m_instance_size, "Matching archetypes have differing layouts.");
+
+				const auto required_capacity = archetype.m_next_instance_ID + other_archetype.m_next_instance_ID;
+				if (required_capacity > archetype.m_capacity)
+					archetype.reserve(next_greater_power_of_2(required_capacity));
+
+				auto* destination = &archetype.m_data[archetype.m_instance_size * archetype.m_next_instance_ID];
+				const bool trivially_copyable = std::all_of(archetype.m_components.begin(), archetype.m_components.end(), [](const auto& p_component) { return p_component.info.trivially_copyable; });
+
+				if (trivially_copyable)
+					std::memcpy(destination, other_archetype.m_data, other_archetype.m_instance_size * other_archetype.m_next_instance_ID);
+				else
+				{
+					for (size_t i = 0; i < other_archetype.m_next_instance_ID; i++)
+					{
+						const auto instance_start = other_archetype.m_instance_size * i;
+
+						for (auto& comp : other_archetype.m_components)
+						{
+							comp.info.funcs.MoveConstruct(&destination[instance_start + comp.offset], &other_archetype.m_data[instance_start + comp.offset]);
+							comp.info.funcs.Destruct(&other_archetype.m_data[instance_start + comp.offset]);
+						}
+					}
+				}
+
+				archetype.m_entities.insert(archetype.m_entities.end(), other_archetype.m_entities.begin(), other_archetype.m_entities.end());
+				archetype.m_next_instance_ID += other_archetype.m_next_instance_ID;
+				other_archetype.m_next_instance_ID = 0; // The components are now owned by archetype.
+			}
+
+			m_entity_to_archetype_ID.reserve(m_entity_to_archetype_ID.size() + p_other.m_entity_to_archetype_ID.size());
+			for (const auto& position : p_other.m_entity_to_archetype_ID)
+			{
+				if (position.has_value())
+				{
+					const auto& [archetype_ID, first_instance] = archetype_remap[position->first];
+					m_entity_to_archetype_ID.push_back(std::make_optional(std::make_pair(archetype_ID, first_instance + position->second)));
+				}
+				else
+					m_entity_to_archetype_ID.push_back(std::nullopt);
+			}
+			m_next_entity_ID += p_other.m_next_entity_ID;
+
+			p_other.m_archetypes.clear();
+			p_other.m_entity_to_archetype_ID.clear();
+			p_other.m_next_entity_ID = 0;
+
+			return entity_ID_offset;
+		}
 		// Removes p_entity from storage.
 		// The associated Entity is then on invalid for invoking other Storage funcrions on.
 		void delete_entity(const Entity& p_entity)
@@ -756,6 +1024,82 @@ namespace ECS
 			}
 		}
 
+		// As foreach but the Entities of each archetype are split into ranges that p_executor runs in parallel.
+		// p_executor must provide parallel_for(count, func(begin, end)) e.g. Utility::ThreadPool. p_function is called concurrently on
+		// different Entities so must only write to the components it is passed. Adding or removing Entities or components inside p_function is not allowed.
+		template <typename Func, typename Executor>
+		void foreach_parallel(const Func& p_function, Executor& p_executor)
+		{
+			using FunctionParameterPack = typename Meta::GetFunctionInformation<Func>::GetParameterPack;
+			static_assert(!FunctionHelper<FunctionParameterPack>::is_entity_function(), "foreach_parallel requires at least one ComponentType parameter.");
+
+			const auto function_bitset = FunctionHelper<FunctionParameterPack>::get_bitset();
+			for (auto& archetype_ID : get_matching_or_contained_archetypes(function_bitset))
+			{
+				auto& archetype = m_archetypes[archetype_ID];
+				p_executor.parallel_for(archetype.m_next_instance_ID, [&p_function, &archetype](const size_t& p_begin, const size_t& p_end)
+				{
+					ApplyFunction<Func, FunctionParameterPack>::apply_to_archetype_range(p_function, archetype, p_begin, p_end);
+				});
+			}
+		}
+
+		// One ComponentType of every instance of an Archetype, indexed by ArchetypeInstanceID. The components are m_stride bytes apart in m_data.
+		template <typename ComponentType>
+		class ComponentColumn
+		{
+			std::byte* m_data; // The ComponentType of instance 0.
+			size_t m_stride;   // The instance size of the Archetype.
+
+		public:
+			ComponentColumn(std::byte* p_data, const size_t& p_stride) noexcept
+				: m_data{p_data}
+				, m_stride{p_stride}
+			{}
+			ComponentType& operator[](const ArchetypeInstanceID& p_index) const { return *reinterpret_cast<ComponentType*>(&m_data[m_stride * p_index]); }
+		};
+		// The instances of one Archetype passed to foreach_archetype, visited in the order they are stored.
+		// Which ComponentTypes are owned and where they are in an instance is looked up once per Archetype instead of once per Entity.
+		class ArchetypeView
+		{
+			Archetype& m_archetype;
+
+		public:
+			explicit ArchetypeView(Archetype& p_archetype) noexcept
+				: m_archetype{p_archetype}
+			{}
+			[[nodiscard]] size_t size() const { return m_archetype.m_next_instance_ID; }
+			[[nodiscard]] const Entity& get_entity(const ArchetypeInstanceID& p_index) const { return m_archetype.m_entities[p_index]; }
+
+			// Does the Archetype own all of the ComponentTypes queried. (Can be called with a single ComponentType)
+			template <typename... ComponentTypes>
+			[[nodiscard]] bool has_components() const
+			{
+				const auto requested_bitset = ComponentHelper::get_component_bitset<ComponentTypes...>();
+				return (requested_bitset & m_archetype.m_bitset) == requested_bitset;
+			}
+			// Get the ComponentType of every instance. If the Archetype doesn't own one, an exception will be thrown.
+			template <typename ComponentType>
+			[[nodiscard]] ComponentColumn<std::decay_t<ComponentType>> get_components() const
+			{
+				return ComponentColumn<std::decay_t<ComponentType>>(&m_archetype.m_data[m_archetype.template get_component_offset<ComponentType>()], m_archetype.m_instance_size);
+			}
+		};
+
+		// Calls p_function with an ArchetypeView of every non-empty Archetype owning all of the ComponentTypes or more.
+		// Use over foreach when the work per Entity depends on which other ComponentTypes it owns, the check is made once per Archetype.
+		template <typename... ComponentTypes, typename Func>
+		void foreach_archetype(const Func& p_function)
+		{
+			static_assert(sizeof...(ComponentTypes) != 0, "Cannot call foreach_archetype with 0 types.");
+
+			for (auto& archetype_ID : get_matching_or_contained_archetypes(ComponentHelper::get_component_bitset<ComponentTypes...>()))
+			{
+				if (m_archetypes[archetype_ID].m_next_instance_ID > 0)
+					p_function(ArchetypeView(m_archetypes[archetype_ID]));
+			}
+		}
+
 		// Get a reference to component of ComponentType belonging to Entity.
 		// If Entity doesn't own one, an exception will be thrown. Owned ComponentTypes can be queried using has_components.
 		//@param p_entity The Entity to get the component from.
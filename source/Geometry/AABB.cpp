@@ -79,25 +79,30 @@ namespace Geometry
 			std::max(p_AABB.m_max.z, p_point.z)};
 	}
 	AABB AABB::transform(const AABB& p_AABB, const glm::vec3& p_position, const glm::mat4& p_rotation, const glm::vec3& p_scale)
+	{
+		auto model = glm::scale(p_rotation, p_scale);
+		model[3]   = glm::vec4(p_position, 1.f);
+		return transform(p_AABB, model);
+	}
+	AABB AABB::transform(const AABB& p_AABB, const glm::mat4& p_model)
 	{
 		// Reference: Real-Time Collision Detection (Christer Ericson)
 		// Each vertex of transformedAABB is a combination of three transformed min and max values from p_AABB.
 		// The minimum extent is the sum of all the smallers terms, the maximum extent is the sum of all the larger terms.
 		// Translation doesn't affect the size calculation of the new AABB so can be added in.
 		AABB transformedAABB;
-		const auto rotateScale = glm::scale(p_rotation, p_scale);
 
 		// For all 3 axes
 		for (int i = 0; i < 3; i++)
 		{
 			// Apply translation
-			transformedAABB.m_min[i] = transformedAABB.m_max[i] = p_position[i];
+			transformedAABB.m_min[i] = transformedAABB.m_max[i] = p_model[3][i];
 
 			// Form extent by summing smaller and larger terms respectively.
 			for (int j = 0; j < 3; j++)
 			{
-				const float e = rotateScale[j][i] * p_AABB.m_min[j];
-				const float f = rotateScale[j][i] * p_AABB.m_max[j];
+				const float e = p_model[j][i] * p_AABB.m_min[j];
+				const float f = p_model[j][i] * p_AABB.m_max[j];
 
 				if (e < f)
 				{
@@ -28,5 +28,7 @@ namespace Geometry
 		static AABB unite(const AABB& p_AABB, const glm::vec3& p_point);
 		// Returns an encompassing AABB after translating and transforming p_AABB.
 		static AABB transform(const AABB& p_AABB, const glm::vec3& p_position, const glm::mat4& p_rotation, const glm::vec3& p_scale);
+		// Returns an encompassing AABB after transforming p_AABB by p_model (Translate * Rotate * Scale) e.g. Component::Transform::m_model.
+		static AABB transform(const AABB& p_AABB, const glm::mat4& p_model);
 	};
 }// namespace Geometry
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include "AABBTree.hpp"
+
+#include <algorithm>
+
+namespace Geometry
+{
+	namespace
+	{
+		// Does p_outer fully enclose p_inner. AABB::contains is an overlap test.
+		bool encloses(const AABB& p_outer, const AABB& p_inner)
+		{
+			return
+				p_outer.m_min.x <= p_inner.m_min.x && p_outer.m_max.x >= p_inner.m_max.x &&
+				p_outer.m_min.y <= p_inner.m_min.y && p_outer.m_max.y >= p_inner.m_max.y &&
+				p_outer.m_min.z <= p_inner.m_min.z && p_outer.m_max.z >= p_inner.m_max.z;
+		}
+		AABB enlarge(const AABB& p_AABB, const float& p_margin)
+		{
+			return AABB(p_AABB.m_min - glm::vec3(p_margin), p_AABB.m_max + glm::vec3(p_margin));
+		}
+		float surface_area(const AABB& p_AABB)
+		{
+			const auto size = p_AABB.m_max - p_AABB.m_min;
+			return 2.f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+	}
+
+	AABBTree::AABBTree(float p_fat_margin) noexcept
+		: m_nodes{}
+		, m_ID_to_node{}
+		, m_fat_margin{p_fat_margin}
+	{}
+
+	bool AABBTree::set(const ProxyID& p_ID, const AABB& p_AABB)
+	{
+		if (p_ID >= m_ID_to_node.size())
+			m_ID_to_node.resize(p_ID + 1, Null_Node);
+
+		if (m_ID_to_node[p_ID] == Null_Node)
+		{
+			const auto leaf        = allocate_node();
+			m_nodes[leaf].m_AABB   = enlarge(p_AABB, m_fat_margin);
+			m_nodes[leaf].m_ID     = p_ID;
+			m_ID_to_node[p_ID]     = leaf;
+			insert_leaf(leaf);
+			m_leaf_count++;
+			return true;
+		}
+
+		const auto leaf = m_ID_to_node[p_ID];
+		m_nodes[leaf].m_set = true;
+
+		// Keep the leaf in place while the fat AABB still encloses p_AABB. Also reinsert when the fat AABB has become much larger
+		// than p_AABB (e.g. after a scale change) so the leaf does not keep an oversized bound forever.
+		if (encloses(m_nodes[leaf].m_AABB, p_AABB) && encloses(enlarge(p_AABB, m_fat_margin * 4.f), m_nodes[leaf].m_AABB))
+			return false;
+
+		remove_leaf(leaf);
+		m_nodes[leaf].m_AABB = enlarge(p_AABB, m_fat_margin);
+		insert_leaf(leaf);
+		return true;
+	}
+	void AABBTree::keep(const ProxyID& p_ID)
+	{
+		ASSERT(contains(p_ID), "ProxyID is not in the AABBTree");
+		m_nodes[m_ID_to_node[p_ID]].m_set = true;
+	}
+	void AABBTree::remove(const ProxyID& p_ID)
+	{
+		if (!contains(p_ID))
+			return;
+
+		const auto leaf = m_ID_to_node[p_ID];
+		remove_leaf(leaf);
+		free_node(leaf);
+		m_ID_to_node[p_ID] = Null_Node;
+		m_leaf_count--;
+	}
+	void AABBTree::remove_unset()
+	{
+		// Removing only frees nodes, m_nodes is not reallocated while iterating.
+		for (size_t i = 0; i < m_nodes.size(); i++)
+		{
+			if (m_nodes[i].m_height != 0)
+				continue;
+
+			if (m_nodes[i].m_set)
+				m_nodes[i].m_set = false;
+			else
+				remove(m_nodes[i].m_ID);
+		}
+	}
+	void AABBTree::clear()
+	{
+		m_nodes.clear();
+		m_ID_to_node.clear();
+		m_root       = Null_Node;
+		m_free_list  = Null_Node;
+		m_leaf_count = 0;
+	}
+
+	const AABB& AABBTree::get_fat_AABB(const ProxyID& p_ID) const
+	{
+		ASSERT(contains(p_ID), "ProxyID is not in the AABBTree");
+		return m_nodes[m_ID_to_node[p_ID]].m_AABB;
+	}
+	AABB AABBTree::get_bound() const
+	{
+		return m_root == Null_Node ? AABB() : m_nodes[m_root].m_AABB;
+	}
+	int AABBTree::get_height() const
+	{
+		return m_root == Null_Node ? 0 : m_nodes[m_root].m_height;
+	}
+
+	size_t AABBTree::allocate_node()
+	{
+		size_t node;
+		if (m_free_list == Null_Node)
+		{
+			node = m_nodes.size();
+			m_nodes.emplace_back();
+		}
+		else
+		{
+			node        = m_free_list;
+			m_free_list = m_nodes[node].m_parent;
+		}
+
+		m_nodes[node].m_parent = Null_Node;
+		m_nodes[node].m_left   = Null_Node;
+		m_nodes[node].m_right  = Null_Node;
+		m_nodes[node].m_height = 0;
+		m_nodes[node].m_ID     = 0;
+		m_nodes[node].m_set    = true;
+		return node;
+	}
+	void AABBTree::free_node(const size_t& p_node)
+	{
+		m_nodes[p_node].m_parent = m_free_list;
+		m_nodes[p_node].m_height = -1;
+		m_free_list              = p_node;
+	}
+
+	void AABBTree::insert_leaf(const size_t& p_leaf)
+	{
+		if (m_root == Null_Node)
+		{
+			m_root                   = p_leaf;
+			m_nodes[p_leaf].m_parent = Null_Node;
+			return;
+		}
+
+		// Descend the tree choosing the child with the lowest cost to find the best sibling for p_leaf.
+		// Cost is the surface area added to the tree, the probability of a query visiting a node is proportional to its surface area.
+		const AABB leaf_AABB = m_nodes[p_leaf].m_AABB;
+		size_t index = m_root;
+		while (!m_nodes[index].is_leaf())
+		{
+			const Node& node          = m_nodes[index];
+			const float area          = surface_area(node.m_AABB);
+			const float combined_area = surface_area(AABB::unite(node.m_AABB, leaf_AABB));
+
+			// Cost of creating a new parent for this node and p_leaf.
+			const float cost = 2.f * combined_area;
+			// Minimum cost of pushing p_leaf further down the tree, every ancestor grows by the same amount.
+			const float inheritance_cost = 2.f * (combined_area - area);
+
+			auto child_cost = [&](const size_t& p_child)
+			{
+				const Node& child  = m_nodes[p_child];
+				const float united = surface_area(AABB::unite(child.m_AABB, leaf_AABB));
+				return child.is_leaf() ? united + inheritance_cost : united - surface_area(child.m_AABB) + inheritance_cost;
+			};
+			const float cost_left  = child_cost(node.m_left);
+			const float cost_right = child_cost(node.m_right);
+
+			if (cost < cost_left && cost < cost_right)
+				break;
+
+			index = cost_left < cost_right ? node.m_left : node.m_right;
+		}
+
+		// Replace the sibling with a new parent of the sibling and p_leaf.
+		const size_t sibling    = index;
+		const size_t old_parent = m_nodes[sibling].m_parent;
+		const size_t new_parent = allocate_node();
+		m_nodes[new_parent].m_parent = old_parent;
+		m_nodes[new_parent].m_left   = sibling;
+		m_nodes[new_parent].m_right  = p_leaf;
+		m_nodes[new_parent].m_AABB   = AABB::unite(leaf_AABB, m_nodes[sibling].m_AABB);
+		m_nodes[new_parent].m_height = m_nodes[sibling].m_height + 1;
+		m_nodes[sibling].m_parent    = new_parent;
+		m_nodes[p_leaf].m_parent     = new_parent;
+
+		if (old_parent == Null_Node)
+			m_root = new_parent;
+		else if (m_nodes[old_parent].m_left == sibling)
+			m_nodes[old_parent].m_left = new_parent;
+		else
+			m_nodes[old_parent].m_right = new_parent;
+
+		refit_ancestors(m_nodes[p_leaf].m_parent);
+	}
+	void AABBTree::remove_leaf(const size_t& p_leaf)
+	{
+		if (p_leaf == m_root)
+		{
+			m_root = Null_Node;
+			return;
+		}
+
+		// Replace the parent of p_leaf with the sibling of p_leaf.
+		const size_t parent       = m_nodes[p_leaf].m_parent;
+		const size_t grand_parent = m_nodes[parent].m_parent;
+		const size_t sibling      = m_nodes[parent].m_left == p_leaf ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+
+		m_nodes[sibling].m_parent = grand_parent;
+		free_node(parent);
+
+		if (grand_parent == Null_Node)
+			m_root = sibling;
+		else
+		{
+			if (m_nodes[grand_parent].m_left == parent)
+				m_nodes[grand_parent].m_left = sibling;
+			else
+				m_nodes[grand_parent].m_right = sibling;
+
+			refit_ancestors(grand_parent);
+		}
+	}
+	void AABBTree::refit_ancestors(size_t p_node)
+	{
+		while (p_node != Null_Node)
+		{
+			p_node = balance(p_node);
+
+			Node& node    = m_nodes[p_node];
+			node.m_height = 1 + std::max(m_nodes[node.m_left].m_height, m_nodes[node.m_right].m_height);
+			node.m_AABB   = AABB::unite(m_nodes[node.m_left].m_AABB, m_nodes[node.m_right].m_AABB);
+			p_node        = node.m_parent;
+		}
+	}
+
+	size_t AABBTree::balance(const size_t& p_node)
+	{
+		// With A = p_node and children B and C, if one child is more than 1 taller than the other, rotate the taller child up to
+		// replace A. The taller grandchild stays under the rotated child and the shorter one moves under A.
+		// e.g. A(B, C(F, G)) with F taller becomes C(A(B, G), F).
+		const size_t A = p_node;
+		if (m_nodes[A].is_leaf() || m_nodes[A].m_height < 2)
+			return A;
+
+		auto rotate_up = [this](const size_t& p_parent, const size_t& p_child, const bool& p_child_is_right)
+		{
+			Node& parent = m_nodes[p_parent];
+			Node& child  = m_nodes[p_child];
+			const size_t other = p_child_is_right ? parent.m_left : parent.m_right;
+			const size_t F     = child.m_left;
+			const size_t G     = child.m_right;
+
+			// Swap p_child into the place of p_parent.
+			child.m_left   = p_parent;
+			child.m_parent = parent.m_parent;
+			parent.m_parent = p_child;
+
+			if (child.m_parent == Null_Node)
+				m_root = p_child;
+			else if (m_nodes[child.m_parent].m_left == p_parent)
+				m_nodes[child.m_parent].m_left = p_child;
+			else
+				m_nodes[child.m_parent].m_right = p_child;
+
+			const bool F_taller  = m_nodes[F].m_height > m_nodes[G].m_height;
+			const size_t taller  = F_taller ? F : G;
+			const size_t shorter = F_taller ? G : F;
+
+			child.m_right = taller;
+			if (p_child_is_right)
+				parent.m_right = shorter;
+			else
+				parent.m_left = shorter;
+			m_nodes[shorter].m_parent = p_parent;
+
+			parent.m_AABB   = AABB::unite(m_nodes[other].m_AABB, m_nodes[shorter].m_AABB);
+			parent.m_height = 1 + std::max(m_nodes[other].m_height, m_nodes[shorter].m_height);
+			child.m_AABB    = AABB::unite(parent.m_AABB, m_nodes[taller].m_AABB);
+			child.m_height  = 1 + std::max(parent.m_height, m_nodes[taller].m_height);
+		};
+
+		const size_t B   = m_nodes[A].m_left;
+		const size_t C   = m_nodes[A].m_right;
+		const int height_difference = m_nodes[C].m_height - m_nodes[B].m_height;
+
+		if (height_difference > 1)
+		{
+			rotate_up(A, C, true);
+			return C;
+		}
+		else if (height_difference < -1)
+		{
+			rotate_up(A, B, false);
+			return B;
+		}
+		else
+			return A;
+	}
+} // namespace Geometry
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Geometry/AABB.hpp"
+#include "Geometry/Frustrum.hpp"
+#include "Geometry/Intersect.hpp"
+#include "Geometry/Ray.hpp"
+
+#include "Utility/Logger.hpp"
+
+#include <array>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Geometry
+{
+	// A dynamic bounding volume hierarchy over a set of AABBs supporting overlap, ray and frustrum queries in O(log n).
+	// Leaves store a 'fat' AABB enlarged by a margin so small movements between ticks do not change the tree. A leaf is only
+	// reinserted when its AABB leaves the fat AABB. Insertion picks the sibling using the surface area heuristic and the tree is
+	// kept balanced with AVL rotations.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 6.5 Merging Bounding Volumes pg 267
+	// Reference: Box2D b2DynamicTree (Erin Catto)
+	class AABBTree
+	{
+	public:
+		using ProxyID = size_t; // User supplied identifier per AABB e.g. an ECS::EntityID. IDs index a lookup table so should be densely packed.
+
+		//@param p_fat_margin Distance the AABB of each leaf is enlarged by on every side.
+		AABBTree(float p_fat_margin = 0.1f) noexcept;
+
+		// Insert or update the AABB of p_ID.
+		//@return True if the tree changed, when p_ID was inserted or moved outside its fat AABB and was reinserted.
+		bool set(const ProxyID& p_ID, const AABB& p_AABB);
+		// Keep p_ID through the next remove_unset without changing its AABB, for proxies that haven't moved since they were last set.
+		void keep(const ProxyID& p_ID);
+		void remove(const ProxyID& p_ID);
+		// Remove every proxy not set since the previous call to remove_unset.
+		void remove_unset();
+		void clear();
+
+		[[nodiscard]] bool contains(const ProxyID& p_ID) const { return p_ID < m_ID_to_node.size() && m_ID_to_node[p_ID] != Null_Node; }
+		// The fat AABB stored for p_ID, encloses the last AABB set.
+		[[nodiscard]] const AABB& get_fat_AABB(const ProxyID& p_ID) const;
+		// The AABB enclosing every proxy in the tree (the root node). Includes the fat margin. Zero size AABB if empty.
+		[[nodiscard]] AABB get_bound() const;
+		[[nodiscard]] size_t size() const { return m_leaf_count; }
+		[[nodiscard]] int get_height() const;
+
+		// Call p_func(ProxyID) for every proxy whose fat AABB intersects p_shape. p_shape can be any type with an intersecting(AABB, Shape)
+		// overload e.g. AABB, Ray, RayPacket or Frustrum. Results are conservative, exact tests against the proxy's own shape are left to the caller.
+		// p_shape is tested at every node so p_func may shrink it (e.g. shorten the max distances of a RayPacket) to cull the rest of the query.
+		template <typename Shape, typename Func>
+		void query(const Shape& p_shape, Func&& p_func) const
+		{
+			if (m_root == Null_Node)
+				return;
+
+			std::array<size_t, Max_Stack_Size> stack;
+			size_t stack_size = 0;
+			stack[stack_size++] = m_root;
+
+			while (stack_size > 0)
+			{
+				const Node& node = m_nodes[stack[--stack_size]];
+				if (!intersecting(node.m_AABB, p_shape))
+					continue;
+
+				if (node.is_leaf())
+					p_func(node.m_ID);
+				else
+				{
+					ASSERT(stack_size + 2 <= Max_Stack_Size, "AABBTree query stack overflow, tree is too unbalanced.");
+					stack[stack_size++] = node.m_left;
+					stack[stack_size++] = node.m_right;
+				}
+			}
+		}
+
+		// Call p_func(ProxyID) for every proxy whose fat AABB is within p_max_distance_squared of p_point, visiting the nearer child of each
+		// branch first. p_func returns the new max distance squared so a k nearest search can shrink it to its current kth nearest and cull the
+		// rest of the tree, returning p_max_distance_squared unchanged visits every proxy in range. As with query, exact tests are left to the caller.
+		template <typename Func>
+		void query_nearest(const glm::vec3& p_point, float p_max_distance_squared, Func&& p_func) const
+		{
+			if (m_root == Null_Node)
+				return;
+
+			// Nodes are stacked with their distance so a node pushed before the max distance shrank can be culled without retesting its AABB.
+			std::array<std::pair<size_t, float>, Max_Stack_Size> stack;
+			size_t stack_size = 0;
+			stack[stack_size++] = {m_root, distance_squared(m_nodes[m_root].m_AABB, p_point)};
+
+			while (stack_size > 0)
+			{
+				const auto [node_index, node_distance_squared] = stack[--stack_size];
+				if (node_distance_squared > p_max_distance_squared)
+					continue;
+
+				const Node& node = m_nodes[node_index];
+				if (node.is_leaf())
+					p_max_distance_squared = p_func(node.m_ID);
+				else
+				{
+					ASSERT(stack_size + 2 <= Max_Stack_Size, "AABBTree query stack overflow, tree is too unbalanced.");
+					const float left_distance_squared  = distance_squared(m_nodes[node.m_left].m_AABB, p_point);
+					const float right_distance_squared = distance_squared(m_nodes[node.m_right].m_AABB, p_point);
+					// The nearer child is pushed last to be popped first.
+					if (left_distance_squared < right_distance_squared)
+					{
+						stack[stack_size++] = {node.m_right, right_distance_squared};
+						stack[stack_size++] = {node.m_left, left_distance_squared};
+					}
+					else
+					{
+						stack[stack_size++] = {node.m_left, left_distance_squared};
+						stack[stack_size++] = {node.m_right, right_distance_squared};
+					}
+				}
+			}
+		}
+
+	private:
+		static constexpr size_t Null_Node      = std::numeric_limits<size_t>::max();
+		static constexpr size_t Max_Stack_Size = 128; // A balanced tree traversal needs at most height + 1 stack entries.
+
+		struct Node
+		{
+			AABB m_AABB;     // Fat AABB for leaves, union of the children for branches.
+			size_t m_parent; // Parent node or the next free node when in the free list.
+			size_t m_left;
+			size_t m_right;
+			int m_height;    // 0 for leaves, -1 for free nodes.
+			ProxyID m_ID;    // Leaves only.
+			bool m_set;      // Leaves only. Has this leaf been set since the last remove_unset.
+
+			bool is_leaf() const { return m_left == Null_Node; }
+		};
+
+		size_t allocate_node();
+		void free_node(const size_t& p_node);
+		void insert_leaf(const size_t& p_leaf);
+		void remove_leaf(const size_t& p_leaf);
+		// Rotate p_node up if its children heights differ by more than 1. Returns the index of the new root of the subtree.
+		size_t balance(const size_t& p_node);
+		// Walk from p_node to the root recomputing the heights and AABBs and rebalancing.
+		void refit_ancestors(size_t p_node);
+
+		std::vector<Node> m_nodes;
+		std::vector<size_t> m_ID_to_node; // Leaf node of each ProxyID or Null_Node.
+		size_t m_root       = Null_Node;
+		size_t m_free_list  = Null_Node;
+		size_t m_leaf_count = 0;
+		float m_fat_margin;
+	};
+} // namespace Geometry
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Geometry
+{
+	// Which broadphase proxies can pair, tested before their AABBs so filtered out pairs cost no overlap tests.
+	// Each proxy belongs to the layers set in m_layer and collides with the layers set in m_mask, a pair needs each proxy's layer in the
+	// other's mask. Proxies that never move in response to a contact (static and kinematic bodies) never pair with each other.
+	struct CollisionFilter
+	{
+		static constexpr uint32_t Default_Layer = 1u;
+		static constexpr uint32_t All_Layers    = ~0u;
+
+		uint32_t m_layer = Default_Layer;
+		uint32_t m_mask  = All_Layers;
+		bool m_static    = false; // The proxy doesn't respond to contacts.
+	};
+
+	// Can p_filter_1 and p_filter_2 pair.
+	constexpr bool can_collide(const CollisionFilter& p_filter_1, const CollisionFilter& p_filter_2)
+	{
+		return (p_filter_1.m_layer & p_filter_2.m_mask) != 0
+		    && (p_filter_2.m_layer & p_filter_1.m_mask) != 0
+		    && !(p_filter_1.m_static && p_filter_2.m_static);
+	}
+} // namespace Geometry
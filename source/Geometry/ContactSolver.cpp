@@ -0,0 +1,179 @@
+#include "ContactSolver.hpp"
+
+#include "glm/glm.hpp"
+
+#include <algorithm>
+
+namespace Geometry
+{
+	namespace
+	{
+		constexpr float Warm_Start_Distance = 0.05f; // Points of the same pair closer than this between solves are the same contact (m).
+
+		// Apply p_impulse to p_body_1 at p_r_1 and the opposite impulse to p_body_2 at p_r_2.
+		void apply_impulse(SolverBody& p_body_1, SolverBody& p_body_2, const glm::vec3& p_r_1, const glm::vec3& p_r_2, const glm::vec3& p_impulse)
+		{
+			p_body_1.m_velocity         += p_impulse * p_body_1.m_inverse_mass;
+			p_body_1.m_angular_velocity += p_body_1.m_inverse_inertia_tensor * glm::cross(p_r_1, p_impulse);
+			p_body_2.m_velocity         -= p_impulse * p_body_2.m_inverse_mass;
+			p_body_2.m_angular_velocity -= p_body_2.m_inverse_inertia_tensor * glm::cross(p_r_2, p_impulse);
+		}
+		// Velocity of the contact point on p_body_1 relative to the point on p_body_2.
+		glm::vec3 relative_velocity(const SolverBody& p_body_1, const SolverBody& p_body_2, const glm::vec3& p_r_1, const glm::vec3& p_r_2)
+		{
+			return (p_body_1.m_velocity + glm::cross(p_body_1.m_angular_velocity, p_r_1)) - (p_body_2.m_velocity + glm::cross(p_body_2.m_angular_velocity, p_r_2));
+		}
+		// Inverse of the mass the contact point presents to an impulse along p_direction.
+		float inverse_effective_mass(const SolverBody& p_body_1, const SolverBody& p_body_2, const glm::vec3& p_r_1, const glm::vec3& p_r_2, const glm::vec3& p_direction)
+		{
+			const float k = p_body_1.m_inverse_mass + p_body_2.m_inverse_mass
+				+ glm::dot(glm::cross(p_body_1.m_inverse_inertia_tensor * glm::cross(p_r_1, p_direction), p_r_1), p_direction)
+				+ glm::dot(glm::cross(p_body_2.m_inverse_inertia_tensor * glm::cross(p_r_2, p_direction), p_r_2), p_direction);
+			return k > 0.f ? 1.f / k : 0.f;
+		}
+	} // namespace
+
+	ContactSolver::ContactSolver() noexcept
+		: m_iterations{8}
+		, m_restitution{0.2f}
+		, m_friction{0.5f}
+		, m_baumgarte{0.2f}
+		, m_slop{0.01f}
+		, m_restitution_threshold{1.f}
+		, m_warm_starting{true}
+		, m_constraints{}
+		, m_cache{}
+		, m_next_cache{}
+	{}
+
+	void ContactSolver::add_contact(const uint64_t& p_key, const size_t& p_body_1, const size_t& p_body_2, const ContactManifold& p_manifold)
+	{
+		for (const auto& contact_point : p_manifold)
+		{
+			// Tangents from a fixed axis so the friction impulses of a resting contact point the same way between solves.
+			const auto& normal = contact_point.normal;
+			const auto axis    = std::abs(normal.x) < 0.57f ? glm::vec3(1.f, 0.f, 0.f) : std::abs(normal.y) < 0.57f ? glm::vec3(0.f, 1.f, 0.f) : glm::vec3(0.f, 0.f, 1.f);
+			const auto tangent = glm::normalize(glm::cross(normal, axis));
+
+			Constraint constraint;
+			constraint.m_key               = p_key;
+			constraint.m_body_1            = p_body_1;
+			constraint.m_body_2            = p_body_2;
+			constraint.m_position          = contact_point.position;
+			constraint.m_normal            = normal;
+			constraint.m_tangents          = {tangent, glm::cross(normal, tangent)};
+			constraint.m_penetration_depth = contact_point.penetration_depth;
+			m_constraints.push_back(constraint);
+		}
+	}
+
+	void ContactSolver::clear_cache()
+	{
+		m_cache.clear();
+		m_next_cache.clear();
+	}
+
+	void ContactSolver::prepare(std::vector<SolverBody>& p_bodies, const float& p_delta_time)
+	{
+		for (auto& constraint : m_constraints)
+		{
+			auto& body_1 = p_bodies[constraint.m_body_1];
+			auto& body_2 = p_bodies[constraint.m_body_2];
+			constraint.m_r_1 = constraint.m_position - body_1.m_position;
+			constraint.m_r_2 = constraint.m_position - body_2.m_position;
+
+			constraint.m_normal_mass = inverse_effective_mass(body_1, body_2, constraint.m_r_1, constraint.m_r_2, constraint.m_normal);
+			for (size_t i = 0; i < 2; i++)
+				constraint.m_tangent_mass[i] = inverse_effective_mass(body_1, body_2, constraint.m_r_1, constraint.m_r_2, constraint.m_tangents[i]);
+
+			// Separated (speculative) points let the bodies approach just enough to close the gap this step.
+			// Touching points push apart to remove the penetration beyond the slop over 1/m_baumgarte steps, fast approaching ones bounce.
+			if (constraint.m_penetration_depth < 0.f)
+				constraint.m_target_velocity = constraint.m_penetration_depth / p_delta_time;
+			else
+			{
+				const float normal_velocity  = glm::dot(relative_velocity(body_1, body_2, constraint.m_r_1, constraint.m_r_2), constraint.m_normal);
+				constraint.m_target_velocity = m_baumgarte / p_delta_time * std::max(constraint.m_penetration_depth - m_slop, 0.f);
+				if (normal_velocity < -m_restitution_threshold)
+					constraint.m_target_velocity = std::max(constraint.m_target_velocity, -m_restitution * normal_velocity);
+			}
+
+			constraint.m_normal_impulse  = 0.f;
+			constraint.m_tangent_impulse = {0.f, 0.f};
+		}
+
+		// Warm start once every target velocity is set, applying an impulse changes the approach velocity of the other contacts of its bodies.
+		if (!m_warm_starting)
+			return;
+
+		for (auto& constraint : m_constraints)
+		{
+			auto& body_1 = p_bodies[constraint.m_body_1];
+			auto& body_2 = p_bodies[constraint.m_body_2];
+
+			const auto cached = m_cache.find(constraint.m_key);
+			if (cached == m_cache.end())
+				continue;
+
+			const CachedPoint* closest = nullptr;
+			float closest_distance     = Warm_Start_Distance;
+			for (size_t i = 0; i < cached->second.m_count; i++)
+			{
+				const float distance = glm::length(cached->second.m_points[i].m_position - constraint.m_position);
+				if (distance < closest_distance)
+				{
+					closest          = &cached->second.m_points[i];
+					closest_distance = distance;
+				}
+			}
+			if (closest)
+			{
+				constraint.m_normal_impulse  = closest->m_normal_impulse;
+				constraint.m_tangent_impulse = closest->m_tangent_impulse;
+				apply_impulse(body_1, body_2, constraint.m_r_1, constraint.m_r_2, constraint.m_normal * constraint.m_normal_impulse
+					+ constraint.m_tangents[0] * constraint.m_tangent_impulse[0] + constraint.m_tangents[1] * constraint.m_tangent_impulse[1]);
+			}
+		}
+	}
+
+	void ContactSolver::solve(std::vector<SolverBody>& p_bodies, const float& p_delta_time)
+	{
+		prepare(p_bodies, p_delta_time);
+
+		for (size_t iteration = 0; iteration < m_iterations; iteration++)
+		{
+			for (auto& constraint : m_constraints)
+			{
+				auto& body_1 = p_bodies[constraint.m_body_1];
+				auto& body_2 = p_bodies[constraint.m_body_2];
+
+				// Friction first, limited by the normal impulse of the last iteration.
+				const float max_friction = m_friction * constraint.m_normal_impulse;
+				for (size_t i = 0; i < 2; i++)
+				{
+					const float tangent_velocity = glm::dot(relative_velocity(body_1, body_2, constraint.m_r_1, constraint.m_r_2), constraint.m_tangents[i]);
+					const float previous         = constraint.m_tangent_impulse[i];
+					constraint.m_tangent_impulse[i] = std::clamp(previous - tangent_velocity * constraint.m_tangent_mass[i], -max_friction, max_friction);
+					apply_impulse(body_1, body_2, constraint.m_r_1, constraint.m_r_2, constraint.m_tangents[i] * (constraint.m_tangent_impulse[i] - previous));
+				}
+
+				// The accumulated normal impulse can only push the bodies apart.
+				const float normal_velocity = glm::dot(relative_velocity(body_1, body_2, constraint.m_r_1, constraint.m_r_2), constraint.m_normal);
+				const float previous        = constraint.m_normal_impulse;
+				constraint.m_normal_impulse = std::max(previous + (constraint.m_target_velocity - normal_velocity) * constraint.m_normal_mass, 0.f);
+				apply_impulse(body_1, body_2, constraint.m_r_1, constraint.m_r_2, constraint.m_normal * (constraint.m_normal_impulse - previous));
+			}
+		}
+
+		// Keep the accumulated impulses for warm starting the next solve. Pairs no longer in contact are dropped.
+		m_next_cache.clear();
+		for (const auto& constraint : m_constraints)
+		{
+			auto& cached = m_next_cache[constraint.m_key];
+			if (cached.m_count < ContactManifold::Max_Points)
+				cached.m_points[cached.m_count++] = {constraint.m_position, constraint.m_normal_impulse, constraint.m_tangent_impulse};
+		}
+		std::swap(m_cache, m_next_cache);
+		m_constraints.clear();
+	}
+} // namespace Geometry
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Geometry/GJK.hpp"
+
+#include "glm/mat3x3.hpp"
+#include "glm/vec3.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Geometry
+{
+	// The velocity state of a rigid body solved by ContactSolver. A body with 0 inverse mass and inverse inertia is immovable.
+	struct SolverBody
+	{
+		glm::vec3 m_position;               // Center of mass in world space.
+		glm::vec3 m_velocity;               // v
+		glm::vec3 m_angular_velocity;       // ω
+		glm::mat3 m_inverse_inertia_tensor; // World-space J⁻¹, R J⁻¹ Rᵀ for a body rotated by R.
+		float m_inverse_mass;               // 1 / m
+	};
+
+	// Sequential impulse contact solver.
+	// Every contact point is a non-penetration constraint with two friction constraints. Each iteration applies the impulse correcting
+	// the relative velocity at one point at a time over all the points, clamping the accumulated impulse per point rather than the
+	// impulse per iteration. Accumulated impulses are kept between solves so the next solve of the same contact starts from them.
+	// Contacts stable across steps (resting stacks) converge in a few iterations.
+	class ContactSolver
+	{
+	public:
+		ContactSolver() noexcept;
+
+		size_t m_iterations;           // Velocity iterations per solve.
+		float m_restitution;           // Coefficient of restitution.
+		float m_friction;              // Coulomb friction coefficient.
+		float m_baumgarte;             // Fraction of the penetration beyond m_slop corrected per step.
+		float m_slop;                  // Penetration depth left uncorrected so resting contacts stay in contact (m).
+		float m_restitution_threshold; // Contacts approaching slower than this don't bounce (m/s).
+		bool m_warm_starting;          // Start each solve from the impulses of the matching contacts in the previous solve.
+
+		// Add the contact points of p_manifold between p_bodies[p_body_1] and p_bodies[p_body_2] to the next solve.
+		// p_manifold is from the perspective of p_body_1. p_key identifies the pair between solves for warm starting.
+		void add_contact(const uint64_t& p_key, const size_t& p_body_1, const size_t& p_body_2, const ContactManifold& p_manifold);
+		// Solve the velocities of p_bodies for the contacts added since the last solve.
+		void solve(std::vector<SolverBody>& p_bodies, const float& p_delta_time);
+		// Forget the impulses kept for warm starting, the next solve starts cold.
+		void clear_cache();
+
+	private:
+		struct Constraint
+		{
+			uint64_t m_key;
+			size_t m_body_1;
+			size_t m_body_2;
+			glm::vec3 m_position;
+			glm::vec3 m_r_1; // Contact point relative to the center of mass of body 1.
+			glm::vec3 m_r_2;
+			glm::vec3 m_normal;
+			std::array<glm::vec3, 2> m_tangents;
+			float m_penetration_depth;
+			float m_normal_mass; // Inverse effective mass along the normal.
+			std::array<float, 2> m_tangent_mass;
+			float m_target_velocity; // Separating velocity along the normal the solve aims for from restitution and penetration correction.
+			float m_normal_impulse;  // Accumulated impulses
+			std::array<float, 2> m_tangent_impulse;
+		};
+		struct CachedPoint
+		{
+			glm::vec3 m_position;
+			float m_normal_impulse;
+			std::array<float, 2> m_tangent_impulse;
+		};
+		struct CachedManifold
+		{
+			std::array<CachedPoint, ContactManifold::Max_Points> m_points;
+			size_t m_count = 0;
+		};
+
+		std::vector<Constraint> m_constraints;
+		std::unordered_map<uint64_t, CachedManifold> m_cache;      // Accumulated impulses of the last solve per pair.
+		std::unordered_map<uint64_t, CachedManifold> m_next_cache; // Built by solve then swapped with m_cache.
+
+		void prepare(std::vector<SolverBody>& p_bodies, const float& p_delta_time);
+	};
+} // namespace Geometry
@@ -9,9 +9,8 @@ namespace Geometry
 		, m_right{ glm::vec4{p_projection[0][3] - p_projection[0][0], p_projection[1][3] - p_projection[1][0], p_projection[2][3] - p_projection[2][0], p_projection[3][3] - p_projection[3][0]}}
 		, m_bottom{glm::vec4{p_projection[0][3] + p_projection[0][1], p_projection[1][3] + p_projection[1][1], p_projection[2][3] + p_projection[2][1], p_projection[3][3] + p_projection[3][1]}}
 		, m_top{   glm::vec4{p_projection[0][3] - p_projection[0][1], p_projection[1][3] - p_projection[1][1], p_projection[2][3] - p_projection[2][1], p_projection[3][3] - p_projection[3][1]}}
-		// Inverting near and far normal to maintain the conventon of Frustrum that all plane normals point inside the space.
-		, m_near{  glm::vec4{-(p_projection[0][3] + p_projection[0][2]), -(p_projection[1][3] + p_projection[1][2]), -(p_projection[2][3] + p_projection[2][2]), -(p_projection[3][3] + p_projection[3][2])}}
-		, m_far{   glm::vec4{-(p_projection[0][3] - p_projection[0][2]), -(p_projection[1][3] - p_projection[1][2]), -(p_projection[2][3] - p_projection[2][2]), -(p_projection[3][3] - p_projection[3][2])}}
+		, m_near{  glm::vec4{p_projection[0][3] + p_projection[0][2], p_projection[1][3] + p_projection[1][2], p_projection[2][3] + p_projection[2][2], p_projection[3][3] + p_projection[3][2]}}
+		, m_far{   glm::vec4{p_projection[0][3] - p_projection[0][2], p_projection[1][3] - p_projection[1][2], p_projection[2][3] - p_projection[2][2], p_projection[3][3] - p_projection[3][2]}}
 	{
 		m_left.normalise();
 		m_right.normalise();
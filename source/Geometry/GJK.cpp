@@ -0,0 +1,862 @@
+#include "GJK.hpp"
+
+#include "glm/glm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Geometry
+{
+	namespace
+	{
+		constexpr size_t Max_GJK_Iterations = 64;
+		constexpr size_t Max_EPA_Iterations = 64;
+		constexpr float EPA_Tolerance       = 1e-4f;  // EPA stops when a new support point is less than this further out than the closest face.
+		constexpr float Degenerate_Length   = 1e-6f;  // Lengths (and areas, volumes) below this are treated as 0.
+		constexpr float Feature_Tolerance   = 0.02f;  // Vertices within this fraction of the shape's extent along a direction belong to its support feature.
+		constexpr float Parallel_Tolerance  = 0.999f; // Cosine of the angle under which directions are treated as parallel.
+		constexpr float Face_Tolerance      = 0.95f;  // Cosine of the angle under which a face is treated as facing the contact normal.
+		constexpr float Contact_Margin      = 0.02f;  // Clipped points separated by less than this are kept as speculative contacts (m).
+		constexpr size_t Bisect_Iterations  = 20;     // Halvings of a sweep, time_of_impact is within 2^-20 of the motion.
+
+		// A fixed capacity list of points. Holds a feature polygon (in winding order) or the output of clipping one.
+		struct Polygon
+		{
+			std::array<glm::vec3, 16> m_points = {};
+			size_t m_count = 0;
+
+			void push(const glm::vec3& p_point)
+			{
+				if (m_count < m_points.size())
+					m_points[m_count++] = p_point;
+			}
+		};
+
+		glm::vec3 farthest_point(const Cone& p_cone, const glm::vec3& p_direction)
+		{
+			const auto axis          = glm::normalize(p_cone.m_top - p_cone.m_base);
+			const auto perpendicular = p_direction - axis * glm::dot(p_direction, axis);
+			const auto length        = glm::length(perpendicular);
+			const auto rim           = length > Degenerate_Length ? p_cone.m_base + perpendicular * (p_cone.m_base_radius / length) : p_cone.m_base;
+			return glm::dot(p_cone.m_top, p_direction) > glm::dot(rim, p_direction) ? p_cone.m_top : rim;
+		}
+		glm::vec3 farthest_point(const Cuboid& p_cuboid, const glm::vec3& p_direction)
+		{
+			const auto local = glm::conjugate(p_cuboid.m_rotation) * p_direction;
+			const auto half  = p_cuboid.m_scale * 0.5f;
+			return p_cuboid.m_position + p_cuboid.m_rotation * glm::vec3(local.x >= 0.f ? half.x : -half.x, local.y >= 0.f ? half.y : -half.y, local.z >= 0.f ? half.z : -half.z);
+		}
+		glm::vec3 farthest_point(const Cylinder& p_cylinder, const glm::vec3& p_direction)
+		{
+			const auto axis          = p_cylinder.m_top - p_cylinder.m_base;
+			const auto axis_n        = glm::normalize(axis);
+			const auto perpendicular = p_direction - axis_n * glm::dot(p_direction, axis_n);
+			const auto length        = glm::length(perpendicular);
+			const auto end           = glm::dot(axis, p_direction) >= 0.f ? p_cylinder.m_top : p_cylinder.m_base;
+			return length > Degenerate_Length ? end + perpendicular * (p_cylinder.m_radius / length) : end;
+		}
+		glm::vec3 farthest_point(const LineSegment& p_line_segment, const glm::vec3& p_direction)
+		{
+			return glm::dot(p_line_segment.m_start, p_direction) >= glm::dot(p_line_segment.m_end, p_direction) ? p_line_segment.m_start : p_line_segment.m_end;
+		}
+		glm::vec3 farthest_point(const Quad& p_quad, const glm::vec3& p_direction)
+		{
+			auto farthest = p_quad.m_point_1;
+			for (const auto& point : {p_quad.m_point_2, p_quad.m_point_3, p_quad.m_point_4})
+				if (glm::dot(point, p_direction) > glm::dot(farthest, p_direction))
+					farthest = point;
+			return farthest;
+		}
+		glm::vec3 farthest_point(const Sphere& p_sphere, const glm::vec3& p_direction)
+		{
+			const auto length = glm::length(p_direction);
+			return length > 0.f ? p_sphere.m_center + p_direction * (p_sphere.m_radius / length) : p_sphere.m_center;
+		}
+		glm::vec3 farthest_point(const Triangle& p_triangle, const glm::vec3& p_direction)
+		{
+			auto farthest = p_triangle.m_point_1;
+			for (const auto& point : {p_triangle.m_point_2, p_triangle.m_point_3})
+				if (glm::dot(point, p_direction) > glm::dot(farthest, p_direction))
+					farthest = point;
+			return farthest;
+		}
+
+		// The vertices of the polyhedral shapes. Curved shapes return no vertices.
+		Polygon get_vertices(const Shape& p_shape)
+		{
+			Polygon vertices;
+			if (p_shape.is<Cuboid>())
+			{
+				const auto& cuboid = p_shape.get<Cuboid>();
+				const auto half    = cuboid.m_scale * 0.5f;
+				for (int i = 0; i < 8; i++)
+					vertices.push(cuboid.m_position + cuboid.m_rotation * glm::vec3(i & 1 ? half.x : -half.x, i & 2 ? half.y : -half.y, i & 4 ? half.z : -half.z));
+			}
+			else if (p_shape.is<LineSegment>())
+			{
+				vertices.push(p_shape.get<LineSegment>().m_start);
+				vertices.push(p_shape.get<LineSegment>().m_end);
+			}
+			else if (p_shape.is<Quad>())
+			{
+				const auto& quad = p_shape.get<Quad>();
+				for (const auto& point : {quad.m_point_1, quad.m_point_2, quad.m_point_3, quad.m_point_4})
+					vertices.push(point);
+			}
+			else if (p_shape.is<Triangle>())
+			{
+				const auto& triangle = p_shape.get<Triangle>();
+				for (const auto& point : {triangle.m_point_1, triangle.m_point_2, triangle.m_point_3})
+					vertices.push(point);
+			}
+			return vertices;
+		}
+
+		// Sort the points of a planar convex p_polygon into winding order around p_normal.
+		void order_polygon(Polygon& p_polygon, const glm::vec3& p_normal)
+		{
+			if (p_polygon.m_count < 3)
+				return;
+
+			auto centroid = glm::vec3(0.f);
+			for (size_t i = 0; i < p_polygon.m_count; i++)
+				centroid += p_polygon.m_points[i];
+			centroid /= static_cast<float>(p_polygon.m_count);
+
+			const auto u = p_polygon.m_points[0] - centroid;
+			const auto v = glm::cross(p_normal, u);
+			std::sort(p_polygon.m_points.begin(), p_polygon.m_points.begin() + p_polygon.m_count, [&](const glm::vec3& p_a, const glm::vec3& p_b)
+			{
+				return std::atan2(glm::dot(p_a - centroid, v), glm::dot(p_a - centroid, u)) < std::atan2(glm::dot(p_b - centroid, v), glm::dot(p_b - centroid, u));
+			});
+		}
+
+		// The world space feature of p_shape farthest along p_direction: a face polygon, an edge (2 points) or a single point.
+		Polygon get_feature(const ConvexShape& p_shape, const glm::vec3& p_direction)
+		{
+			Polygon feature;
+			if (p_shape.m_shape.is<Cuboid>())
+			{
+				// A Cuboid always presents the face most aligned with p_direction. Clipping against it leaves only the penetrating edge or vertex.
+				const auto& cuboid = p_shape.m_shape.get<Cuboid>();
+				const auto half    = cuboid.m_scale * 0.5f;
+				const auto center  = p_shape.m_linear * cuboid.m_position + p_shape.m_translation;
+				auto to_world      = [&](const glm::vec3& p_local) { return p_shape.m_linear * (cuboid.m_position + cuboid.m_rotation * p_local) + p_shape.m_translation; };
+
+				float best_alignment = -std::numeric_limits<float>::max();
+				for (int axis = 0; axis < 3; axis++)
+				{
+					for (const float side : {-1.f, 1.f})
+					{
+						const int u = (axis + 1) % 3;
+						const int v = (axis + 2) % 3;
+						Polygon face;
+						for (const auto& [sign_u, sign_v] : {std::make_pair(-1.f, -1.f), std::make_pair(1.f, -1.f), std::make_pair(1.f, 1.f), std::make_pair(-1.f, 1.f)})
+						{
+							glm::vec3 local;
+							local[axis] = side * half[axis];
+							local[u]    = sign_u * half[u];
+							local[v]    = sign_v * half[v];
+							face.push(to_world(local));
+						}
+
+						auto normal = glm::cross(face.m_points[1] - face.m_points[0], face.m_points[3] - face.m_points[0]);
+						const auto length = glm::length(normal);
+						if (length < Degenerate_Length)
+							continue;
+						normal /= length;
+						if (glm::dot(normal, (face.m_points[0] + face.m_points[2]) * 0.5f - center) < 0.f)
+							normal = -normal;
+
+						if (const float alignment = glm::dot(normal, p_direction); alignment > best_alignment)
+						{
+							best_alignment = alignment;
+							feature        = face;
+						}
+					}
+				}
+				if (feature.m_count > 0)
+				{
+					order_polygon(feature, p_direction);
+					return feature;
+				}
+			}
+
+			const auto vertices = get_vertices(p_shape.m_shape);
+			if (vertices.m_count > 0)
+			{
+				std::array<glm::vec3, 16> world = {};
+				float max = -std::numeric_limits<float>::max();
+				float min = std::numeric_limits<float>::max();
+				for (size_t i = 0; i < vertices.m_count; i++)
+				{
+					world[i] = p_shape.m_linear * vertices.m_points[i] + p_shape.m_translation;
+					max = std::max(max, glm::dot(world[i], p_direction));
+					min = std::min(min, glm::dot(world[i], p_direction));
+				}
+
+				const float threshold = max - (max - min) * Feature_Tolerance - Degenerate_Length * (1.f + std::abs(max));
+				for (size_t i = 0; i < vertices.m_count && feature.m_count < 4; i++)
+					if (glm::dot(world[i], p_direction) >= threshold)
+						feature.push(world[i]);
+
+				order_polygon(feature, p_direction);
+				return feature;
+			}
+
+			// Cylinder caps and sides and Cone bases are flat features, every other direction touches a curved surface at a single point.
+			// The caps are approximated by 4 points on their rim.
+			const auto local_direction = glm::normalize(glm::transpose(p_shape.m_linear) * p_direction);
+			auto push_cap = [&feature](const glm::vec3& p_center, const glm::vec3& p_axis, const float& p_radius)
+			{
+				const auto u = glm::normalize(glm::cross(p_axis, std::abs(p_axis.x) < 0.9f ? glm::vec3(1.f, 0.f, 0.f) : glm::vec3(0.f, 1.f, 0.f))) * p_radius;
+				const auto v = glm::normalize(glm::cross(p_axis, u)) * p_radius;
+				feature.push(p_center + u);
+				feature.push(p_center + v);
+				feature.push(p_center - u);
+				feature.push(p_center - v);
+			};
+
+			if (p_shape.m_shape.is<Cylinder>())
+			{
+				const auto& cylinder = p_shape.m_shape.get<Cylinder>();
+				const auto axis      = glm::normalize(cylinder.m_top - cylinder.m_base);
+				const auto cosine    = glm::dot(local_direction, axis);
+				if (std::abs(cosine) > Parallel_Tolerance)
+					push_cap(cosine > 0.f ? cylinder.m_top : cylinder.m_base, axis, cylinder.m_radius);
+				else if (std::abs(cosine) < std::sqrt(1.f - Parallel_Tolerance * Parallel_Tolerance))
+				{
+					const auto rim = glm::normalize(local_direction - axis * cosine) * cylinder.m_radius;
+					feature.push(cylinder.m_base + rim);
+					feature.push(cylinder.m_top + rim);
+				}
+			}
+			else if (p_shape.m_shape.is<Cone>())
+			{
+				const auto& cone = p_shape.m_shape.get<Cone>();
+				const auto axis  = glm::normalize(cone.m_base - cone.m_top);
+				if (glm::dot(local_direction, axis) > Parallel_Tolerance)
+					push_cap(cone.m_base, axis, cone.m_base_radius);
+			}
+
+			if (feature.m_count == 0)
+				feature.push(support(p_shape.m_shape, local_direction));
+			for (size_t i = 0; i < feature.m_count; i++)
+				feature.m_points[i] = p_shape.m_linear * feature.m_points[i] + p_shape.m_translation;
+			order_polygon(feature, p_direction);
+			return feature;
+		}
+
+		// The outward normal of a face p_feature facing p_direction or nullopt if p_feature is an edge or vertex.
+		std::optional<glm::vec3> get_face_normal(const Polygon& p_feature, const glm::vec3& p_direction)
+		{
+			if (p_feature.m_count < 3)
+				return std::nullopt;
+
+			const auto normal = glm::cross(p_feature.m_points[1] - p_feature.m_points[0], p_feature.m_points[2] - p_feature.m_points[0]);
+			const auto length = glm::length(normal);
+			if (length < Degenerate_Length)
+				return std::nullopt;
+			return normal / length * (glm::dot(normal, p_direction) >= 0.f ? 1.f : -1.f);
+		}
+
+		// Clip p_polygon to the half space dot(p_normal, x) <= p_offset. Polygons of 2 points are clipped as a segment.
+		Polygon clip(const Polygon& p_polygon, const glm::vec3& p_normal, const float& p_offset)
+		{
+			Polygon clipped;
+			if (p_polygon.m_count == 2)
+			{
+				auto start = p_polygon.m_points[0];
+				auto end   = p_polygon.m_points[1];
+				const float distance_start = glm::dot(p_normal, start) - p_offset;
+				const float distance_end   = glm::dot(p_normal, end) - p_offset;
+				if (distance_start > 0.f && distance_end > 0.f)
+					return clipped;
+				if (distance_start > 0.f)
+					start = start + (end - start) * (distance_start / (distance_start - distance_end));
+				else if (distance_end > 0.f)
+					end = end + (start - end) * (distance_end / (distance_end - distance_start));
+				clipped.push(start);
+				clipped.push(end);
+				return clipped;
+			}
+
+			// Sutherland-Hodgman
+			for (size_t i = 0; i < p_polygon.m_count; i++)
+			{
+				const auto& current = p_polygon.m_points[i];
+				const auto& next    = p_polygon.m_points[(i + 1) % p_polygon.m_count];
+				const float distance_current = glm::dot(p_normal, current) - p_offset;
+				const float distance_next    = glm::dot(p_normal, next) - p_offset;
+
+				if (distance_current <= 0.f)
+					clipped.push(current);
+				if ((distance_current <= 0.f) != (distance_next <= 0.f) && p_polygon.m_count > 1)
+					clipped.push(current + (next - current) * (distance_current / (distance_current - distance_next)));
+			}
+			return clipped;
+		}
+
+		// The volume p_shape covers moving by m_sweep without rotating: the convex hull of the shape at its start and end.
+		struct SweptShape
+		{
+			ConvexShape m_shape;
+			glm::vec3 m_sweep;
+
+			[[nodiscard]] glm::vec3 support(const glm::vec3& p_direction) const { return glm::dot(p_direction, m_sweep) > 0.f ? m_shape.support(p_direction) + m_sweep : m_shape.support(p_direction); }
+			[[nodiscard]] glm::vec3 get_center() const                          { return m_shape.get_center() + m_sweep * 0.5f; }
+		};
+
+		// A vertex of the Minkowski difference A - B with the points on A and B it came from.
+		struct SupportPoint
+		{
+			glm::vec3 m_point;
+			glm::vec3 m_A;
+			glm::vec3 m_B;
+		};
+		template <typename ShapeA>
+		SupportPoint support(const ShapeA& p_shape_A, const ConvexShape& p_shape_B, const glm::vec3& p_direction)
+		{
+			const auto A = p_shape_A.support(p_direction);
+			const auto B = p_shape_B.support(-p_direction);
+			return {A - B, A, B};
+		}
+
+		// The newest point is m_points[0].
+		struct Simplex
+		{
+			std::array<SupportPoint, 4> m_points = {};
+			size_t m_count = 0;
+
+			void push_front(const SupportPoint& p_point)
+			{
+				m_points = {p_point, m_points[0], m_points[1], m_points[2]};
+				m_count  = std::min(m_count + 1, size_t(4));
+			}
+			void set(std::initializer_list<SupportPoint> p_points)
+			{
+				std::copy(p_points.begin(), p_points.end(), m_points.begin());
+				m_count = p_points.size();
+			}
+		};
+
+		bool same_direction(const glm::vec3& p_a, const glm::vec3& p_b) { return glm::dot(p_a, p_b) > 0.f; }
+
+		void line_case(Simplex& p_simplex, glm::vec3& p_direction)
+		{
+			const auto a  = p_simplex.m_points[0];
+			const auto b  = p_simplex.m_points[1];
+			const auto ab = b.m_point - a.m_point;
+			const auto ao = -a.m_point;
+			if (same_direction(ab, ao))
+			{
+				p_simplex.set({a, b});
+				p_direction = glm::cross(glm::cross(ab, ao), ab);
+			}
+			else
+			{
+				p_simplex.set({a});
+				p_direction = ao;
+			}
+		}
+		void triangle_case(Simplex& p_simplex, glm::vec3& p_direction)
+		{
+			const auto a   = p_simplex.m_points[0];
+			const auto b   = p_simplex.m_points[1];
+			const auto c   = p_simplex.m_points[2];
+			const auto ab  = b.m_point - a.m_point;
+			const auto ac  = c.m_point - a.m_point;
+			const auto ao  = -a.m_point;
+			const auto abc = glm::cross(ab, ac);
+
+			if (same_direction(glm::cross(abc, ac), ao))
+			{
+				if (same_direction(ac, ao))
+				{
+					p_simplex.set({a, c});
+					p_direction = glm::cross(glm::cross(ac, ao), ac);
+				}
+				else
+				{
+					p_simplex.set({a, b});
+					line_case(p_simplex, p_direction);
+				}
+			}
+			else if (same_direction(glm::cross(ab, abc), ao))
+			{
+				p_simplex.set({a, b});
+				line_case(p_simplex, p_direction);
+			}
+			else if (same_direction(abc, ao))
+				p_direction = abc;
+			else
+			{
+				p_simplex.set({a, c, b});
+				p_direction = -abc;
+			}
+		}
+		// Reduce p_simplex to the feature closest to the origin and point p_direction from it towards the origin.
+		//@return True if the simplex encloses the origin.
+		bool next_simplex(Simplex& p_simplex, glm::vec3& p_direction)
+		{
+			switch (p_simplex.m_count)
+			{
+				case 2: line_case(p_simplex, p_direction); return false;
+				case 3: triangle_case(p_simplex, p_direction); return false;
+				case 4:
+				{
+					const auto a  = p_simplex.m_points[0];
+					const auto b  = p_simplex.m_points[1];
+					const auto c  = p_simplex.m_points[2];
+					const auto d  = p_simplex.m_points[3];
+					const auto ab = b.m_point - a.m_point;
+					const auto ac = c.m_point - a.m_point;
+					const auto ad = d.m_point - a.m_point;
+					const auto ao = -a.m_point;
+
+					if (same_direction(glm::cross(ab, ac), ao))
+					{
+						p_simplex.set({a, b, c});
+						triangle_case(p_simplex, p_direction);
+						return false;
+					}
+					if (same_direction(glm::cross(ac, ad), ao))
+					{
+						p_simplex.set({a, c, d});
+						triangle_case(p_simplex, p_direction);
+						return false;
+					}
+					if (same_direction(glm::cross(ad, ab), ao))
+					{
+						p_simplex.set({a, d, b});
+						triangle_case(p_simplex, p_direction);
+						return false;
+					}
+					return true;
+				}
+				default: return false;
+			}
+		}
+
+		// Does the Minkowski difference A - B contain the origin. On return p_simplex holds the final simplex for EPA.
+		// ShapeA is a ConvexShape or a SweptShape.
+		template <typename ShapeA>
+		bool GJK(const ShapeA& p_shape_A, const ConvexShape& p_shape_B, Simplex& p_simplex)
+		{
+			auto direction = p_shape_A.get_center() - p_shape_B.get_center();
+			if (glm::dot(direction, direction) < Degenerate_Length * Degenerate_Length)
+				direction = glm::vec3(1.f, 0.f, 0.f);
+
+			p_simplex.set({support(p_shape_A, p_shape_B, direction)});
+			direction = -p_simplex.m_points[0].m_point;
+
+			for (size_t i = 0; i < Max_GJK_Iterations; i++)
+			{
+				// The origin lies on the simplex, the shapes are touching.
+				if (glm::dot(direction, direction) < Degenerate_Length * Degenerate_Length)
+					return true;
+
+				const auto point = support(p_shape_A, p_shape_B, direction);
+				if (glm::dot(point.m_point, direction) < 0.f)
+					return false;
+
+				p_simplex.push_front(point);
+				if (next_simplex(p_simplex, direction))
+					return true;
+			}
+			return false;
+		}
+
+		// GJK can finish on a point, line or triangle when the origin is on the boundary of A - B. Grow p_simplex into a tetrahedron.
+		//@return False if A - B is flat, EPA requires a volume.
+		bool expand_to_tetrahedron(const ConvexShape& p_shape_A, const ConvexShape& p_shape_B, Simplex& p_simplex)
+		{
+			static constexpr std::array<glm::vec3, 6> Axes = {glm::vec3(1.f, 0.f, 0.f), glm::vec3(-1.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 0.f, 1.f), glm::vec3(0.f, 0.f, -1.f)};
+
+			if (p_simplex.m_count == 1)
+			{
+				for (const auto& axis : Axes)
+				{
+					const auto point = support(p_shape_A, p_shape_B, axis);
+					if (glm::length(point.m_point - p_simplex.m_points[0].m_point) > Degenerate_Length)
+					{
+						p_simplex.push_front(point);
+						break;
+					}
+				}
+			}
+			if (p_simplex.m_count == 2)
+			{
+				const auto line = p_simplex.m_points[1].m_point - p_simplex.m_points[0].m_point;
+				const auto u    = glm::cross(line, std::abs(line.x) < std::abs(line.y) ? glm::vec3(1.f, 0.f, 0.f) : glm::vec3(0.f, 1.f, 0.f));
+				const auto v    = glm::cross(line, u);
+				for (const auto& direction : {u, -u, v, -v})
+				{
+					const auto point = support(p_shape_A, p_shape_B, direction);
+					if (glm::length(glm::cross(line, point.m_point - p_simplex.m_points[0].m_point)) > Degenerate_Length)
+					{
+						p_simplex.push_front(point);
+						break;
+					}
+				}
+			}
+			if (p_simplex.m_count == 3)
+			{
+				const auto normal = glm::cross(p_simplex.m_points[1].m_point - p_simplex.m_points[0].m_point, p_simplex.m_points[2].m_point - p_simplex.m_points[0].m_point);
+				for (const auto& direction : {normal, -normal})
+				{
+					const auto point = support(p_shape_A, p_shape_B, direction);
+					if (std::abs(glm::dot(point.m_point - p_simplex.m_points[0].m_point, normal)) > Degenerate_Length)
+					{
+						p_simplex.push_front(point);
+						break;
+					}
+				}
+			}
+			if (p_simplex.m_count != 4)
+				return false;
+
+			const auto& points = p_simplex.m_points;
+			const float volume = glm::dot(points[1].m_point - points[0].m_point, glm::cross(points[2].m_point - points[0].m_point, points[3].m_point - points[0].m_point));
+			return std::abs(volume) > Degenerate_Length;
+		}
+
+		struct Penetration
+		{
+			glm::vec3 m_normal; // The direction A is penetrating into B.
+			float m_depth;
+			glm::vec3 m_point_A; // The deepest point of A inside B.
+		};
+
+		// Expanding polytope algorithm. Grows the GJK simplex towards the surface of A - B to find the face closest to the origin.
+		// The polytope gains one vertex per iteration so it fits in fixed capacity arrays and EPA never allocates.
+		std::optional<Penetration> EPA(const ConvexShape& p_shape_A, const ConvexShape& p_shape_B, Simplex& p_simplex)
+		{
+			if (!expand_to_tetrahedron(p_shape_A, p_shape_B, p_simplex))
+				return std::nullopt;
+
+			struct Face
+			{
+				size_t m_a, m_b, m_c;
+				glm::vec3 m_normal;
+				float m_distance;
+			};
+			struct Edge
+			{
+				size_t m_a, m_b;
+			};
+			// A closed triangulated convex polytope of V vertices has 2V - 4 faces. Each removed face adds at most 3 edges to the horizon.
+			constexpr size_t Max_Vertices = 4 + Max_EPA_Iterations;
+			constexpr size_t Max_Faces    = 2 * Max_Vertices - 4;
+			std::array<SupportPoint, Max_Vertices> vertices;
+			std::array<Face, Max_Faces> faces;
+			std::array<Edge, 3 * Max_Faces> horizon;
+			size_t vertex_count  = 4;
+			size_t face_count    = 0;
+			size_t horizon_count = 0;
+			std::copy(p_simplex.m_points.begin(), p_simplex.m_points.end(), vertices.begin());
+
+			// The polytope stays convex so every face is oriented outward from the centroid of the starting tetrahedron.
+			const auto interior = (vertices[0].m_point + vertices[1].m_point + vertices[2].m_point + vertices[3].m_point) * 0.25f;
+			auto add_face = [&](size_t p_a, size_t p_b, size_t p_c)
+			{
+				auto normal       = glm::cross(vertices[p_b].m_point - vertices[p_a].m_point, vertices[p_c].m_point - vertices[p_a].m_point);
+				const auto length = glm::length(normal);
+				if (length < Degenerate_Length * Degenerate_Length)
+				{
+					faces[face_count++] = {p_a, p_b, p_c, glm::vec3(0.f), std::numeric_limits<float>::max()};
+					return;
+				}
+				normal /= length;
+				if (glm::dot(normal, vertices[p_a].m_point - interior) < 0.f)
+				{
+					std::swap(p_b, p_c);
+					normal = -normal;
+				}
+				faces[face_count++] = {p_a, p_b, p_c, normal, glm::dot(normal, vertices[p_a].m_point)};
+			};
+			auto find_closest = [&]()
+			{
+				size_t closest = 0;
+				for (size_t i = 1; i < face_count; i++)
+					if (faces[i].m_distance < faces[closest].m_distance)
+						closest = i;
+				return closest;
+			};
+			add_face(0, 1, 2);
+			add_face(0, 3, 1);
+			add_face(0, 2, 3);
+			add_face(1, 3, 2);
+
+			for (size_t iteration = 0; iteration < Max_EPA_Iterations; iteration++)
+			{
+				const auto& closest_face = faces[find_closest()];
+				const auto point = support(p_shape_A, p_shape_B, closest_face.m_normal);
+				if (glm::dot(point.m_point, closest_face.m_normal) - closest_face.m_distance < EPA_Tolerance)
+					break;
+
+				// Remove the faces visible from the new point, the edges bordering the hole they leave form the horizon.
+				horizon_count = 0;
+				for (size_t i = face_count; i-- > 0;)
+				{
+					if (glm::dot(faces[i].m_normal, point.m_point - vertices[faces[i].m_a].m_point) <= 0.f)
+						continue;
+
+					for (const auto& edge : {Edge{faces[i].m_a, faces[i].m_b}, Edge{faces[i].m_b, faces[i].m_c}, Edge{faces[i].m_c, faces[i].m_a}})
+					{
+						// An edge shared with another removed face appears reversed, it's not on the horizon.
+						const auto reversed = std::find_if(horizon.begin(), horizon.begin() + horizon_count, [&edge](const Edge& p_edge) { return p_edge.m_a == edge.m_b && p_edge.m_b == edge.m_a; });
+						if (reversed != horizon.begin() + horizon_count)
+							*reversed = horizon[--horizon_count];
+						else
+							horizon[horizon_count++] = edge;
+					}
+					faces[i] = faces[--face_count];
+				}
+				// A horizon that isn't a single loop (numerical error on a near-flat polytope) would leave the polytope open.
+				if (horizon_count == 0 || face_count + horizon_count > Max_Faces)
+					break;
+
+				vertices[vertex_count++] = point;
+				for (size_t i = 0; i < horizon_count; i++)
+					add_face(horizon[i].m_a, horizon[i].m_b, vertex_count - 1);
+			}
+			if (face_count == 0)
+				return std::nullopt;
+
+			const auto& face = faces[find_closest()];
+			if (face.m_distance == std::numeric_limits<float>::max())
+				return std::nullopt;
+
+			// The barycentric coordinates of the origin projected onto the closest face interpolate the points on A.
+			const auto& a = vertices[face.m_a];
+			const auto& b = vertices[face.m_b];
+			const auto& c = vertices[face.m_c];
+			const auto projection = face.m_normal * face.m_distance;
+			const auto v0 = b.m_point - a.m_point;
+			const auto v1 = c.m_point - a.m_point;
+			const auto v2 = projection - a.m_point;
+			const float d00 = glm::dot(v0, v0);
+			const float d01 = glm::dot(v0, v1);
+			const float d11 = glm::dot(v1, v1);
+			const float d20 = glm::dot(v2, v0);
+			const float d21 = glm::dot(v2, v1);
+			const float denominator = d00 * d11 - d01 * d01;
+			const float v = denominator != 0.f ? std::clamp((d11 * d20 - d01 * d21) / denominator, 0.f, 1.f) : 0.f;
+			const float w = denominator != 0.f ? std::clamp((d00 * d21 - d01 * d20) / denominator, 0.f, 1.f - v) : 0.f;
+			const float u = 1.f - v - w;
+
+			return Penetration{face.m_normal, std::max(face.m_distance, 0.f), a.m_A * u + b.m_A * v + c.m_A * w};
+		}
+
+		// Reduce p_count candidate points to the deepest point, the point farthest from it and the two points spanning the largest area either side.
+		void reduce(const std::array<ContactPoint, 16>& p_candidates, const size_t& p_count, ContactManifold& p_manifold)
+		{
+			if (p_count <= ContactManifold::Max_Points)
+			{
+				for (size_t i = 0; i < p_count; i++)
+					p_manifold.add(p_candidates[i]);
+				return;
+			}
+
+			size_t deepest = 0;
+			for (size_t i = 1; i < p_count; i++)
+				if (p_candidates[i].penetration_depth > p_candidates[deepest].penetration_depth)
+					deepest = i;
+
+			size_t farthest = deepest == 0 ? 1 : 0;
+			for (size_t i = 0; i < p_count; i++)
+				if (glm::length(p_candidates[i].position - p_candidates[deepest].position) > glm::length(p_candidates[farthest].position - p_candidates[deepest].position))
+					farthest = i;
+
+			const auto& normal = p_candidates[deepest].normal;
+			auto signed_area = [&](const size_t& p_index)
+			{
+				return glm::dot(glm::cross(p_candidates[farthest].position - p_candidates[deepest].position, p_candidates[p_index].position - p_candidates[deepest].position), normal);
+			};
+			size_t most_positive = deepest;
+			size_t most_negative = deepest;
+			for (size_t i = 0; i < p_count; i++)
+			{
+				if (signed_area(i) > signed_area(most_positive))
+					most_positive = i;
+				if (signed_area(i) < signed_area(most_negative))
+					most_negative = i;
+			}
+
+			p_manifold.add(p_candidates[deepest]);
+			p_manifold.add(p_candidates[farthest]);
+			if (most_positive != deepest)
+				p_manifold.add(p_candidates[most_positive]);
+			if (most_negative != deepest)
+				p_manifold.add(p_candidates[most_negative]);
+		}
+	} // namespace
+
+	glm::vec3 support(const Shape& p_shape, const glm::vec3& p_direction)
+	{
+		return std::visit([&p_direction](auto&& p_shape) { return farthest_point(p_shape, p_direction); }, p_shape.shape);
+	}
+
+	glm::vec3 ConvexShape::support(const glm::vec3& p_direction) const
+	{
+		// The support of a linearly transformed shape is the transformed support along the transposed direction.
+		return m_linear * Geometry::support(m_shape, glm::transpose(m_linear) * p_direction) + m_translation;
+	}
+	glm::vec3 ConvexShape::get_center() const
+	{
+		const auto center = std::visit([](auto&& p_shape) -> glm::vec3
+		{
+			using T = std::decay_t<decltype(p_shape)>;
+			if constexpr (std::is_same_v<T, Cone> || std::is_same_v<T, Cylinder>)
+				return (p_shape.m_base + p_shape.m_top) * 0.5f;
+			else if constexpr (std::is_same_v<T, Cuboid>)
+				return p_shape.m_position;
+			else if constexpr (std::is_same_v<T, LineSegment>)
+				return (p_shape.m_start + p_shape.m_end) * 0.5f;
+			else if constexpr (std::is_same_v<T, Quad>)
+				return (p_shape.m_point_1 + p_shape.m_point_2 + p_shape.m_point_3 + p_shape.m_point_4) * 0.25f;
+			else if constexpr (std::is_same_v<T, Sphere>)
+				return p_shape.m_center;
+			else
+				return (p_shape.m_point_1 + p_shape.m_point_2 + p_shape.m_point_3) / 3.f;
+		}, m_shape.shape);
+		return m_linear * center + m_translation;
+	}
+
+	void ContactManifold::add(const ContactPoint& p_contact_point)
+	{
+		if (m_count < Max_Points)
+		{
+			m_points[m_count++] = p_contact_point;
+			return;
+		}
+
+		auto shallowest = std::min_element(m_points.begin(), m_points.end(), [](const ContactPoint& p_a, const ContactPoint& p_b) { return p_a.penetration_depth < p_b.penetration_depth; });
+		if (p_contact_point.penetration_depth > shallowest->penetration_depth)
+			*shallowest = p_contact_point;
+	}
+
+	bool intersecting(const ConvexShape& p_shape_A, const ConvexShape& p_shape_B)
+	{
+		Simplex simplex;
+		return GJK(p_shape_A, p_shape_B, simplex);
+	}
+
+	std::optional<ContactManifold> get_contact_manifold(const ConvexShape& p_shape_A, const ConvexShape& p_shape_B)
+	{
+		Simplex simplex;
+		if (!GJK(p_shape_A, p_shape_B, simplex))
+			return std::nullopt;
+
+		const auto penetration = EPA(p_shape_A, p_shape_B, simplex);
+		if (!penetration)
+			return std::nullopt;
+
+		// The contact normal pushes A out of B, the opposite of the direction A penetrates.
+		const auto& normal = penetration->m_normal;
+		ContactManifold manifold;
+		const ContactPoint deepest_point = {penetration->m_point_A, -normal, penetration->m_depth};
+
+		const auto feature_A     = get_feature(p_shape_A, normal);
+		const auto feature_B     = get_feature(p_shape_B, -normal);
+		const auto face_normal_A = get_face_normal(feature_A, normal);
+		const auto face_normal_B = get_face_normal(feature_B, -normal);
+		const float alignment_A  = face_normal_A ? glm::dot(*face_normal_A, normal) : 0.f;
+		const float alignment_B  = face_normal_B ? glm::dot(*face_normal_B, -normal) : 0.f;
+		const bool parallel_edges = feature_A.m_count == 2 && feature_B.m_count == 2
+			&& std::abs(glm::dot(glm::normalize(feature_A.m_points[1] - feature_A.m_points[0]), glm::normalize(feature_B.m_points[1] - feature_B.m_points[0]))) >= Parallel_Tolerance;
+
+		// Features are clipped when one is a face facing the normal or both are parallel edges.
+		// Vertices, crossing edges and faces meeting at an angle touch at the single EPA point.
+		if (feature_A.m_count == 1 || feature_B.m_count == 1 || (std::max(alignment_A, alignment_B) < Face_Tolerance && !parallel_edges))
+		{
+			manifold.add(deepest_point);
+			return manifold;
+		}
+
+		// Clip the incident feature to the sides of the reference feature, the face most aligned with the normal preferring A.
+		const bool reference_is_A = alignment_A >= alignment_B * 0.98f;
+		const auto& reference     = reference_is_A ? feature_A : feature_B;
+		auto incident             = reference_is_A ? feature_B : feature_A;
+		const auto& face_normal   = reference_is_A ? face_normal_A : face_normal_B;
+		const auto reference_normal = face_normal ? *face_normal : (reference_is_A ? normal : -normal); // Outward from the reference shape.
+
+		if (reference.m_count >= 3)
+		{
+			auto centroid = glm::vec3(0.f);
+			for (size_t i = 0; i < reference.m_count; i++)
+				centroid += reference.m_points[i];
+			centroid /= static_cast<float>(reference.m_count);
+
+			for (size_t i = 0; i < reference.m_count && incident.m_count > 0; i++)
+			{
+				const auto& start = reference.m_points[i];
+				const auto& end   = reference.m_points[(i + 1) % reference.m_count];
+				auto side_normal  = glm::cross(end - start, reference_normal);
+				if (glm::dot(side_normal, centroid - start) > 0.f)
+					side_normal = -side_normal;
+				incident = clip(incident, side_normal, glm::dot(side_normal, start));
+			}
+		}
+		else
+		{
+			const auto edge = reference.m_points[1] - reference.m_points[0];
+			incident = clip(incident, -edge, glm::dot(-edge, reference.m_points[0]));
+			incident = clip(incident, edge, glm::dot(edge, reference.m_points[1]));
+		}
+
+		std::array<ContactPoint, 16> candidates = {};
+		size_t candidate_count = 0;
+		for (size_t i = 0; i < incident.m_count; i++)
+		{
+			const auto& point = incident.m_points[i];
+			// No point can be deeper than the distance separating the shapes. Points of a face about to touch are kept so a tilting face
+			// is supported at all its corners before they land.
+			const float depth = std::min(glm::dot(reference.m_points[0] - point, reference_normal), penetration->m_depth);
+			if (depth < -Contact_Margin)
+				continue;
+
+			// Points of B are moved onto the surface of A.
+			candidates[candidate_count++] = {reference_is_A ? point + reference_normal * depth : point, -normal, depth};
+		}
+
+		if (candidate_count == 0)
+			manifold.add(deepest_point);
+		else
+			reduce(candidates, candidate_count, manifold);
+		return manifold;
+	}
+
+	std::optional<float> time_of_impact(const ConvexShape& p_shape_A, const glm::vec3& p_translation, const ConvexShape& p_shape_B)
+	{
+		if (intersecting(p_shape_A, p_shape_B) || glm::length(p_translation) < Degenerate_Length)
+			return std::nullopt;
+
+		// The volume swept over an interval of the motion is convex so one GJK test covers the whole interval, however far A moves and
+		// however thin B is. If an interval overlaps B one of its halves does, keeping the earlier overlapping half converges on the first
+		// time A touches B.
+		auto swept = [&](const float& p_start, const float& p_end)
+		{
+			return SweptShape{ConvexShape{p_shape_A.m_shape, p_shape_A.m_linear, p_shape_A.m_translation + p_translation * p_start}, p_translation * (p_end - p_start)};
+		};
+		Simplex simplex;
+		if (!GJK(swept(0.f, 1.f), p_shape_B, simplex))
+			return std::nullopt;
+
+		float start = 0.f;
+		float end   = 1.f;
+		for (size_t i = 0; i < Bisect_Iterations; i++)
+		{
+			const float middle = (start + end) * 0.5f;
+			if (GJK(swept(start, middle), p_shape_B, simplex))
+				end = middle;
+			else
+				start = middle;
+		}
+		return end;
+	}
+} // namespace Geometry
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Geometry/Intersect.hpp"
+#include "Geometry/Shape.hpp"
+
+#include "glm/mat3x3.hpp"
+#include "glm/vec3.hpp"
+
+#include <array>
+#include <optional>
+
+namespace Geometry
+{
+	// A convex Shape placed in world space by an affine transform: world = m_linear * object + m_translation.
+	// Used to test collision shapes stored in object space (Data::Mesh::collision_shapes) without transforming them.
+	struct ConvexShape
+	{
+		const Shape& m_shape;
+		glm::mat3 m_linear;      // Rotation * Scale
+		glm::vec3 m_translation;
+
+		// The point on the shape farthest along p_direction in world space. p_direction doesn't need to be normalised.
+		[[nodiscard]] glm::vec3 support(const glm::vec3& p_direction) const;
+		// A point inside the shape in world space.
+		[[nodiscard]] glm::vec3 get_center() const;
+	};
+
+	// The point on p_shape farthest along p_direction. p_direction doesn't need to be normalised.
+	glm::vec3 support(const Shape& p_shape, const glm::vec3& p_direction);
+
+	// Up to Max_Points ContactPoints between two shapes sharing one normal, from the perspective of shape A.
+	struct ContactManifold
+	{
+		static constexpr size_t Max_Points = 4;
+
+		std::array<ContactPoint, Max_Points> m_points = {};
+		size_t m_count = 0;
+
+		// Add p_contact_point. When full, p_contact_point replaces the shallowest point if it is deeper.
+		void add(const ContactPoint& p_contact_point);
+		[[nodiscard]] const ContactPoint* begin() const { return m_points.data(); }
+		[[nodiscard]] const ContactPoint* end() const   { return m_points.data() + m_count; }
+	};
+
+	// Are p_shape_A and p_shape_B overlapping. Uses the GJK algorithm.
+	bool intersecting(const ConvexShape& p_shape_A, const ConvexShape& p_shape_B);
+	// The contact manifold of p_shape_A against p_shape_B or nullopt if they are not overlapping.
+	// GJK finds the overlap, EPA the normal and depth. The points come from clipping the features (face, edge or vertex) of the two shapes
+	// facing each other, curved features contribute a single point. Clipped points just short of touching are included with a negative
+	// penetration_depth so resting faces keep a stable set of points.
+	// Overlapping shapes with no volume between them (e.g. two coplanar Quads) return nullopt.
+	std::optional<ContactManifold> get_contact_manifold(const ConvexShape& p_shape_A, const ConvexShape& p_shape_B);
+	// The fraction [0-1] of p_translation p_shape_A moves by before it first touches p_shape_B. A is swept without rotating, B is stationary.
+	// Returns nullopt if A doesn't touch B over the motion or already overlaps it at the start.
+	// The motion is bisected, testing the volume A sweeps over each half against B with GJK, so A can't pass through B however fast it moves.
+	//@return The fraction at which A first overlaps B, past the exact time of impact by at most 2^-20.
+	std::optional<float> time_of_impact(const ConvexShape& p_shape_A, const glm::vec3& p_translation, const ConvexShape& p_shape_B);
+} // namespace Geometry
@@ -0,0 +1,210 @@
+#include "Heightfield.hpp"
+
+#include "Utility/Logger.hpp"
+
+#include "glm/glm.hpp"
+
+#include <utility>
+
+namespace Geometry
+{
+	Heightfield::Heightfield() noexcept
+		: m_cells_x{0}
+		, m_cells_z{0}
+		, m_cell_size{1.f}
+		, m_heights{}
+		, m_mips{}
+	{}
+
+	Heightfield::Heightfield(size_t p_cells_x, size_t p_cells_z, float p_cell_size, std::vector<float>&& p_heights)
+		: m_cells_x{p_cells_x}
+		, m_cells_z{p_cells_z}
+		, m_cell_size{p_cell_size}
+		, m_heights{std::move(p_heights)}
+		, m_mips{}
+	{
+		ASSERT(m_cells_x > 0 && m_cells_z > 0, "Heightfield needs at least one cell.");
+		ASSERT(m_cell_size > 0.f, "Heightfield cell size must be positive.");
+		ASSERT(m_heights.size() == (m_cells_x + 1) * (m_cells_z + 1), "Heightfield needs (cells_x + 1) * (cells_z + 1) heights.");
+
+		{ // Level 0 is the range of the 4 corners of each cell.
+			Level cells{m_cells_x, m_cells_z, {}};
+			cells.m_ranges.reserve(m_cells_x * m_cells_z);
+			for (size_t x = 0; x < m_cells_x; x++)
+				for (size_t z = 0; z < m_cells_z; z++)
+				{
+					const auto [min, max] = std::minmax({height_at(x, z), height_at(x + 1, z), height_at(x, z + 1), height_at(x + 1, z + 1)});
+					cells.m_ranges.push_back({min, max});
+				}
+			m_mips.push_back(std::move(cells));
+		}
+
+		// Each level merges 2x2 blocks of the level below, blocks on an odd edge merge the blocks that exist.
+		while (m_mips.back().m_blocks_x > 1 || m_mips.back().m_blocks_z > 1)
+		{
+			const auto& below = m_mips.back();
+			Level level{(below.m_blocks_x + 1) / 2, (below.m_blocks_z + 1) / 2, {}};
+			level.m_ranges.resize(level.m_blocks_x * level.m_blocks_z, {std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest()});
+			for (size_t x = 0; x < below.m_blocks_x; x++)
+				for (size_t z = 0; z < below.m_blocks_z; z++)
+				{
+					const auto& range = below.m_ranges[x * below.m_blocks_z + z];
+					auto& merged      = level.m_ranges[(x / 2) * level.m_blocks_z + z / 2];
+					merged.m_min      = std::min(merged.m_min, range.m_min);
+					merged.m_max      = std::max(merged.m_max, range.m_max);
+				}
+			m_mips.push_back(std::move(level));
+		}
+	}
+
+	AABB Heightfield::get_bound() const
+	{
+		if (empty())
+			return AABB();
+
+		const auto& range = m_mips.back().m_ranges.front();
+		return AABB(glm::vec3(0.f, range.m_min, 0.f), glm::vec3(static_cast<float>(m_cells_x) * m_cell_size, range.m_max, static_cast<float>(m_cells_z) * m_cell_size));
+	}
+
+	std::optional<float> Heightfield::get_height(float p_x, float p_z) const
+	{
+		const float x = p_x / m_cell_size;
+		const float z = p_z / m_cell_size;
+		if (empty() || x < 0.f || z < 0.f || x > static_cast<float>(m_cells_x) || z > static_cast<float>(m_cells_z))
+			return std::nullopt;
+
+		// Interpolate across the triangle of the cell containing the point, (u, v) is the position in the cell.
+		const size_t cell_x = std::min(static_cast<size_t>(x), m_cells_x - 1);
+		const size_t cell_z = std::min(static_cast<size_t>(z), m_cells_z - 1);
+		const float u = x - static_cast<float>(cell_x);
+		const float v = z - static_cast<float>(cell_z);
+		if (u + v <= 1.f)
+		{
+			const float corner = height_at(cell_x, cell_z);
+			return corner + (height_at(cell_x + 1, cell_z) - corner) * u + (height_at(cell_x, cell_z + 1) - corner) * v;
+		}
+		else
+		{
+			const float corner = height_at(cell_x + 1, cell_z + 1);
+			return corner + (height_at(cell_x, cell_z + 1) - corner) * (1.f - u) + (height_at(cell_x + 1, cell_z) - corner) * (1.f - v);
+		}
+	}
+
+	std::array<Triangle, 2> Heightfield::get_cell_triangles(size_t p_x, size_t p_z) const
+	{
+		auto vertex = [this](const size_t& p_vertex_x, const size_t& p_vertex_z)
+		{
+			return glm::vec3(static_cast<float>(p_vertex_x) * m_cell_size, height_at(p_vertex_x, p_vertex_z), static_cast<float>(p_vertex_z) * m_cell_size);
+		};
+		// The same winding MeshBuilder::add_quad gives the terrain mesh.
+		return {Triangle(vertex(p_x + 1, p_z), vertex(p_x, p_z), vertex(p_x, p_z + 1)),
+		        Triangle(vertex(p_x + 1, p_z), vertex(p_x, p_z + 1), vertex(p_x + 1, p_z + 1))};
+	}
+
+	std::optional<Heightfield::RayHit> Heightfield::raycast(const Ray& p_ray, float p_max_distance) const
+	{
+		if (empty())
+			return std::nullopt;
+
+		// Clip the ray to the bound, the walk starts where the ray enters the grid and ends where it leaves it.
+		const auto bound = get_bound();
+		float t_begin = 0.f;
+		float t_end   = p_max_distance;
+		for (int i = 0; i < 3; i++)
+		{
+			if (p_ray.m_direction[i] == 0.f)
+			{
+				if (p_ray.m_start[i] < bound.m_min[i] || p_ray.m_start[i] > bound.m_max[i])
+					return std::nullopt;
+				continue;
+			}
+
+			float near = (bound.m_min[i] - p_ray.m_start[i]) / p_ray.m_direction[i];
+			float far  = (bound.m_max[i] - p_ray.m_start[i]) / p_ray.m_direction[i];
+			if (near > far)
+				std::swap(near, far);
+
+			t_begin = std::max(t_begin, near);
+			t_end   = std::min(t_end, far);
+			if (t_begin > t_end)
+				return std::nullopt;
+		}
+
+		const auto& top = m_mips.back();
+		return raycast_level(p_ray, m_mips.size() - 1, 0, top.m_blocks_x - 1, 0, top.m_blocks_z - 1, t_begin, t_end);
+	}
+
+	std::optional<Heightfield::RayHit> Heightfield::raycast_level(const Ray& p_ray, const size_t& p_level, const size_t& p_min_x, const size_t& p_max_x, const size_t& p_min_z, const size_t& p_max_z, float p_t_begin, const float& p_t_end) const
+	{
+		const auto& blocks     = m_mips[p_level];
+		const auto& start      = p_ray.m_start;
+		const auto& direction  = p_ray.m_direction;
+		const float block_size = m_cell_size * static_cast<float>(size_t(1) << p_level);
+
+		// The block the ray is in at p_t_begin, clamped to the parent block against rounding on its edges.
+		auto block_of = [&block_size](const float& p_position, const size_t& p_min, const size_t& p_max)
+		{
+			const float block = std::floor(p_position / block_size);
+			return block <= static_cast<float>(p_min) ? p_min : std::min(static_cast<size_t>(block), p_max);
+		};
+		size_t x = block_of(start.x + direction.x * p_t_begin, p_min_x, p_max_x);
+		size_t z = block_of(start.z + direction.z * p_t_begin, p_min_z, p_max_z);
+
+		while (true)
+		{
+			// The ray leaves the block through the next x or z boundary along its direction. The boundaries are computed from the block
+			// index rather than accumulated so the walk doesn't drift over long rays.
+			constexpr float Never = std::numeric_limits<float>::infinity();
+			const float t_next_x = direction.x > 0.f ? (static_cast<float>(x + 1) * block_size - start.x) / direction.x
+			                     : direction.x < 0.f ? (static_cast<float>(x) * block_size - start.x) / direction.x : Never;
+			const float t_next_z = direction.z > 0.f ? (static_cast<float>(z + 1) * block_size - start.z) / direction.z
+			                     : direction.z < 0.f ? (static_cast<float>(z) * block_size - start.z) / direction.z : Never;
+			const float t_exit = std::min({t_next_x, t_next_z, p_t_end});
+
+			// Only blocks whose height range the ray passes through while over them can be hit.
+			const float y_begin = start.y + direction.y * p_t_begin;
+			const float y_exit  = start.y + direction.y * t_exit;
+			const auto& range   = blocks.m_ranges[x * blocks.m_blocks_z + z];
+			if (std::max(y_begin, y_exit) >= range.m_min && std::min(y_begin, y_exit) <= range.m_max)
+			{
+				if (p_level == 0)
+				{
+					// The cells are walked in order along the ray so the first cell hit holds the closest hit.
+					std::optional<RayHit> closest;
+					for (const auto& triangle : get_cell_triangles(x, z))
+					{
+						float distance = 0.f;
+						const auto contact = get_intersection(p_ray, triangle, &distance);
+						if (contact && distance <= p_t_end && (!closest || distance < closest->m_distance))
+							closest = RayHit{*contact, distance};
+					}
+					if (closest)
+						return closest;
+				}
+				else
+				{
+					const auto& below = m_mips[p_level - 1];
+					if (auto hit = raycast_level(p_ray, p_level - 1, x * 2, std::min(x * 2 + 1, below.m_blocks_x - 1), z * 2, std::min(z * 2 + 1, below.m_blocks_z - 1), p_t_begin, t_exit))
+						return hit;
+				}
+			}
+
+			if (t_exit >= p_t_end)
+				return std::nullopt;
+
+			if (t_next_x < t_next_z)
+			{
+				if (direction.x > 0.f ? x == p_max_x : x == p_min_x)
+					return std::nullopt;
+				x = direction.x > 0.f ? x + 1 : x - 1;
+			}
+			else
+			{
+				if (direction.z > 0.f ? z == p_max_z : z == p_min_z)
+					return std::nullopt;
+				z = direction.z > 0.f ? z + 1 : z - 1;
+			}
+			p_t_begin = t_exit;
+		}
+	}
+} // namespace Geometry
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Geometry/AABB.hpp"
+#include "Geometry/Intersect.hpp"
+#include "Geometry/Ray.hpp"
+#include "Geometry/Sphere.hpp"
+#include "Geometry/Triangle.hpp"
+
+#include "glm/vec3.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace Geometry
+{
+	// A regular grid of heights in the xz plane for colliding with terrain without storing its triangles.
+	// The grid has (cells_x + 1) * (cells_z + 1) vertex heights spaced cell_size apart from the origin, each cell is split into two triangles
+	// along the diagonal from (x + 1, z) to (x, z + 1) matching Component::Terrain's mesh.
+	// The min and max height of each cell is kept in a mip chain, level n covering 2^n x 2^n cells. Ray casts walk the grid with a DDA
+	// starting at the coarsest level and only descend into blocks whose height range the ray passes through, so a ray skimming over the
+	// terrain skips whole blocks. Sphere and AABB queries visit only the cells under their footprint whose height range they overlap.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 7.4.2 Traversal of a Grid (Amanatides-Woo DDA) pg 324
+	// Reference: Maximum Mipmaps for Fast, Accurate, and Scalable Dynamic Height Field Rendering (Tevs, Ihrke, Seidel)
+	class Heightfield
+	{
+	public:
+		// The closest triangle hit by a Ray.
+		struct RayHit
+		{
+			ContactPoint m_contact; // Position on the terrain and the normal of the triangle facing the ray.
+			float m_distance;       // Distance along the ray in multiples of the ray direction.
+		};
+
+		Heightfield() noexcept;
+		//@param p_heights The (p_cells_x + 1) * (p_cells_z + 1) vertex heights, the height of vertex (x, z) at [x * (p_cells_z + 1) + z].
+		Heightfield(size_t p_cells_x, size_t p_cells_z, float p_cell_size, std::vector<float>&& p_heights);
+
+		[[nodiscard]] bool empty() const { return m_heights.empty(); }
+		[[nodiscard]] size_t cells_x() const { return m_cells_x; }
+		[[nodiscard]] size_t cells_z() const { return m_cells_z; }
+		[[nodiscard]] float cell_size() const { return m_cell_size; }
+		// The number of mip levels of min/max heights, level 0 is per cell and the last level is a single block.
+		[[nodiscard]] size_t mip_levels() const { return m_mips.size(); }
+		// The AABB enclosing every vertex. Zero size AABB if empty.
+		[[nodiscard]] AABB get_bound() const;
+		// The height of the terrain surface at (p_x, p_z) or nullopt outside the grid.
+		[[nodiscard]] std::optional<float> get_height(float p_x, float p_z) const;
+		// The two triangles of cell (p_x, p_z).
+		[[nodiscard]] std::array<Triangle, 2> get_cell_triangles(size_t p_x, size_t p_z) const;
+
+		// The closest point p_ray hits the terrain no farther than p_max_distance along it or nullopt if it misses.
+		[[nodiscard]] std::optional<RayHit> raycast(const Ray& p_ray, float p_max_distance = std::numeric_limits<float>::max()) const;
+
+		// Call p_func(const Triangle&) for every triangle intersecting p_AABB.
+		template <typename Func>
+		void query(const AABB& p_AABB, Func&& p_func) const { query_cells(p_AABB, p_AABB, p_func); }
+		// Call p_func(const Triangle&) for every triangle intersecting p_sphere.
+		template <typename Func>
+		void query(const Sphere& p_sphere, Func&& p_func) const { query_cells(AABB(p_sphere.m_center - glm::vec3(p_sphere.m_radius), p_sphere.m_center + glm::vec3(p_sphere.m_radius)), p_sphere, p_func); }
+
+	private:
+		struct HeightRange
+		{
+			float m_min;
+			float m_max;
+		};
+		struct Level
+		{
+			size_t m_blocks_x;
+			size_t m_blocks_z;
+			std::vector<HeightRange> m_ranges; // Index [x * m_blocks_z + z]
+		};
+
+		float height_at(const size_t& p_x, const size_t& p_z) const { return m_heights[p_x * (m_cells_z + 1) + p_z]; }
+		// Walk the blocks of p_level inside [p_min_x, p_max_x] x [p_min_z, p_max_z] crossed by p_ray over [p_t_begin, p_t_end] in order.
+		std::optional<RayHit> raycast_level(const Ray& p_ray, const size_t& p_level, const size_t& p_min_x, const size_t& p_max_x, const size_t& p_min_z, const size_t& p_max_z, float p_t_begin, const float& p_t_end) const;
+
+		// Call p_func for the triangles of the cells under p_footprint, whose height range overlaps it, that intersect p_shape.
+		template <typename Shape, typename Func>
+		void query_cells(const AABB& p_footprint, const Shape& p_shape, Func& p_func) const
+		{
+			if (empty())
+				return;
+
+			const float grid_max_x = static_cast<float>(m_cells_x) * m_cell_size;
+			const float grid_max_z = static_cast<float>(m_cells_z) * m_cell_size;
+			if (p_footprint.m_max.x < 0.f || p_footprint.m_max.z < 0.f || p_footprint.m_min.x > grid_max_x || p_footprint.m_min.z > grid_max_z)
+				return;
+
+			const size_t min_x = static_cast<size_t>(std::max(p_footprint.m_min.x, 0.f) / m_cell_size);
+			const size_t min_z = static_cast<size_t>(std::max(p_footprint.m_min.z, 0.f) / m_cell_size);
+			const size_t max_x = std::min(static_cast<size_t>(std::min(p_footprint.m_max.x, grid_max_x) / m_cell_size), m_cells_x - 1);
+			const size_t max_z = std::min(static_cast<size_t>(std::min(p_footprint.m_max.z, grid_max_z) / m_cell_size), m_cells_z - 1);
+
+			const auto& cells = m_mips.front();
+			for (size_t x = min_x; x <= max_x; x++)
+			{
+				for (size_t z = min_z; z <= max_z; z++)
+				{
+					const auto& range = cells.m_ranges[x * cells.m_blocks_z + z];
+					if (range.m_max < p_footprint.m_min.y || range.m_min > p_footprint.m_max.y)
+						continue;
+
+					for (const auto& triangle : get_cell_triangles(x, z))
+						if (intersecting(p_shape, triangle))
+							p_func(triangle);
+				}
+			}
+		}
+
+		size_t m_cells_x;
+		size_t m_cells_z;
+		float m_cell_size;
+		std::vector<float> m_heights;
+		std::vector<Level> m_mips;
+	};
+} // namespace Geometry
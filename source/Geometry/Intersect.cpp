@@ -1,19 +1,31 @@
 #include "Intersect.hpp"
 
 #include "Geometry/AABB.hpp"
+#include "Geometry/Cone.hpp"
+#include "Geometry/Cuboid.hpp"
+#include "Geometry/Cylinder.hpp"
+#include "Geometry/Frustrum.hpp"
+#include "Geometry/GJK.hpp"
 #include "Geometry/Plane.hpp"
+#include "Geometry/Quad.hpp"
 #include "Geometry/Ray.hpp"
+#include "Geometry/SIMD.hpp"
 #include "Geometry/Sphere.hpp"
 #include "Geometry/Triangle.hpp"
 #include "Utility/Logger.hpp"
 
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
 #include <limits>
 
 // This intersections source file is composed of header definitions as well as cpp-static-functions that are used as helpers for them.
 namespace Geometry
 {
-	static constexpr float Epsilon        = std::numeric_limits<float>::epsilon();
+	static constexpr float Epsilon         = std::numeric_limits<float>::epsilon();
+	static constexpr float Epsilon_Squared = Epsilon * Epsilon; // Compared against squared lengths and distances.
 	// Enabling this adds robustness checks that account for the floating-point margin of error.
 	static constexpr bool  Use_Epsilon_Test = true;
 
@@ -160,6 +172,153 @@ namespace Geometry
 
 		return true;
 	}
+	// The plane of a triangle in the form dot(m_normal, X) + m_d = 0. m_normal is the unnormalised cross product of two edges.
+	struct TrianglePlane
+	{
+		glm::vec3 m_normal;
+		float m_d;
+	};
+	static TrianglePlane triangle_plane(const Triangle& triangle)
+	{
+		const glm::vec3 normal = glm::cross(triangle.m_point_2 - triangle.m_point_1, triangle.m_point_3 - triangle.m_point_1);
+		return {normal, -glm::dot(normal, triangle.m_point_1)};
+	}
+	// The distances of the points of triangle to plane scaled by the length of the plane normal. Distances within Epsilon are snapped onto the plane.
+	static glm::vec3 plane_distances(const TrianglePlane& plane, const Triangle& triangle)
+	{
+		glm::vec3 distances(glm::dot(plane.m_normal, triangle.m_point_1) + plane.m_d, glm::dot(plane.m_normal, triangle.m_point_2) + plane.m_d, glm::dot(plane.m_normal, triangle.m_point_3) + plane.m_d);
+		if constexpr (Use_Epsilon_Test)
+		{
+			for (int i = 0; i < 3; i++)
+				distances[i] = std::abs(distances[i]) < Epsilon ? 0.f : distances[i];
+		}
+		return distances;
+	}
+	// Are all the distances strictly on one side of the plane. Compiles to min and max without branching on each distance.
+	static bool one_side(const glm::vec3& distances)
+	{
+		return std::min({distances[0], distances[1], distances[2]}) > 0.f || std::max({distances[0], distances[1], distances[2]}) < 0.f;
+	}
+	// Möller's interval overlap test with the plane of triangle_1 already computed so batches against the same triangle_1 only compute it once.
+	// Reference: A Fast Triangle-Triangle Intersection Test (Tomas Möller) - https://web.stanford.edu/class/cs277/resources/papers/Moller1997b.pdf
+	// Adapted from: https://github.com/erich666/jgt-code/blob/master/Volume_08/Number_1/Shen2003/tri_tri_test/include/Moller97.c
+	static bool triangle_triangle(const Triangle& triangle_1, const TrianglePlane& plane_1, const Triangle& triangle_2, bool test_co_planar)
+	{
+		// Put triangle_2 into the plane equation of triangle_1. All the same sign and not equal to 0 then no intersection occurs.
+		const glm::vec3 du = plane_distances(plane_1, triangle_2);
+		if (one_side(du))
+			return false;
+
+		// Put triangle_1 into the plane equation of triangle_2.
+		const TrianglePlane plane_2 = triangle_plane(triangle_2);
+		const glm::vec3 dv = plane_distances(plane_2, triangle_1);
+		if (one_side(dv))
+			return false;
+
+		// compute direction of intersection line
+		const glm::vec3 D = glm::cross(plane_1.m_normal, plane_2.m_normal);
+
+		// compute and index to the largest component of D
+		float max = std::abs(D[0]);
+		float b   = std::abs(D[1]);
+		float c   = std::abs(D[2]);
+		int index = 0;
+
+		if (b > max) max = b, index = 1;
+		if (c > max) max = c, index = 2;
+
+		// this is the simplified projection onto L
+		const float vp0 = triangle_1.m_point_1[index];
+		const float vp1 = triangle_1.m_point_2[index];
+		const float vp2 = triangle_1.m_point_3[index];
+
+		const float up0 = triangle_2.m_point_1[index];
+		const float up1 = triangle_2.m_point_2[index];
+		const float up2 = triangle_2.m_point_3[index];
+
+		glm::vec2 isect1;
+		glm::vec2 isect2;
+
+		// compute interval for triangle_1 and triangle_2. If the interval check comes back false
+		// the triangles are coplanar and we can early out by checking for collision between coplanar triangles.
+		if (!compute_intervals(vp0, vp1, vp2, dv[0], dv[1], dv[2], dv[0] * dv[1], dv[0] * dv[2], isect1[0], isect1[1])
+		 || !compute_intervals(up0, up1, up2, du[0], du[1], du[2], du[0] * du[1], du[0] * du[2], isect2[0], isect2[1]))
+			return test_co_planar && coplanar_tri_tri(plane_1.m_normal, triangle_1, triangle_2);
+
+		// Sort so components of isect1 and isect2 are in ascending order.
+		if (isect1[0] > isect1[1])
+			std::swap(isect1[0], isect1[1]);
+		if (isect2[0] > isect2[1])
+			std::swap(isect2[0], isect2[1]);
+
+		return !(isect1[1] < isect2[0] || isect2[1] < isect1[0]);
+	}
+	// The segment along which triangle crosses a plane it straddles given the distances of its points to the plane.
+	// The point alone on its side of the plane is chosen as in compute_intervals, the edges leaving it are cut where they meet the plane.
+	static std::array<glm::vec3, 2> plane_crossing(const Triangle& triangle, const glm::vec3& distances)
+	{
+		const std::array<glm::vec3, 3> points = {triangle.m_point_1, triangle.m_point_2, triangle.m_point_3};
+		const float& D0 = distances[0];
+		const float& D1 = distances[1];
+		const float& D2 = distances[2];
+
+		size_t alone;
+		if (D0 * D1 > 0.f)                  alone = 2;
+		else if (D0 * D2 > 0.f)             alone = 1;
+		else if (D1 * D2 > 0.f || D0 != 0.f) alone = 0;
+		else if (D1 != 0.f)                 alone = 1;
+		else                                alone = 2;
+
+		std::array<glm::vec3, 2> crossing;
+		for (size_t i = 0; i < 2; i++)
+		{
+			const size_t other = (alone + 1 + i) % 3;
+			crossing[i] = points[alone] + (points[other] - points[alone]) * (distances[alone] / (distances[alone] - distances[other]));
+		}
+		return crossing;
+	}
+	// The centre of the overlap of two coplanar triangles, the average of the corners left after clipping triangle_1 by the edges of triangle_2 (Sutherland-Hodgman).
+	// If the triangles only touch and clipping leaves nothing the point on triangle_2 closest to the centroid of triangle_1 is returned.
+	static glm::vec3 coplanar_overlap_center(const Triangle& triangle_1, const Triangle& triangle_2, const glm::vec3& normal)
+	{
+		// Each edge adds at most one corner to a convex polygon. Capacity for doubling on every edge covers polygons made non-convex by rounding.
+		std::array<glm::vec3, 24> polygon = {triangle_1.m_point_1, triangle_1.m_point_2, triangle_1.m_point_3};
+		std::array<glm::vec3, 24> clipped;
+		size_t count = 3;
+
+		const std::array<glm::vec3, 3> edge_points = {triangle_2.m_point_1, triangle_2.m_point_2, triangle_2.m_point_3};
+		for (size_t edge = 0; edge < 3 && count > 0; edge++)
+		{
+			const glm::vec3& start = edge_points[edge];
+			glm::vec3 inward       = glm::cross(normal, edge_points[(edge + 1) % 3] - start);
+			if (glm::dot(inward, edge_points[(edge + 2) % 3] - start) < 0.f)
+				inward = -inward;
+
+			size_t clipped_count = 0;
+			for (size_t i = 0; i < count; i++)
+			{
+				const glm::vec3& p = polygon[i];
+				const glm::vec3& q = polygon[(i + 1) % count];
+				const float p_distance = glm::dot(inward, p - start);
+				const float q_distance = glm::dot(inward, q - start);
+				if (p_distance >= 0.f)
+					clipped[clipped_count++] = p;
+				// A corner on the edge is kept and is the crossing itself, only a strict change of side adds a corner.
+				if ((p_distance > 0.f && q_distance < 0.f) || (p_distance < 0.f && q_distance > 0.f))
+					clipped[clipped_count++] = p + (q - p) * (p_distance / (p_distance - q_distance));
+			}
+			polygon = clipped;
+			count   = clipped_count;
+		}
+
+		if (count == 0)
+			return closest_point(triangle_2, triangle_1.centroid());
+
+		glm::vec3 sum(0.f);
+		for (size_t i = 0; i < count; i++)
+			sum += polygon[i];
+		return sum / static_cast<float>(count);
+	}
 	bool point_inside(const AABB& AABB, const glm::vec3& point)
 	{
 		return (point.x >= AABB.m_min.x && point.x <= AABB.m_max.x
@@ -258,6 +417,325 @@ namespace Geometry
 		float dot_AB_AP = glm::dot(AB, AP);
 		return dot_AB_AP >= 0.0f;
 	}
+	// Separating axis test between an AABB and a triangle. Tests the 3 AABB face normals, the triangle normal and the 9 cross products
+	// of the AABB and triangle edges, the shapes overlap if none of the 13 axes separate them.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 5.2.9 Testing AABB Against Triangle pg 169
+	//@param contact If not nullptr, set to the axis of least overlap from the perspective of the AABB when overlapping.
+	//@return True if the AABB and triangle overlap.
+	static bool AABB_triangle_SAT(const AABB& AABB, const Triangle& triangle, ContactPoint* contact)
+	{
+		// Move the AABB to the origin so its projection onto every axis is centered on 0.
+		const glm::vec3 center  = AABB.get_center();
+		const glm::vec3 extents = AABB.get_size() * 0.5f;
+		const glm::vec3 v0      = triangle.m_point_1 - center;
+		const glm::vec3 v1      = triangle.m_point_2 - center;
+		const glm::vec3 v2      = triangle.m_point_3 - center;
+		const glm::vec3 edges[3] = {v1 - v0, v2 - v1, v0 - v2};
+
+		float least_overlap = std::numeric_limits<float>::max();
+		glm::vec3 least_overlap_normal{0.f};
+		auto separated_on = [&](const glm::vec3& axis)
+		{
+			const float length_squared = glm::dot(axis, axis);
+			if (length_squared < Epsilon_Squared) // Parallel edges, the axis is covered by the face normals.
+				return false;
+
+			const float r  = extents.x * std::abs(axis.x) + extents.y * std::abs(axis.y) + extents.z * std::abs(axis.z);
+			const float p0 = glm::dot(v0, axis);
+			const float p1 = glm::dot(v1, axis);
+			const float p2 = glm::dot(v2, axis);
+			const float triangle_min = std::min({p0, p1, p2});
+			const float triangle_max = std::max({p0, p1, p2});
+			if (triangle_min > r || triangle_max < -r)
+				return true;
+
+			if (contact)
+			{
+				// Distance the AABB moves along +axis or -axis to clear the triangle.
+				const float length = std::sqrt(length_squared);
+				const float positive_overlap = (triangle_max + r) / length;
+				const float negative_overlap = (r - triangle_min) / length;
+				if (std::min(positive_overlap, negative_overlap) < least_overlap)
+				{
+					least_overlap        = std::min(positive_overlap, negative_overlap);
+					least_overlap_normal = (positive_overlap < negative_overlap ? axis : -axis) / length;
+				}
+			}
+			return false;
+		};
+
+		for (const auto& edge : edges)
+		{
+			if (separated_on(glm::vec3(0.f, -edge.z, edge.y)) // cross(x, edge)
+			 || separated_on(glm::vec3(edge.z, 0.f, -edge.x)) // cross(y, edge)
+			 || separated_on(glm::vec3(-edge.y, edge.x, 0.f))) // cross(z, edge)
+				return false;
+		}
+		if (separated_on(glm::vec3(1.f, 0.f, 0.f)) || separated_on(glm::vec3(0.f, 1.f, 0.f)) || separated_on(glm::vec3(0.f, 0.f, 1.f))
+		 || separated_on(glm::cross(edges[0], edges[1])))
+			return false;
+
+		if (contact)
+		{
+			// The point of the AABB deepest along the normal into the triangle.
+			const auto& n = least_overlap_normal;
+			contact->normal            = n;
+			contact->position          = center - glm::vec3(n.x > 0.f ? extents.x : n.x < 0.f ? -extents.x : 0.f,
+			                                                n.y > 0.f ? extents.y : n.y < 0.f ? -extents.y : 0.f,
+			                                                n.z > 0.f ? extents.z : n.z < 0.f ? -extents.z : 0.f);
+			contact->penetration_depth = least_overlap;
+		}
+		return true;
+	}
+
+	namespace
+	{
+		// A Line, Ray or LineSegment as the points m_start + m_direction * t for t in [m_min, m_max].
+		// Lines are unbounded, Rays bounded to [0, inf) and LineSegments to [0, 1] so one function can test all three.
+		struct ParametricLine
+		{
+			glm::vec3 m_start;
+			glm::vec3 m_direction;
+			float m_min;
+			float m_max;
+		};
+	}
+	static constexpr float Infinity = std::numeric_limits<float>::infinity();
+	static ParametricLine to_parametric(const Line& line)               { return {line.m_point_1, line.m_point_2 - line.m_point_1, -Infinity, Infinity}; }
+	static ParametricLine to_parametric(const Ray& ray)                 { return {ray.m_start, ray.m_direction, 0.f, Infinity}; }
+	static ParametricLine to_parametric(const LineSegment& lineSegment) { return {lineSegment.m_start, lineSegment.m_end - lineSegment.m_start, 0.f, 1.f}; }
+
+	// Squared distance between the closest points of point and line.
+	static float distance_squared(const ParametricLine& line, const glm::vec3& point)
+	{
+		const float length_squared = glm::dot(line.m_direction, line.m_direction);
+		const float t = length_squared > Epsilon_Squared ? glm::dot(point - line.m_start, line.m_direction) / length_squared : 0.f;
+		const glm::vec3 displacement = point - (line.m_start + line.m_direction * std::clamp(t, line.m_min, line.m_max));
+		return glm::dot(displacement, displacement);
+	}
+	// Squared distance between the closest points of line_1 and line_2.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 5.1.9 Closest Points of Two Line Segments pg 148
+	// The parameters are clamped to [m_min, m_max] of each line rather than the [0, 1] of a segment.
+	static float distance_squared(const ParametricLine& line_1, const ParametricLine& line_2)
+	{
+		const glm::vec3 r = line_1.m_start - line_2.m_start;
+		const float a     = glm::dot(line_1.m_direction, line_1.m_direction);
+		const float e     = glm::dot(line_2.m_direction, line_2.m_direction);
+		const float f     = glm::dot(line_2.m_direction, r);
+
+		float s = std::clamp(0.f, line_1.m_min, line_1.m_max);
+		float t = std::clamp(0.f, line_2.m_min, line_2.m_max);
+		if (a <= Epsilon_Squared && e <= Epsilon_Squared)
+		{} // Both lines degenerate into points.
+		else if (a <= Epsilon_Squared)
+			t = std::clamp(f / e, line_2.m_min, line_2.m_max); // line_1 degenerates into a point.
+		else
+		{
+			const float c = glm::dot(line_1.m_direction, r);
+			if (e <= Epsilon_Squared)
+				s = std::clamp(-c / a, line_1.m_min, line_1.m_max); // line_2 degenerates into a point.
+			else
+			{
+				// The closest point on line_1 to line_2. Every s is equally close for parallel lines so s is left at the start of line_1.
+				const float b     = glm::dot(line_1.m_direction, line_2.m_direction);
+				const float denom = a * e - b * b;
+				if (denom > Epsilon * a * e)
+					s = std::clamp((b * f - c * e) / denom, line_1.m_min, line_1.m_max);
+
+				// The closest point on line_2 to s. If it's clamped, s is recomputed as the closest point on line_1 to the clamped t.
+				t = (b * s + f) / e;
+				if (t < line_2.m_min || t > line_2.m_max)
+				{
+					t = std::clamp(t, line_2.m_min, line_2.m_max);
+					s = std::clamp((t * b - c) / a, line_1.m_min, line_1.m_max);
+				}
+			}
+		}
+
+		const glm::vec3 displacement = (line_1.m_start + line_1.m_direction * s) - (line_2.m_start + line_2.m_direction * t);
+		return glm::dot(displacement, displacement);
+	}
+	// Adapted from: Real-Time Collision Detection (Christer Ericson) - 5.3.3 Intersecting Ray or Segment Against Box pg 180
+	// Clip [m_min, m_max] of line to the 3 slabs of the AABB, the line intersects the AABB if part of it is inside all 3.
+	static bool intersecting(const AABB& AABB, const ParametricLine& line)
+	{
+		float entry = line.m_min;
+		float exit  = line.m_max;
+		for (int i = 0; i < 3; i++)
+		{
+			if (std::abs(line.m_direction[i]) < Epsilon)
+			{
+				// Line is parallel to slab. No hit if the start is not within the slab.
+				if (line.m_start[i] < AABB.m_min[i] || line.m_start[i] > AABB.m_max[i])
+					return false;
+			}
+			else
+			{
+				const float ood  = 1.f / line.m_direction[i];
+				float slab_entry = (AABB.m_min[i] - line.m_start[i]) * ood;
+				float slab_exit  = (AABB.m_max[i] - line.m_start[i]) * ood;
+				if (slab_entry > slab_exit)
+					std::swap(slab_entry, slab_exit);
+
+				entry = std::max(entry, slab_entry);
+				exit  = std::min(exit, slab_exit);
+				if (entry > exit)
+					return false;
+			}
+		}
+		return true;
+	}
+	// Reference: Fast, Minimum Storage Ray/Triangle Intersection (Tomas Moller, Ben Trumbore)
+	// As get_intersection(Ray, Triangle) with t limited to [m_min, m_max]. Lines parallel to the triangle only touch it if they lie in its plane,
+	// then they either cross an edge or are inside the triangle.
+	static bool intersecting(const Triangle& triangle, const ParametricLine& line)
+	{
+		const glm::vec3 edge_1  = triangle.m_point_2 - triangle.m_point_1;
+		const glm::vec3 edge_2  = triangle.m_point_3 - triangle.m_point_1;
+		const glm::vec3 p       = glm::cross(line.m_direction, edge_2);
+		const float determinant = glm::dot(edge_1, p);
+		if (std::abs(determinant) < Epsilon)
+		{
+			for (const auto& edge : {LineSegment(triangle.m_point_1, triangle.m_point_2), LineSegment(triangle.m_point_2, triangle.m_point_3), LineSegment(triangle.m_point_3, triangle.m_point_1)})
+				if (distance_squared(line, to_parametric(edge)) <= Epsilon_Squared)
+					return true;
+
+			const glm::vec3 start        = line.m_start + line.m_direction * std::clamp(0.f, line.m_min, line.m_max);
+			const glm::vec3 displacement = start - closest_point(triangle, start);
+			return glm::dot(displacement, displacement) <= Epsilon_Squared;
+		}
+
+		const float inverse_determinant = 1.f / determinant;
+		const glm::vec3 s = line.m_start - triangle.m_point_1;
+		const float u     = glm::dot(s, p) * inverse_determinant;
+		if (u < 0.f || u > 1.f)
+			return false;
+
+		const glm::vec3 q = glm::cross(s, edge_1);
+		const float v     = glm::dot(line.m_direction, q) * inverse_determinant;
+		if (v < 0.f || u + v > 1.f)
+			return false;
+
+		const float t = glm::dot(edge_2, q) * inverse_determinant;
+		return t >= line.m_min && t <= line.m_max;
+	}
+	// The part of line inside sphere or std::nullopt if it misses the sphere.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 5.3.2 Intersecting Ray or Segment Against Sphere pg 177
+	static std::optional<LineSegment> clip(const ParametricLine& line, const Sphere& sphere)
+	{
+		const glm::vec3 m = line.m_start - sphere.m_center;
+		const float a     = glm::dot(line.m_direction, line.m_direction);
+		const float b     = glm::dot(m, line.m_direction);
+		const float c     = glm::dot(m, m) - sphere.m_radius * sphere.m_radius;
+		if (a <= Epsilon_Squared) // Line degenerates into a point.
+			return c <= 0.f ? std::optional<LineSegment>(LineSegment(line.m_start, line.m_start)) : std::nullopt;
+
+		const float discriminant = b * b - a * c;
+		if (discriminant < 0.f)
+			return std::nullopt;
+
+		const float root  = std::sqrt(discriminant);
+		const float entry = std::max((-b - root) / a, line.m_min);
+		const float exit  = std::min((-b + root) / a, line.m_max);
+		if (entry > exit)
+			return std::nullopt;
+
+		return LineSegment(line.m_start + line.m_direction * entry, line.m_start + line.m_direction * exit);
+	}
+
+	// A sphere enclosing the shape. Pairs tested with GJK are culled by their bounding spheres first.
+	static Sphere bounding_sphere(const Cone& cone)
+	{
+		const glm::vec3 half_axis = (cone.m_top - cone.m_base) * 0.5f;
+		return Sphere(cone.m_base + half_axis, std::sqrt(glm::dot(half_axis, half_axis) + cone.m_base_radius * cone.m_base_radius));
+	}
+	static Sphere bounding_sphere(const Cuboid& cuboid)
+	{
+		return Sphere(cuboid.m_position, glm::length(cuboid.m_scale) * 0.5f);
+	}
+	static Sphere bounding_sphere(const Cylinder& cylinder)
+	{
+		const glm::vec3 half_axis = (cylinder.m_top - cylinder.m_base) * 0.5f;
+		return Sphere(cylinder.m_base + half_axis, std::sqrt(glm::dot(half_axis, half_axis) + cylinder.m_radius * cylinder.m_radius));
+	}
+	static Sphere bounding_sphere(const LineSegment& lineSegment)
+	{
+		return Sphere((lineSegment.m_start + lineSegment.m_end) * 0.5f, glm::distance(lineSegment.m_start, lineSegment.m_end) * 0.5f);
+	}
+	static Sphere bounding_sphere(const Quad& quad)
+	{
+		const glm::vec3 center = quad.center();
+		return Sphere(center, std::max({glm::distance(center, quad.m_point_1), glm::distance(center, quad.m_point_2), glm::distance(center, quad.m_point_3), glm::distance(center, quad.m_point_4)}));
+	}
+	static Sphere bounding_sphere(const Sphere& sphere)
+	{
+		return sphere;
+	}
+	static Sphere bounding_sphere(const Triangle& triangle)
+	{
+		const glm::vec3 center = triangle.centroid();
+		return Sphere(center, std::max({glm::distance(center, triangle.m_point_1), glm::distance(center, triangle.m_point_2), glm::distance(center, triangle.m_point_3)}));
+	}
+	// Are two convex shapes overlapping, for pairs without a closed form test. Uses the GJK algorithm once the bounding spheres overlap.
+	template <typename Shape_A, typename Shape_B>
+	static bool intersecting_GJK(const Shape_A& shape_A, const Shape_B& shape_B)
+	{
+		if (!intersecting(bounding_sphere(shape_A), bounding_sphere(shape_B)))
+			return false;
+
+		const Shape convex_A(shape_A);
+		const Shape convex_B(shape_B);
+		const glm::mat3 identity(1.f);
+		return intersecting(ConvexShape{convex_A, identity, glm::vec3(0.f)}, ConvexShape{convex_B, identity, glm::vec3(0.f)});
+	}
+	// As intersecting_GJK for an unbounded Line or Ray, GJK tests the part of the line inside the bounding sphere of shape.
+	template <typename Shape_A>
+	static bool intersecting_GJK(const Shape_A& shape, const ParametricLine& line)
+	{
+		const auto clipped = clip(line, bounding_sphere(shape));
+		return clipped && intersecting_GJK(shape, *clipped);
+	}
+
+	// Signed distance of point from plane, positive on the side plane.m_normal points to.
+	static float signed_distance(const Plane& plane, const glm::vec3& point)
+	{
+		return glm::dot(plane.m_normal, point) - plane.m_distance;
+	}
+	// Do points lie on both sides of plane or on it. A polygon or segment with these vertices intersects the plane.
+	static bool straddling(const Plane& plane, std::initializer_list<glm::vec3> points)
+	{
+		float min = Infinity;
+		float max = -Infinity;
+		for (const auto& point : points)
+		{
+			const float distance = signed_distance(plane, point);
+			min = std::min(min, distance);
+			max = std::max(max, distance);
+		}
+		return min <= 0.f && max >= 0.f;
+	}
+
+	// The Cuboid as an AABB in its local space, centered on the origin with no rotation.
+	static AABB local_AABB(const Cuboid& cuboid)
+	{
+		return AABB(cuboid.m_scale * -0.5f, cuboid.m_scale * 0.5f);
+	}
+	static glm::vec3 to_local(const Cuboid& cuboid, const glm::vec3& point)
+	{
+		return glm::conjugate(cuboid.m_rotation) * (point - cuboid.m_position);
+	}
+	static Triangle to_local(const Cuboid& cuboid, const Triangle& triangle)
+	{
+		return Triangle(to_local(cuboid, triangle.m_point_1), to_local(cuboid, triangle.m_point_2), to_local(cuboid, triangle.m_point_3));
+	}
+	static ParametricLine to_local(const Cuboid& cuboid, const ParametricLine& line)
+	{
+		return {to_local(cuboid, line.m_start), glm::conjugate(cuboid.m_rotation) * line.m_direction, line.m_min, line.m_max};
+	}
+	static Cuboid to_cuboid(const AABB& AABB)
+	{
+		return Cuboid(AABB.get_center(), AABB.get_size());
+	}
 // ==============================================================================================================================
 // END UTILITIY FUNCTIONS
 // ==============================================================================================================================
@@ -291,6 +769,58 @@ namespace Geometry
 		else         return ray.m_start + (ab * t);
 
 	}
+	glm::vec3 closest_point(const Triangle& triangle, const glm::vec3& point)
+	{
+		// Reference: Real-Time Collision Detection (Christer Ericson) - 5.1.5 Closest Point on Triangle to Point pg 141
+		// Find which Voronoi region of the triangle (vertex, edge or face) point is in and project onto that feature.
+		const glm::vec3& a = triangle.m_point_1;
+		const glm::vec3& b = triangle.m_point_2;
+		const glm::vec3& c = triangle.m_point_3;
+		const glm::vec3 ab = b - a;
+		const glm::vec3 ac = c - a;
+
+		const glm::vec3 ap = point - a;
+		const float d1 = glm::dot(ab, ap);
+		const float d2 = glm::dot(ac, ap);
+		if (d1 <= 0.f && d2 <= 0.f)
+			return a; // Vertex region A
+
+		const glm::vec3 bp = point - b;
+		const float d3 = glm::dot(ab, bp);
+		const float d4 = glm::dot(ac, bp);
+		if (d3 >= 0.f && d4 <= d3)
+			return b; // Vertex region B
+
+		const float vc = d1 * d4 - d3 * d2;
+		if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+			return a + ab * (d1 / (d1 - d3)); // Edge region AB
+
+		const glm::vec3 cp = point - c;
+		const float d5 = glm::dot(ab, cp);
+		const float d6 = glm::dot(ac, cp);
+		if (d6 >= 0.f && d5 <= d6)
+			return c; // Vertex region C
+
+		const float vb = d5 * d2 - d1 * d6;
+		if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+			return a + ac * (d2 / (d2 - d6)); // Edge region AC
+
+		const float va = d3 * d6 - d5 * d4;
+		if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+			return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))); // Edge region BC
+
+		// Face region, the barycentric coordinates (u, v, w) of the projection of point onto the triangle.
+		const float denom = 1.f / (va + vb + vc);
+		const float v     = vb * denom;
+		const float w     = vc * denom;
+		return a + ab * v + ac * w;
+	}
+	float distance_squared(const AABB& AABB, const glm::vec3& point)
+	{
+		// Reference: Real-Time Collision Detection (Christer Ericson) - 5.1.3.1 Distance of Point to AABB pg 131
+		const glm::vec3 displacement = point - glm::clamp(point, AABB.m_min, AABB.m_max);
+		return glm::dot(displacement, displacement);
+	}
 	float distance_squared(const LineSegment& line, const glm::vec3& point)
 	{
 		auto AB = line.m_end - line.m_start;
@@ -317,6 +847,31 @@ namespace Geometry
 	}
 
 
+	std::optional<ContactPoint> get_intersection(const AABB& AABB_1, const AABB& AABB_2)
+	{
+		// The AABBs are separated along the axis of least overlap. The normal points along that axis from AABB_2 towards AABB_1.
+		const glm::vec3 overlap_min = glm::max(AABB_1.m_min, AABB_2.m_min);
+		const glm::vec3 overlap_max = glm::min(AABB_1.m_max, AABB_2.m_max);
+		const glm::vec3 overlap     = overlap_max - overlap_min;
+
+		if (overlap.x < 0.f || overlap.y < 0.f || overlap.z < 0.f)
+			return std::nullopt;
+
+		int axis = 0;
+		if (overlap[1] < overlap[axis]) axis = 1;
+		if (overlap[2] < overlap[axis]) axis = 2;
+
+		const bool AABB_1_above = AABB_1.get_center()[axis] >= AABB_2.get_center()[axis];
+
+		ContactPoint point;
+		point.normal            = glm::vec3(0.f);
+		point.normal[axis]      = AABB_1_above ? 1.f : -1.f;
+		point.penetration_depth = overlap[axis];
+		// The center of the overlapping region on the face of AABB_1 touching AABB_2.
+		point.position          = (overlap_min + overlap_max) * 0.5f;
+		point.position[axis]    = AABB_1_above ? AABB_1.m_min[axis] : AABB_1.m_max[axis];
+		return point;
+	}
 	std::optional<ContactPoint> get_intersection(const AABB& AABB, const Ray& ray, float* distance_along_ray)
 	{
 		// Adapted from: Real-Time Collision Detection (Christer Ericson) - 5.3.3 Intersecting Ray or Segment Against Box pg 180
@@ -380,6 +935,14 @@ namespace Geometry
 		point.penetration_depth = 0;
 		return point;
 	}
+	std::optional<ContactPoint> get_intersection(const AABB& AABB, const Triangle& triangle)
+	{
+		ContactPoint point;
+		if (AABB_triangle_SAT(AABB, triangle, &point))
+			return point;
+		else
+			return std::nullopt;
+	}
 	std::optional<ContactPoint> get_intersection(const Line& line, const Triangle& triangle)
 	{
 		// Identical to the above function but uses u, v, w to determine the intersection point to return.
@@ -472,6 +1035,44 @@ namespace Geometry
 		else
 			return plane_1.m_distance * u + glm::cross(plane_1.m_normal, plane_3.m_distance * plane_2.m_normal - plane_2.m_distance * plane_3.m_normal) / denom;
 	}
+	std::optional<ContactPoint> get_intersection(const Ray& ray, const Triangle& triangle, float* distance_along_ray)
+	{
+		// Reference: Fast, Minimum Storage Ray/Triangle Intersection (Tomas Moller, Ben Trumbore)
+		// Solve start + t * direction = (1 - u - v) * point_1 + u * point_2 + v * point_3 for the distance t and barycentric coordinates (u, v)
+		// using Cramer's rule. The ray hits if (u, v) is inside the triangle and t is in front of the start. Hits either side of the triangle.
+		const glm::vec3 edge_1 = triangle.m_point_2 - triangle.m_point_1;
+		const glm::vec3 edge_2 = triangle.m_point_3 - triangle.m_point_1;
+		const glm::vec3 p      = glm::cross(ray.m_direction, edge_2);
+		const float determinant = glm::dot(edge_1, p);
+		if (std::abs(determinant) < Epsilon) // Ray is parallel to the triangle.
+			return std::nullopt;
+
+		const float inverse_determinant = 1.f / determinant;
+		const glm::vec3 s = ray.m_start - triangle.m_point_1;
+		const float u     = glm::dot(s, p) * inverse_determinant;
+		if (u < 0.f || u > 1.f)
+			return std::nullopt;
+
+		const glm::vec3 q = glm::cross(s, edge_1);
+		const float v     = glm::dot(ray.m_direction, q) * inverse_determinant;
+		if (v < 0.f || u + v > 1.f)
+			return std::nullopt;
+
+		const float t = glm::dot(edge_2, q) * inverse_determinant;
+		if (t < 0.f)
+			return std::nullopt;
+
+		if (distance_along_ray)
+			*distance_along_ray = t;
+
+		// The normal of the side of the triangle facing the ray.
+		const glm::vec3 normal = glm::normalize(glm::cross(edge_1, edge_2));
+		ContactPoint point;
+		point.normal            = glm::dot(normal, ray.m_direction) > 0.f ? -normal : normal;
+		point.position          = ray.m_start + (ray.m_direction * t);
+		point.penetration_depth = 0;
+		return point;
+	}
 	std::optional<ContactPoint> get_intersection(const Sphere& sphere_1, const Sphere& sphere_2)
 	{
 		// Compute the displacement, or the distance between the two spheres
@@ -499,6 +1100,94 @@ namespace Geometry
 		else
 			return std::nullopt;
 	}
+	std::optional<ContactPoint> get_intersection(const Sphere& sphere, const Triangle& triangle)
+	{
+		// The sphere overlaps the triangle if the closest point on the triangle to the sphere center is inside the sphere.
+		const glm::vec3 closest      = closest_point(triangle, sphere.m_center);
+		const glm::vec3 displacement = sphere.m_center - closest;
+		const float distance_squared = glm::dot(displacement, displacement);
+		if (distance_squared > sphere.m_radius * sphere.m_radius)
+			return std::nullopt;
+
+		// If the sphere center is on the triangle the normal is arbitrary, we choose the triangle normal.
+		const float distance   = std::sqrt(distance_squared);
+		const glm::vec3 normal = distance == 0.f ? triangle.normal() : displacement / distance;
+
+		ContactPoint point;
+		point.normal            = normal;
+		point.position          = sphere.m_center - normal * sphere.m_radius;
+		point.penetration_depth = sphere.m_radius - distance;
+		return point;
+	}
+	std::optional<ContactPoint> get_intersection(const Triangle& triangle_1, const Triangle& triangle_2, bool test_co_planar)
+	{
+		// Reject with the plane tests of intersecting. A triangle straddling the plane of the other crosses it along a segment of the line
+		// where the planes meet, the overlap of the two segments is where the triangles intersect.
+		const TrianglePlane plane_1 = triangle_plane(triangle_1);
+		const glm::vec3 du          = plane_distances(plane_1, triangle_2);
+		if (one_side(du))
+			return std::nullopt;
+
+		const TrianglePlane plane_2 = triangle_plane(triangle_2);
+		const glm::vec3 dv          = plane_distances(plane_2, triangle_1);
+		if (one_side(dv))
+			return std::nullopt;
+
+		const float length_1 = glm::length(plane_1.m_normal);
+		const float length_2 = glm::length(plane_2.m_normal);
+
+		// Coplanar (or degenerate) triangles touch without depth, we choose the normal of triangle_2 and the centre of the overlap.
+		if (du == glm::vec3(0.f) || dv == glm::vec3(0.f))
+		{
+			if (!test_co_planar || !coplanar_tri_tri(plane_1.m_normal, triangle_1, triangle_2))
+				return std::nullopt;
+
+			ContactPoint point;
+			point.normal   = length_2 > 0.f ? plane_2.m_normal / length_2 : length_1 > 0.f ? plane_1.m_normal / length_1 : glm::vec3(0.f);
+			point.position = coplanar_overlap_center(triangle_1, triangle_2, length_2 > 0.f ? plane_2.m_normal : plane_1.m_normal);
+			return point;
+		}
+
+		const glm::vec3 direction    = glm::cross(plane_1.m_normal, plane_2.m_normal);
+		std::array<glm::vec3, 2> segment_1 = plane_crossing(triangle_1, dv);
+		std::array<glm::vec3, 2> segment_2 = plane_crossing(triangle_2, du);
+		std::array<float, 2> interval_1    = {glm::dot(direction, segment_1[0]), glm::dot(direction, segment_1[1])};
+		std::array<float, 2> interval_2    = {glm::dot(direction, segment_2[0]), glm::dot(direction, segment_2[1])};
+		if (interval_1[0] > interval_1[1])
+		{
+			std::swap(interval_1[0], interval_1[1]);
+			std::swap(segment_1[0], segment_1[1]);
+		}
+		if (interval_2[0] > interval_2[1])
+		{
+			std::swap(interval_2[0], interval_2[1]);
+			std::swap(segment_2[0], segment_2[1]);
+		}
+		if (interval_1[1] < interval_2[0] || interval_2[1] < interval_1[0])
+			return std::nullopt;
+
+		const glm::vec3& overlap_start = interval_1[0] > interval_2[0] ? segment_1[0] : segment_2[0];
+		const glm::vec3& overlap_end   = interval_1[1] < interval_2[1] ? segment_1[1] : segment_2[1];
+
+		// Separate along whichever triangle normal needs the least movement. Either triangle_1 is moved clear of the plane of triangle_2 or
+		// triangle_2 is moved clear of the plane of triangle_1, the latter moves triangle_1 the opposite way relative to triangle_2.
+		const glm::vec3 normal_1 = plane_1.m_normal / length_1;
+		const glm::vec3 normal_2 = plane_2.m_normal / length_2;
+		const std::array<std::pair<glm::vec3, float>, 4> separations =
+		{{
+			{ normal_2, -std::min({dv[0], dv[1], dv[2]}) / length_2},
+			{-normal_2,  std::max({dv[0], dv[1], dv[2]}) / length_2},
+			{-normal_1, -std::min({du[0], du[1], du[2]}) / length_1},
+			{ normal_1,  std::max({du[0], du[1], du[2]}) / length_1}
+		}};
+		const auto& separation = *std::min_element(separations.begin(), separations.end(), [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+
+		ContactPoint point;
+		point.position          = (overlap_start + overlap_end) * 0.5f;
+		point.normal            = separation.first;
+		point.penetration_depth = separation.second;
+		return point;
+	}
 	bool intersecting(const AABB& AABB_1, const AABB& AABB_2)
 	{
 		// Reference: Real-Time Collision Detection (Christer Ericson)
@@ -510,6 +1199,25 @@ namespace Geometry
 		else
 			return true;
 	}
+	bool intersecting(const AABB& AABB, const Frustrum& frustrum)
+	{
+		// Reference: Real-Time Collision Detection (Christer Ericson) - 5.2.3 Testing Box Against Plane pg 161
+		// For each plane, test the corner of the AABB farthest along the plane normal (the positive vertex). If the positive vertex is
+		// behind any plane the AABB is entirely outside the frustrum. The test is conservative, AABBs outside the frustrum near its
+		// edges but not fully behind a single plane are reported as intersecting.
+		for (const Plane* plane : {&frustrum.m_left, &frustrum.m_right, &frustrum.m_bottom, &frustrum.m_top, &frustrum.m_near, &frustrum.m_far})
+		{
+			const glm::vec3 positive_vertex = glm::vec3(
+				plane->m_normal.x >= 0.f ? AABB.m_max.x : AABB.m_min.x,
+				plane->m_normal.y >= 0.f ? AABB.m_max.y : AABB.m_min.y,
+				plane->m_normal.z >= 0.f ? AABB.m_max.z : AABB.m_min.z);
+
+			// Frustrum planes are in the form n·x + d = 0 with the normal pointing inside.
+			if (glm::dot(plane->m_normal, positive_vertex) + plane->m_distance < 0.f)
+				return false;
+		}
+		return true;
+	}
 	bool intersecting(const AABB& AABB, const Ray& ray)
 	{
 		// Adapted from: Real-Time Collision Detection (Christer Ericson) - 5.3.3 Intersecting Ray or Segment Against Box pg 180
@@ -566,6 +1274,273 @@ namespace Geometry
 		// Ray intersects all 3 slabs.
 		return true;
 	}
+	bool intersecting(const AABB& AABB, const Sphere& sphere)
+	{
+		// Reference: Real-Time Collision Detection (Christer Ericson) - 5.2.5 Testing Sphere Against AABB pg 165
+		// The sphere overlaps the AABB if the closest point in the AABB to the sphere center is inside the sphere.
+		const glm::vec3 displacement = sphere.m_center - glm::clamp(sphere.m_center, AABB.m_min, AABB.m_max);
+		return glm::dot(displacement, displacement) <= sphere.m_radius * sphere.m_radius;
+	}
+	bool intersecting(const AABB& AABB, const Triangle& triangle)
+	{
+		return AABB_triangle_SAT(AABB, triangle, nullptr);
+	}
+	bool intersecting(const AABB& AABB, const Cone& cone)
+	{
+		return intersecting_GJK(to_cuboid(AABB), cone);
+	}
+	bool intersecting(const AABB& AABB, const Cuboid& cuboid)
+	{
+		return intersecting(to_cuboid(AABB), cuboid);
+	}
+	bool intersecting(const AABB& AABB, const Cylinder& cylinder)
+	{
+		return intersecting_GJK(to_cuboid(AABB), cylinder);
+	}
+	bool intersecting(const AABB& AABB, const Line& line)
+	{
+		return intersecting(AABB, to_parametric(line));
+	}
+	bool intersecting(const AABB& AABB, const LineSegment& lineSegment)
+	{
+		return intersecting(AABB, to_parametric(lineSegment));
+	}
+	bool intersecting(const AABB& AABB, const Plane& plane)
+	{
+		// Reference: Real-Time Collision Detection (Christer Ericson) - 5.2.3 Testing Box Against Plane pg 161
+		// The AABB intersects the plane if its center is within the projection radius of its extents onto the plane normal.
+		const glm::vec3 extents = AABB.get_size() * 0.5f;
+		const float radius      = glm::dot(extents, glm::abs(plane.m_normal));
+		return std::abs(signed_distance(plane, AABB.get_center())) <= radius;
+	}
+	bool intersecting(const AABB& AABB, const Quad& quad)
+	{
+		const auto triangles = quad.get_triangles();
+		return intersecting(AABB, triangles[0]) || intersecting(AABB, triangles[1]);
+	}
+	bool intersecting(const Cone& cone_1, const Cone& cone_2)
+	{
+		return intersecting_GJK(cone_1, cone_2);
+	}
+	bool intersecting(const Cone& cone, const Cuboid& cuboid)
+	{
+		return intersecting_GJK(cone, cuboid);
+	}
+	bool intersecting(const Cone& cone, const Cylinder& cylinder)
+	{
+		return intersecting_GJK(cone, cylinder);
+	}
+	bool intersecting(const Cone& cone, const Line& line)
+	{
+		return intersecting_GJK(cone, to_parametric(line));
+	}
+	bool intersecting(const Cone& cone, const LineSegment& lineSegment)
+	{
+		return intersecting_GJK(cone, lineSegment);
+	}
+	bool intersecting(const Cone& cone, const Plane& plane)
+	{
+		// The signed distances of the cone from the plane are bounded by the apex and the points of the base rim farthest either side of the plane.
+		// The rim extends from the base center by the radius scaled by the sine of the angle between the axis and the plane normal.
+		const glm::vec3 axis  = glm::normalize(cone.m_top - cone.m_base);
+		const float cosine    = glm::dot(axis, plane.m_normal);
+		const float rim       = cone.m_base_radius * std::sqrt(std::max(0.f, 1.f - cosine * cosine));
+		const float apex      = signed_distance(plane, cone.m_top);
+		const float base      = signed_distance(plane, cone.m_base);
+		return std::min(apex, base - rim) <= 0.f && std::max(apex, base + rim) >= 0.f;
+	}
+	bool intersecting(const Cone& cone, const Quad& quad)
+	{
+		return intersecting_GJK(cone, quad);
+	}
+	bool intersecting(const Cone& cone, const Ray& ray)
+	{
+		return intersecting_GJK(cone, to_parametric(ray));
+	}
+	bool intersecting(const Cone& cone, const Sphere& sphere)
+	{
+		return intersecting_GJK(cone, sphere);
+	}
+	bool intersecting(const Cone& cone, const Triangle& triangle)
+	{
+		return intersecting_GJK(cone, triangle);
+	}
+	bool intersecting(const Cuboid& cuboid_1, const Cuboid& cuboid_2)
+	{
+		// Reference: Real-Time Collision Detection (Christer Ericson) - 4.4.1 OBB-OBB Intersection pg 101
+		// Separating axis test of the 3 face normals of each cuboid and the 9 cross products of their edges, working in the frame of cuboid_1.
+		// The cuboids overlap if their projections overlap on all 15 axes.
+		const glm::mat3 axes_1  = glm::mat3_cast(cuboid_1.m_rotation);
+		const glm::mat3 axes_2  = glm::mat3_cast(cuboid_2.m_rotation);
+		const glm::vec3 extents_1 = cuboid_1.m_scale * 0.5f;
+		const glm::vec3 extents_2 = cuboid_2.m_scale * 0.5f;
+
+		// Rotation of cuboid_2 in the frame of cuboid_1. Epsilon is added to the absolute values so the near zero cross product of
+		// parallel edges can't report a separating axis.
+		std::array<std::array<float, 3>, 3> rotation;
+		std::array<std::array<float, 3>, 3> abs_rotation;
+		for (int i = 0; i < 3; i++)
+			for (int j = 0; j < 3; j++)
+			{
+				rotation[i][j]     = glm::dot(axes_1[i], axes_2[j]);
+				abs_rotation[i][j] = std::abs(rotation[i][j]) + Epsilon;
+			}
+		const glm::vec3 world_translation = cuboid_2.m_position - cuboid_1.m_position;
+		const glm::vec3 translation       = glm::vec3(glm::dot(world_translation, axes_1[0]), glm::dot(world_translation, axes_1[1]), glm::dot(world_translation, axes_1[2]));
+
+		// Axes A0, A1, A2
+		for (int i = 0; i < 3; i++)
+		{
+			const float radius_1 = extents_1[i];
+			const float radius_2 = extents_2[0] * abs_rotation[i][0] + extents_2[1] * abs_rotation[i][1] + extents_2[2] * abs_rotation[i][2];
+			if (std::abs(translation[i]) > radius_1 + radius_2)
+				return false;
+		}
+		// Axes B0, B1, B2
+		for (int j = 0; j < 3; j++)
+		{
+			const float radius_1 = extents_1[0] * abs_rotation[0][j] + extents_1[1] * abs_rotation[1][j] + extents_1[2] * abs_rotation[2][j];
+			const float radius_2 = extents_2[j];
+			if (std::abs(translation[0] * rotation[0][j] + translation[1] * rotation[1][j] + translation[2] * rotation[2][j]) > radius_1 + radius_2)
+				return false;
+		}
+		// Axes Ai x Bj
+		for (int i = 0; i < 3; i++)
+		{
+			const int i1 = (i + 1) % 3;
+			const int i2 = (i + 2) % 3;
+			for (int j = 0; j < 3; j++)
+			{
+				const int j1 = (j + 1) % 3;
+				const int j2 = (j + 2) % 3;
+				const float radius_1 = extents_1[i1] * abs_rotation[i2][j] + extents_1[i2] * abs_rotation[i1][j];
+				const float radius_2 = extents_2[j1] * abs_rotation[i][j2] + extents_2[j2] * abs_rotation[i][j1];
+				if (std::abs(translation[i2] * rotation[i1][j] - translation[i1] * rotation[i2][j]) > radius_1 + radius_2)
+					return false;
+			}
+		}
+		return true;
+	}
+	bool intersecting(const Cuboid& cuboid, const Cylinder& cylinder)
+	{
+		return intersecting_GJK(cuboid, cylinder);
+	}
+	// The Cuboid tests against lines, triangles and spheres transform them into the local space of the cuboid and test against its local AABB.
+	bool intersecting(const Cuboid& cuboid, const Line& line)
+	{
+		return intersecting(local_AABB(cuboid), to_local(cuboid, to_parametric(line)));
+	}
+	bool intersecting(const Cuboid& cuboid, const LineSegment& lineSegment)
+	{
+		return intersecting(local_AABB(cuboid), to_local(cuboid, to_parametric(lineSegment)));
+	}
+	bool intersecting(const Cuboid& cuboid, const Plane& plane)
+	{
+		// Reference: Real-Time Collision Detection (Christer Ericson) - 5.2.3 Testing Box Against Plane pg 161
+		// As the AABB test with the projection radius summed over the rotated axes of the cuboid.
+		const glm::mat3 axes    = glm::mat3_cast(cuboid.m_rotation);
+		const glm::vec3 extents = cuboid.m_scale * 0.5f;
+		const float radius      = extents.x * std::abs(glm::dot(plane.m_normal, axes[0]))
+		                        + extents.y * std::abs(glm::dot(plane.m_normal, axes[1]))
+		                        + extents.z * std::abs(glm::dot(plane.m_normal, axes[2]));
+		return std::abs(signed_distance(plane, cuboid.m_position)) <= radius;
+	}
+	bool intersecting(const Cuboid& cuboid, const Quad& quad)
+	{
+		const auto triangles = quad.get_triangles();
+		return intersecting(local_AABB(cuboid), to_local(cuboid, triangles[0])) || intersecting(local_AABB(cuboid), to_local(cuboid, triangles[1]));
+	}
+	bool intersecting(const Cuboid& cuboid, const Ray& ray)
+	{
+		return intersecting(local_AABB(cuboid), to_local(cuboid, to_parametric(ray)));
+	}
+	bool intersecting(const Cuboid& cuboid, const Sphere& sphere)
+	{
+		return intersecting(local_AABB(cuboid), Sphere(to_local(cuboid, sphere.m_center), sphere.m_radius));
+	}
+	bool intersecting(const Cuboid& cuboid, const Triangle& triangle)
+	{
+		return intersecting(local_AABB(cuboid), to_local(cuboid, triangle));
+	}
+	bool intersecting(const Cylinder& cylinder_1, const Cylinder& cylinder_2)
+	{
+		return intersecting_GJK(cylinder_1, cylinder_2);
+	}
+	bool intersecting(const Cylinder& cylinder, const Line& line)
+	{
+		return intersecting_GJK(cylinder, to_parametric(line));
+	}
+	bool intersecting(const Cylinder& cylinder, const LineSegment& lineSegment)
+	{
+		return intersecting_GJK(cylinder, lineSegment);
+	}
+	bool intersecting(const Cylinder& cylinder, const Plane& plane)
+	{
+		// The signed distances of the cylinder from the plane are bounded by the points of the cap rims farthest either side of the plane.
+		// The rims extend from the cap centers by the radius scaled by the sine of the angle between the axis and the plane normal.
+		const glm::vec3 axis = glm::normalize(cylinder.m_top - cylinder.m_base);
+		const float cosine   = glm::dot(axis, plane.m_normal);
+		const float rim      = cylinder.m_radius * std::sqrt(std::max(0.f, 1.f - cosine * cosine));
+		const float base     = signed_distance(plane, cylinder.m_base);
+		const float top      = signed_distance(plane, cylinder.m_top);
+		return std::min(base, top) - rim <= 0.f && std::max(base, top) + rim >= 0.f;
+	}
+	bool intersecting(const Cylinder& cylinder, const Quad& quad)
+	{
+		return intersecting_GJK(cylinder, quad);
+	}
+	bool intersecting(const Cylinder& cylinder, const Ray& ray)
+	{
+		return intersecting_GJK(cylinder, to_parametric(ray));
+	}
+	bool intersecting(const Cylinder& cylinder, const Sphere& sphere)
+	{
+		// The sphere overlaps the cylinder if the closest point in the cylinder to the sphere center is inside the sphere.
+		// The closest point clamps the center along the axis to the caps and radially to the radius, the two are independent.
+		const glm::vec3 axis           = cylinder.m_top - cylinder.m_base;
+		const glm::vec3 base_to_center = sphere.m_center - cylinder.m_base;
+		const float along_axis         = glm::dot(base_to_center, axis) / glm::dot(axis, axis);
+
+		glm::vec3 radial    = base_to_center - axis * along_axis;
+		const float radial_length = glm::length(radial);
+		if (radial_length > cylinder.m_radius)
+			radial *= cylinder.m_radius / radial_length;
+
+		const glm::vec3 closest      = cylinder.m_base + axis * std::clamp(along_axis, 0.f, 1.f) + radial;
+		const glm::vec3 displacement = sphere.m_center - closest;
+		return glm::dot(displacement, displacement) <= sphere.m_radius * sphere.m_radius;
+	}
+	bool intersecting(const Cylinder& cylinder, const Triangle& triangle)
+	{
+		return intersecting_GJK(cylinder, triangle);
+	}
+	// Lines, LineSegments and Rays intersect each other where the closest points between them meet.
+	bool intersecting(const Line& line_1, const Line& line_2)
+	{
+		return distance_squared(to_parametric(line_1), to_parametric(line_2)) <= Epsilon_Squared;
+	}
+	bool intersecting(const Line& line, const LineSegment& lineSegment)
+	{
+		return distance_squared(to_parametric(line), to_parametric(lineSegment)) <= Epsilon_Squared;
+	}
+	bool intersecting(const Line& line, const Plane& plane)
+	{
+		// A line crosses every plane it isn't parallel to. A parallel line only intersects if it lies in the plane.
+		return std::abs(glm::dot(plane.m_normal, line.m_point_2 - line.m_point_1)) > Epsilon || std::abs(signed_distance(plane, line.m_point_1)) <= Epsilon;
+	}
+	bool intersecting(const Line& line, const Quad& quad)
+	{
+		const auto triangles = quad.get_triangles();
+		return intersecting(triangles[0], to_parametric(line)) || intersecting(triangles[1], to_parametric(line));
+	}
+	bool intersecting(const Line& line, const Ray& ray)
+	{
+		return distance_squared(to_parametric(line), to_parametric(ray)) <= Epsilon_Squared;
+	}
+	bool intersecting(const Line& line, const Sphere& sphere)
+	{
+		return distance_squared(to_parametric(line), sphere.m_center) <= sphere.m_radius * sphere.m_radius;
+	}
 	bool intersecting(const Line& line, const Triangle& triangle)
 	{
 		// Below works for a double-sided triangle (both CW or CCW depending on which side it is viewed),
@@ -587,6 +1562,31 @@ namespace Geometry
 
 		return (u <= 0.f && v <= 0.f && w <= 0.f) || (u >= 0.f && v >= 0.f && w >= 0.f); // have the same sign (ignoring zeroes)
 	}
+	bool intersecting(const LineSegment& lineSegment_1, const LineSegment& lineSegment_2)
+	{
+		return distance_squared(to_parametric(lineSegment_1), to_parametric(lineSegment_2)) <= Epsilon_Squared;
+	}
+	bool intersecting(const LineSegment& lineSegment, const Plane& plane)
+	{
+		return straddling(plane, {lineSegment.m_start, lineSegment.m_end});
+	}
+	bool intersecting(const LineSegment& lineSegment, const Quad& quad)
+	{
+		const auto triangles = quad.get_triangles();
+		return intersecting(triangles[0], to_parametric(lineSegment)) || intersecting(triangles[1], to_parametric(lineSegment));
+	}
+	bool intersecting(const LineSegment& lineSegment, const Ray& ray)
+	{
+		return distance_squared(to_parametric(lineSegment), to_parametric(ray)) <= Epsilon_Squared;
+	}
+	bool intersecting(const LineSegment& lineSegment, const Sphere& sphere)
+	{
+		return distance_squared(lineSegment, sphere.m_center) <= sphere.m_radius * sphere.m_radius;
+	}
+	bool intersecting(const LineSegment& lineSegment, const Triangle& triangle)
+	{
+		return intersecting(triangle, to_parametric(lineSegment));
+	}
 	bool intersecting(const Plane& plane_1, const Plane& plane_2)
 	{
 		// If the dot product is equal to zero, the planes are parallel and do not intersect
@@ -595,6 +1595,16 @@ namespace Geometry
 		else
 			return true;
 	}
+	bool intersecting(const Plane& plane, const Quad& quad)
+	{
+		return straddling(plane, {quad.m_point_1, quad.m_point_2, quad.m_point_3, quad.m_point_4});
+	}
+	bool intersecting(const Plane& plane, const Ray& ray)
+	{
+		// The ray crosses the plane if it starts on the plane or heads towards it.
+		const float distance = signed_distance(plane, ray.m_start);
+		return std::abs(distance) <= Epsilon || distance * glm::dot(plane.m_normal, ray.m_direction) < 0.f;
+	}
 	bool intersecting(const Plane& plane, const Sphere& sphere)
 	{
 		// For a normalized plane (|p.n| = 1), evaluating the plane equation for a point gives the signed distance of the point to the plane
@@ -602,6 +1612,45 @@ namespace Geometry
 		// If sphere center within +/-radius from plane, plane intersects sphere
 		return std::abs(dist) <= sphere.m_radius;
 	}
+	bool intersecting(const Plane& plane, const Triangle& triangle)
+	{
+		return straddling(plane, {triangle.m_point_1, triangle.m_point_2, triangle.m_point_3});
+	}
+	bool intersecting(const Plane& plane_1, const Plane& plane_2, const Plane& plane_3)
+	{
+		// Three planes meet at a single point unless their normals are linearly dependent, as get_intersection(plane_1, plane_2, plane_3).
+		return std::abs(triple_product(plane_1.m_normal, plane_2.m_normal, plane_3.m_normal)) >= Epsilon;
+	}
+	bool intersecting(const Quad& quad_1, const Quad& quad_2)
+	{
+		const auto triangles_1 = quad_1.get_triangles();
+		const auto triangles_2 = quad_2.get_triangles();
+		return intersecting(triangles_1[0], triangles_2[0]) || intersecting(triangles_1[0], triangles_2[1])
+		    || intersecting(triangles_1[1], triangles_2[0]) || intersecting(triangles_1[1], triangles_2[1]);
+	}
+	bool intersecting(const Quad& quad, const Ray& ray)
+	{
+		const auto triangles = quad.get_triangles();
+		return intersecting(triangles[0], to_parametric(ray)) || intersecting(triangles[1], to_parametric(ray));
+	}
+	bool intersecting(const Quad& quad, const Sphere& sphere)
+	{
+		const auto triangles = quad.get_triangles();
+		return intersecting(sphere, triangles[0]) || intersecting(sphere, triangles[1]);
+	}
+	bool intersecting(const Quad& quad, const Triangle& triangle)
+	{
+		const auto triangles = quad.get_triangles();
+		return intersecting(triangles[0], triangle) || intersecting(triangles[1], triangle);
+	}
+	bool intersecting(const Ray& ray_1, const Ray& ray_2)
+	{
+		return distance_squared(to_parametric(ray_1), to_parametric(ray_2)) <= Epsilon_Squared;
+	}
+	bool intersecting(const Ray& ray, const Sphere& sphere)
+	{
+		return distance_squared(to_parametric(ray), sphere.m_center) <= sphere.m_radius * sphere.m_radius;
+	}
 	bool intersecting(const Sphere& sphere_1, const Sphere& sphere_2)
 	{
 		// Returns true if the spheres are intersecting.
@@ -609,113 +1658,143 @@ namespace Geometry
 		auto radius_sum               = sphere_1.m_radius + sphere_2.m_radius;
 		return distance_between_centers <= radius_sum;
 	}
+	bool intersecting(const Sphere& sphere, const Triangle& triangle)
+	{
+		const glm::vec3 displacement = sphere.m_center - closest_point(triangle, sphere.m_center);
+		return glm::dot(displacement, displacement) <= sphere.m_radius * sphere.m_radius;
+	}
 	bool intersecting(const Triangle& triangle_1, const Triangle& triangle_2, bool test_co_planar)
 	{
-		// Uses the Möller-Trumbore intersection algorithm to perform triangle-triangle collision detection. Adapted from:
-		// https://github.com/erich666/jgt-code/blob/master/Volume_08/Number_1/Shen2003/tri_tri_test/include/Moller97.c
-		// https://web.stanford.edu/class/cs277/resources/papers/Moller1997b.pdf
+		return triangle_triangle(triangle_1, triangle_plane(triangle_1), triangle_2, test_co_planar);
+	}
 
-		// compute plane of triangle_1
-		glm::vec3 E1 = triangle_1.m_point_2 - triangle_1.m_point_1;
-		glm::vec3 E2 = triangle_1.m_point_3 - triangle_1.m_point_1;
-		glm::vec3 N1 = glm::cross(E1, E2); // Normal of triangle_1
-		float d1 = -glm::dot(N1, triangle_1.m_point_1);
-		// plane equation 1: N1.X+d1=0
+// ==============================================================================================================================
+// BATCH INTERSECTING FUNCTIONS
+// ==============================================================================================================================
 
-		// Put triangle_2 into plane equation 1 to compute signed distances to the plane
-		float du0 = glm::dot(N1, triangle_2.m_point_1) + d1;
-		float du1 = glm::dot(N1, triangle_2.m_point_2) + d1;
-		float du2 = glm::dot(N1, triangle_2.m_point_3) + d1;
+	AABB AABBArray::get(const size_t& index) const
+	{
+		return AABB(glm::vec3(m_min_x[index], m_min_y[index], m_min_z[index]), glm::vec3(m_max_x[index], m_max_y[index], m_max_z[index]));
+	}
 
-		// coplanarity robustness check
-		if constexpr (Use_Epsilon_Test)
+	namespace
+	{
+#if defined(Z_SIMD_SSE2)
+		using SIMD::FloatSSE2;
+#endif
+#if defined(Z_SIMD_AVX2)
+		using SIMD::FloatAVX2;
+#endif
+
+		// Set the hit bits of AABBs [p_begin, size) one at a time. p_hits must be cleared.
+		template <typename Shape>
+		void set_hits_scalar(const Shape& p_shape, const AABBArray& p_AABBs, std::span<uint64_t> p_hits, const size_t& p_begin)
 		{
-			if (std::abs(du0) < Epsilon) du0 = 0.0;
-			if (std::abs(du1) < Epsilon) du1 = 0.0;
-			if (std::abs(du2) < Epsilon) du2 = 0.0;
+			for (size_t i = p_begin; i < p_AABBs.size(); i++)
+				if (intersecting(p_AABBs.get(i), p_shape))
+					p_hits[i / 64] |= uint64_t(1) << (i % 64);
 		}
-		float du0du1 = du0 * du1;
-		float du0du2 = du0 * du2;
-
-		if (du0du1 > 0.0f && du0du2 > 0.0f) // same sign on all of them + not equal 0 = no intersecton
-			return false;
-
-		// compute plane of triangle_2
-		E1 = triangle_2.m_point_2 - triangle_2.m_point_1;
-		E2 = triangle_2.m_point_3 - triangle_2.m_point_1;
-		glm::vec3 N2 = glm::cross(E1, E2); // Tr Normal
-		float d2 = -glm::dot(N2, triangle_2.m_point_1);
-		// plane equation 2: N2.X+d2=0
-
-		// put triangle_1 into plane equation of triangle_2
-		float dv0 = glm::dot(N2, triangle_1.m_point_1) + d2;
-		float dv1 = glm::dot(N2, triangle_1.m_point_2) + d2;
-		float dv2 = glm::dot(N2, triangle_1.m_point_3) + d2;
-
-		if constexpr (Use_Epsilon_Test)
+		// Set the hit bits of triangles [p_begin, size) one at a time. p_hits must be cleared.
+		void set_triangle_hits_scalar(const Triangle& p_triangle, const TrianglePlane& p_plane, std::span<const Triangle> p_triangles, std::span<uint64_t> p_hits, const bool& p_test_co_planar, const size_t& p_begin)
 		{
-			if (std::abs(dv0) < Epsilon) dv0 = 0.0;
-			if (std::abs(dv1) < Epsilon) dv1 = 0.0;
-			if (std::abs(dv2) < Epsilon) dv2 = 0.0;
+			for (size_t i = p_begin; i < p_triangles.size(); i++)
+				if (triangle_triangle(p_triangle, p_plane, p_triangles[i], p_test_co_planar))
+					p_hits[i / 64] |= uint64_t(1) << (i % 64);
 		}
 
-		float dv0dv1 = dv0 * dv1;
-		float dv0dv2 = dv0 * dv2;
-
-		// Same sign on all of them and not equal to 0 then no intersection occurs
-		if (dv0dv1 > 0.0f && dv0dv2 > 0.0f)
-			return false;
-
-		// compute direction of intersection line
-		glm::vec3 D = glm::cross(N1, N2);
-
-		// compute and index to the largest component of D
-		float max = std::abs(D[0]);
-		float b   = std::abs(D[1]);
-		float c   = std::abs(D[2]);
-		int index = 0;
-
-		if (b > max) max = b, index = 1;
-		if (c > max) max = c, index = 2;
-
-		// this is the simplified projection onto L
-		float vp0 = triangle_1.m_point_1[index];
-		float vp1 = triangle_1.m_point_2[index];
-		float vp2 = triangle_1.m_point_3[index];
-
-		float up0 = triangle_2.m_point_1[index];
-		float up1 = triangle_2.m_point_2[index];
-		float up2 = triangle_2.m_point_3[index];
-
-		glm::vec2 isect1;
-		glm::vec2 isect2;
-
-		// compute interval for triangle_1 and triangle_2. If the interval check comes back false
-		// the triangles are coplanar and we can early out by checking for collision between coplanar triangles.
-		if (!compute_intervals(vp0, vp1, vp2, dv0, dv1, dv2, dv0dv1, dv0dv2, isect1[0], isect1[1]))
+#define Z_SIMD_TARGET
+		namespace Kernel
 		{
-			if (test_co_planar)
-				return coplanar_tri_tri(N1, triangle_1, triangle_2);
-			else
-				return false;
+			#include "IntersectKernel.inl"
+		}
+#undef Z_SIMD_TARGET
+#if defined(Z_SIMD_AVX2)
+	#define Z_SIMD_TARGET Z_TARGET_AVX2
+		namespace KernelAVX2
+		{
+			#include "IntersectKernel.inl"
 		}
-		if (!compute_intervals(up0, up1, up2, du0, du1, du2, du0du1, du0du2, isect2[0], isect2[1]))
+	#undef Z_SIMD_TARGET
+#endif
+
+		template <typename Shape>
+		size_t batch_intersecting(const Shape& p_shape, const AABBArray& p_AABBs, std::span<uint64_t> p_hits)
 		{
-			if (test_co_planar)
-				return coplanar_tri_tri(N1, triangle_1, triangle_2);
+			ASSERT(p_AABBs.m_min_y.size() == p_AABBs.size() && p_AABBs.m_min_z.size() == p_AABBs.size()
+				&& p_AABBs.m_max_x.size() == p_AABBs.size() && p_AABBs.m_max_y.size() == p_AABBs.size() && p_AABBs.m_max_z.size() == p_AABBs.size(),
+				"AABBArray spans must be the same size");
+			ASSERT(p_hits.size() >= hit_mask_size(p_AABBs.size()), "Hit mask too small for the AABBArray");
+
+			p_hits = p_hits.first(hit_mask_size(p_AABBs.size()));
+			std::fill(p_hits.begin(), p_hits.end(), uint64_t(0));
+
+#if defined(Z_SIMD_SSE2)
+			if (SIMD::use_AVX2())
+				KernelAVX2::set_hits<FloatAVX2>(p_shape, p_AABBs, p_hits);
 			else
-				return false;
+				Kernel::set_hits<FloatSSE2>(p_shape, p_AABBs, p_hits);
+#else
+			set_hits_scalar(p_shape, p_AABBs, p_hits, 0);
+#endif
+
+			size_t count = 0;
+			for (const uint64_t& word : p_hits)
+				count += std::popcount(word);
+			return count;
 		}
+	} // namespace
 
-		// Sort so components of isect1 and isect2 are in ascending order.
-		if (isect1[0] > isect1[1])
-			std::swap(isect1[0], isect1[1]);
-		if (isect2[0] > isect2[1])
-			std::swap(isect2[0], isect2[1]);
+	size_t intersecting(const AABB& AABB, const AABBArray& AABBs, std::span<uint64_t> hits)
+	{
+		return batch_intersecting(AABB, AABBs, hits);
+	}
+	size_t intersecting(const Frustrum& frustrum, const AABBArray& AABBs, std::span<uint64_t> hits)
+	{
+		return batch_intersecting(frustrum, AABBs, hits);
+	}
+	size_t intersecting(const Sphere& sphere, const AABBArray& AABBs, std::span<uint64_t> hits)
+	{
+		return batch_intersecting(sphere, AABBs, hits);
+	}
+	size_t intersecting(const Triangle& triangle, std::span<const Triangle> triangles, std::span<uint64_t> hits, bool test_co_planar)
+	{
+		ASSERT(hits.size() >= hit_mask_size(triangles.size()), "Hit mask too small for the triangles");
 
-		if (isect1[1] < isect2[0] || isect2[1] < isect1[0])
-			return false;
+		hits = hits.first(hit_mask_size(triangles.size()));
+		std::fill(hits.begin(), hits.end(), uint64_t(0));
+
+		// The plane of triangle is computed once for the batch.
+		const TrianglePlane plane = triangle_plane(triangle);
+#if defined(Z_SIMD_SSE2)
+		if (SIMD::use_AVX2())
+			KernelAVX2::set_triangle_hits<FloatAVX2>(triangle, plane, triangles, hits, test_co_planar);
 		else
-			return true;
+			Kernel::set_triangle_hits<FloatSSE2>(triangle, plane, triangles, hits, test_co_planar);
+#else
+		set_triangle_hits_scalar(triangle, plane, triangles, hits, test_co_planar, 0);
+#endif
+
+		size_t count = 0;
+		for (const uint64_t& word : hits)
+			count += std::popcount(word);
+		return count;
 	}
+	size_t hit_indices(std::span<const uint64_t> hits, std::span<uint32_t> indices)
+	{
+		size_t count = 0;
+		for (size_t word_index = 0; word_index < hits.size(); word_index++)
+		{
+			// Clear the lowest set bit each iteration, visiting only the set bits.
+			for (uint64_t word = hits[word_index]; word != 0; word &= word - 1)
+			{
+				if (count < indices.size())
+					indices[count] = static_cast<uint32_t>(word_index * 64 + std::countr_zero(word));
+				count++;
+			}
+		}
+		return count;
+	}
+// ==============================================================================================================================
+// END BATCH INTERSECTING FUNCTIONS
+// ==============================================================================================================================
 } // namespace Geometry
\ No newline at end of file
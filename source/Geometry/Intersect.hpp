@@ -6,7 +6,9 @@
 
 #include "glm/vec3.hpp"
 #include "Utility/Logger.hpp"
+#include <cstdint>
 #include <optional>
+#include <span>
 #include <variant>
 
 DISABLE_WARNING_PUSH
@@ -18,6 +20,7 @@ namespace Geometry
 	class Cone;
 	class Cuboid;
 	class Cylinder;
+	class Frustrum;
 	class Plane;
 	class Quad;
 	class Ray;
@@ -93,6 +96,11 @@ namespace Geometry
 	//@param point The point to find the closest point to
 	//@return The closest point on ray to point
 	glm::vec3 closest_point(const Ray& ray, const glm::vec3& point);
+	// Get the closest point on or inside the triangle to the point
+	//@param triangle The triangle to find the closest point on
+	//@param point The point to find the closest point to
+	//@return The closest point on triangle to point
+	glm::vec3 closest_point(const Triangle& triangle, const glm::vec3& point);
 
 	// Get the distance from the point to the line squared
 	//@param line The line to find the distance to
@@ -104,6 +112,11 @@ namespace Geometry
 	//@param point The point to find the distance from
 	//@return The distance from point to line
 	float distance(const LineSegment& line, const glm::vec3& point);
+	// Get the distance from the point to the closest point on or inside the AABB squared
+	//@param AABB The AABB to find the distance to
+	//@param point The point to find the distance from
+	//@return The distance from point to AABB squared, 0 if point is inside AABB
+	float distance_squared(const AABB& AABB, const glm::vec3& point);
 
 
 //==============================================================================================================================
@@ -112,7 +125,7 @@ namespace Geometry
 
 	// AABB functions
 	//==============================================================================================================================
-	inline std::optional<ContactPoint> get_intersection(const AABB& AABB_1, const AABB& AABB_2)             { LOG_WARN("[INTERSECT] Not implemented AABB v AABB"); return std::nullopt; } // #TODO
+	       std::optional<ContactPoint> get_intersection(const AABB& AABB_1, const AABB& AABB_2); // IMPLEMENTED
 	inline std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Cone& cone)               { LOG_WARN("[INTERSECT] Not implemented AABB v Cone"); return std::nullopt; } // #TODO
 	inline std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Cuboid& cuboid)           { LOG_WARN("[INTERSECT] Not implemented AABB v Cuboid"); return std::nullopt; } // #TODO
 	inline std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Cylinder& cylinder)       { LOG_WARN("[INTERSECT] Not implemented AABB v Cylinder"); return std::nullopt; } // #TODO
@@ -122,7 +135,7 @@ namespace Geometry
 	inline std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Quad& quad)               { LOG_WARN("[INTERSECT] Not implemented AABB v Quad"); return std::nullopt; } // #TODO
 	       std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Ray& ray, float* distance_along_ray = nullptr); // IMPLEMENTED
 	inline std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Sphere& sphere)           { LOG_WARN("[INTERSECT] Not implemented AABB v Sphere"); return std::nullopt; } // #TODO
-	inline std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Triangle& triangle)       { LOG_WARN("[INTERSECT] Not implemented AABB v Triangle"); return std::nullopt; } // #TODO
+	       std::optional<ContactPoint> get_intersection(const AABB& AABB,   const Triangle& triangle);      // IMPLEMENTED
 
 	// Cone functions
 	//==============================================================================================================================
@@ -238,7 +251,7 @@ namespace Geometry
 	inline std::optional<ContactPoint> get_intersection(const Ray& ray,   const Quad& quad)               { return get_intersection(quad, ray); }
 	inline std::optional<ContactPoint> get_intersection(const Ray& ray_1, const Ray& ray_2)               { LOG_WARN("[INTERSECT] Not implemented Ray v Ray"); return std::nullopt; } // #TODO
 	inline std::optional<ContactPoint> get_intersection(const Ray& ray,   const Sphere& sphere)           { LOG_WARN("[INTERSECT] Not implemented Ray v Sphere"); return std::nullopt; } // #TODO
-	inline std::optional<ContactPoint> get_intersection(const Ray& ray,   const Triangle& triangle)       { LOG_WARN("[INTERSECT] Not implemented Ray v Triangle"); return std::nullopt; } // #TODO
+	       std::optional<ContactPoint> get_intersection(const Ray& ray,   const Triangle& triangle, float* distance_along_ray = nullptr); // IMPLEMENTED
 
 	// Sphere functions
 	//==============================================================================================================================
@@ -252,7 +265,7 @@ namespace Geometry
 	inline std::optional<ContactPoint> get_intersection(const Sphere& sphere,   const Quad& quad)               { return get_intersection(quad, sphere); }
 	inline std::optional<ContactPoint> get_intersection(const Sphere& sphere,   const Ray& ray)                 { return get_intersection(ray, sphere); }
 	       std::optional<ContactPoint> get_intersection(const Sphere& sphere_1, const Sphere& sphere_2);        // IMPLEMENTED
-	inline std::optional<ContactPoint> get_intersection(const Sphere& sphere,   const Triangle& triangle)       { LOG_WARN("[INTERSECT] Not implemented Sphere v Triangle"); return std::nullopt; } // #TODO
+	       std::optional<ContactPoint> get_intersection(const Sphere& sphere,   const Triangle& triangle);      // IMPLEMENTED
 
 	// Triangle functions
 	//==============================================================================================================================
@@ -266,7 +279,9 @@ namespace Geometry
 	inline std::optional<ContactPoint> get_intersection(const Triangle& triangle,   const Quad& quad)                                       { return get_intersection(quad, triangle); }
 	inline std::optional<ContactPoint> get_intersection(const Triangle& triangle,   const Ray& ray)                                         { return get_intersection(ray, triangle); }
 	inline std::optional<ContactPoint> get_intersection(const Triangle& triangle,   const Sphere& sphere)                                   { return get_intersection(sphere, triangle); }
-	inline std::optional<ContactPoint> get_intersection(const Triangle& triangle_1, const Triangle& triangle_2, bool test_co_planar = true) { LOG_WARN("[INTERSECT] Not implemented Triangle v Triangle"); return std::nullopt; } // #TODO
+	// Triangles crossing each other contact at the middle of the segment where they intersect with the penetration depth of the triangle normal
+	// that separates them with the least movement. Coplanar triangles contact at the centre of their overlap with no penetration depth.
+	       std::optional<ContactPoint> get_intersection(const Triangle& triangle_1, const Triangle& triangle_2, bool test_co_planar = true); // IMPLEMENTED
 //==============================================================================================================================
 // end get_intersection functions
 //==============================================================================================================================
@@ -274,64 +289,69 @@ namespace Geometry
 
 
 //==============================================================================================================================
-// intersecting functions = Are we intersecting? - Where not implemented, these are wrappers for get_intersection functions
+// intersecting functions = Are we intersecting? - Early out tests without the contact information of the get_intersection functions
 //==============================================================================================================================
 
 	// AABB functions
 	//==============================================================================================================================
 	       bool intersecting(const AABB& AABB_1, const AABB& AABB_2);            // IMPLEMENTED
-	inline bool intersecting(const AABB& AABB,   const Cone& cone)               { return get_intersection(AABB, cone).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const AABB& AABB,   const Cuboid& cuboid)           { return get_intersection(AABB, cuboid).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const AABB& AABB,   const Cylinder& cylinder)       { return get_intersection(AABB, cylinder).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const AABB& AABB,   const Line& line)               { return get_intersection(AABB, line).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const AABB& AABB,   const LineSegment& lineSegment) { return get_intersection(AABB, lineSegment).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const AABB& AABB,   const Plane& plane)             { return get_intersection(AABB, plane).has_value(); }       // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const AABB& AABB,   const Quad& quad)               { return get_intersection(AABB, quad).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const AABB& AABB,   const Cone& cone);              // IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const Cuboid& cuboid);          // IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const Cylinder& cylinder);      // IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const Frustrum& frustrum);      // IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const Line& line);              // IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const LineSegment& lineSegment);// IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const Plane& plane);            // IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const Quad& quad);              // IMPLEMENTED
 	       bool intersecting(const AABB& AABB,   const Ray& ray);                // IMPLEMENTED
-	inline bool intersecting(const AABB& AABB,   const Sphere& sphere)           { return get_intersection(AABB, sphere).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const AABB& AABB,   const Triangle& triangle)       { return get_intersection(AABB, triangle).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const AABB& AABB,   const Sphere& sphere);          // IMPLEMENTED
+	       bool intersecting(const AABB& AABB,   const Triangle& triangle);      // IMPLEMENTED
 
 	// Cone functions
 	//==============================================================================================================================
 	inline bool intersecting(const Cone& cone,   const AABB& AABB)               { return intersecting(AABB, cone); }
-	inline bool intersecting(const Cone& cone_1, const Cone& cone_2)             { return get_intersection(cone_1, cone_2).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Cuboid& cuboid)           { return get_intersection(cone, cuboid).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Cylinder& cylinder)       { return get_intersection(cone, cylinder).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Line& line)               { return get_intersection(cone, line).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const LineSegment& lineSegment) { return get_intersection(cone, lineSegment).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Plane& plane)             { return get_intersection(cone, plane).has_value(); }       // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Quad& quad)               { return get_intersection(cone, quad).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Ray& ray)                 { return get_intersection(cone, ray).has_value(); }         // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Sphere& sphere)           { return get_intersection(cone, sphere).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cone& cone,   const Triangle& triangle)       { return get_intersection(cone, triangle).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Cone& cone_1, const Cone& cone_2);            // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Cuboid& cuboid);          // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Cylinder& cylinder);      // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Line& line);              // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const LineSegment& lineSegment);// IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Plane& plane);            // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Quad& quad);              // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Ray& ray);                // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Sphere& sphere);          // IMPLEMENTED
+	       bool intersecting(const Cone& cone,   const Triangle& triangle);      // IMPLEMENTED
 
 	// Cuboid functions
 	//==============================================================================================================================
 	inline bool intersecting(const Cuboid& cuboid,   const AABB& AABB)               { return intersecting(AABB, cuboid); }
 	inline bool intersecting(const Cuboid& cuboid,   const Cone& cone)               { return intersecting(cone, cuboid); }
-	inline bool intersecting(const Cuboid& cuboid_1, const Cuboid& cuboid_2)         { return get_intersection(cuboid_1, cuboid_2).has_value(); }  // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const Cylinder& cylinder)       { return get_intersection(cuboid, cylinder).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const Line& line)               { return get_intersection(cuboid, line).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const LineSegment& lineSegment) { return get_intersection(cuboid, lineSegment).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const Plane& plane)             { return get_intersection(cuboid, plane).has_value(); }       // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const Quad& quad)               { return get_intersection(cuboid, quad).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const Ray& ray)                 { return get_intersection(cuboid, ray).has_value(); }         // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const Sphere& sphere)           { return get_intersection(cuboid, sphere).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cuboid& cuboid,   const Triangle& triangle)       { return get_intersection(cuboid, triangle).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Cuboid& cuboid_1, const Cuboid& cuboid_2);        // IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const Cylinder& cylinder);      // IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const Line& line);              // IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const LineSegment& lineSegment);// IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const Plane& plane);            // IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const Quad& quad);              // IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const Ray& ray);                // IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const Sphere& sphere);          // IMPLEMENTED
+	       bool intersecting(const Cuboid& cuboid,   const Triangle& triangle);      // IMPLEMENTED
 
 	// Cylinder functions
 	//==============================================================================================================================
 	inline bool intersecting(const Cylinder& cylinder,   const AABB& AABB)                { return intersecting(AABB, cylinder); }
 	inline bool intersecting(const Cylinder& cylinder,   const Cone& cone)                { return intersecting(cone, cylinder); }
 	inline bool intersecting(const Cylinder& cylinder,   const Cuboid& cuboid)            { return intersecting(cuboid, cylinder); }
-	inline bool intersecting(const Cylinder& cylinder_1, const Cylinder& cylinder_2)      { return get_intersection(cylinder_1, cylinder_2).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cylinder& cylinder,   const Line& line)                { return get_intersection(cylinder, line).has_value(); }         // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cylinder& cylinder,   const LineSegment& lineSegment)  { return get_intersection(cylinder, lineSegment).has_value(); }  // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cylinder& cylinder,   const Plane& plane)              { return get_intersection(cylinder, plane).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cylinder& cylinder,   const Quad& quad)                { return get_intersection(cylinder, quad).has_value(); }         // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cylinder& cylinder,   const Ray& ray)                  { return get_intersection(cylinder, ray).has_value(); }          // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cylinder& cylinder,   const Sphere& sphere)            { return get_intersection(cylinder, sphere).has_value(); }       // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Cylinder& cylinder,   const Triangle& triangle)        { return get_intersection(cylinder, triangle).has_value(); }     // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Cylinder& cylinder_1, const Cylinder& cylinder_2);     // IMPLEMENTED
+	       bool intersecting(const Cylinder& cylinder,   const Line& line);               // IMPLEMENTED
+	       bool intersecting(const Cylinder& cylinder,   const LineSegment& lineSegment); // IMPLEMENTED
+	       bool intersecting(const Cylinder& cylinder,   const Plane& plane);             // IMPLEMENTED
+	       bool intersecting(const Cylinder& cylinder,   const Quad& quad);               // IMPLEMENTED
+	       bool intersecting(const Cylinder& cylinder,   const Ray& ray);                 // IMPLEMENTED
+	       bool intersecting(const Cylinder& cylinder,   const Sphere& sphere);           // IMPLEMENTED
+	       bool intersecting(const Cylinder& cylinder,   const Triangle& triangle);       // IMPLEMENTED
+
+	// Frustrum functions
+	//==============================================================================================================================
+	inline bool intersecting(const Frustrum& frustrum, const AABB& AABB)         { return intersecting(AABB, frustrum); }
 
 	// Line functions
 	//==============================================================================================================================
@@ -339,12 +359,12 @@ namespace Geometry
 	inline bool intersecting(const Line& line,   const Cone& cone)                { return intersecting(cone, line); }
 	inline bool intersecting(const Line& line,   const Cuboid& cuboid)            { return intersecting(cuboid, line); }
 	inline bool intersecting(const Line& line,   const Cylinder& cylinder)        { return intersecting(cylinder, line); }
-	inline bool intersecting(const Line& line_1, const Line& line_2)              { return get_intersection(line_1, line_2).has_value(); }    // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Line& line,   const LineSegment& lineSegment)  { return get_intersection(line, lineSegment).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Line& line,   const Plane& plane)              { return get_intersection(line, plane).has_value(); }       // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Line& line,   const Quad& quad)                { return get_intersection(line, quad).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Line& line,   const Ray& ray)                  { return get_intersection(line, ray).has_value(); }         // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Line& line,   const Sphere& sphere)            { return get_intersection(line, sphere).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Line& line_1, const Line& line_2);             // IMPLEMENTED
+	       bool intersecting(const Line& line,   const LineSegment& lineSegment); // IMPLEMENTED
+	       bool intersecting(const Line& line,   const Plane& plane);             // IMPLEMENTED
+	       bool intersecting(const Line& line,   const Quad& quad);               // IMPLEMENTED
+	       bool intersecting(const Line& line,   const Ray& ray);                 // IMPLEMENTED
+	       bool intersecting(const Line& line,   const Sphere& sphere);           // IMPLEMENTED
 	       bool intersecting(const Line& line,   const Triangle& triangle);       // IMPLEMENTED
 
 	// LineSegment functions
@@ -354,12 +374,12 @@ namespace Geometry
 	inline bool intersecting(const LineSegment& lineSegment,   const Cuboid& cuboid)             { return intersecting(cuboid, lineSegment); }
 	inline bool intersecting(const LineSegment& lineSegment,   const Cylinder& cylinder)         { return intersecting(cylinder, lineSegment); }
 	inline bool intersecting(const LineSegment& lineSegment,   const Line& line)                 { return intersecting(line, lineSegment); }
-	inline bool intersecting(const LineSegment& lineSegment_1, const LineSegment& lineSegment_2) { return get_intersection(lineSegment_1, lineSegment_2).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const LineSegment& lineSegment,   const Plane& plane)               { return get_intersection(lineSegment, plane).has_value(); }           // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const LineSegment& lineSegment,   const Quad& quad)                 { return get_intersection(lineSegment, quad).has_value(); }            // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const LineSegment& lineSegment,   const Ray& ray)                   { return get_intersection(lineSegment, ray).has_value(); }             // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const LineSegment& lineSegment,   const Sphere& sphere)             { return get_intersection(lineSegment, sphere).has_value(); }          // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const LineSegment& lineSegment,   const Triangle& triangle)         { return get_intersection(lineSegment, triangle).has_value(); }        // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const LineSegment& lineSegment_1, const LineSegment& lineSegment_2);// IMPLEMENTED
+	       bool intersecting(const LineSegment& lineSegment,   const Plane& plane);              // IMPLEMENTED
+	       bool intersecting(const LineSegment& lineSegment,   const Quad& quad);                // IMPLEMENTED
+	       bool intersecting(const LineSegment& lineSegment,   const Ray& ray);                  // IMPLEMENTED
+	       bool intersecting(const LineSegment& lineSegment,   const Sphere& sphere);            // IMPLEMENTED
+	       bool intersecting(const LineSegment& lineSegment,   const Triangle& triangle);        // IMPLEMENTED
 
 	// Plane functions
 	//==============================================================================================================================
@@ -370,11 +390,11 @@ namespace Geometry
 	inline bool intersecting(const Plane& plane,   const Line& line)                           { return intersecting(line, plane); }
 	inline bool intersecting(const Plane& plane,   const LineSegment& lineSegment)             { return intersecting(lineSegment, plane); }
 	       bool intersecting(const Plane& plane_1, const Plane& plane_2);                      // IMPLEMENTED
-	inline bool intersecting(const Plane& plane,   const Quad& quad)                           { return get_intersection(plane, quad).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Plane& plane,   const Ray& ray)                             { return get_intersection(plane, ray).has_value(); }       // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Plane& plane,   const Quad& quad);                          // IMPLEMENTED
+	       bool intersecting(const Plane& plane,   const Ray& ray);                            // IMPLEMENTED
 	       bool intersecting(const Plane& plane,   const Sphere& sphere);                      // IMPLEMENTED
-	inline bool intersecting(const Plane& plane,   const Triangle& triangle)                   { return get_intersection(plane, triangle).has_value(); }  // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Plane& plane_1, const Plane& plane_2, const Plane& plane_3) { return get_intersection(plane_1, plane_2).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Plane& plane,   const Triangle& triangle);                  // IMPLEMENTED
+	       bool intersecting(const Plane& plane_1, const Plane& plane_2, const Plane& plane_3); // IMPLEMENTED
 
 	// Quad functions
 	//==============================================================================================================================
@@ -385,10 +405,10 @@ namespace Geometry
 	inline bool intersecting(const Quad& quad,   const Line& line)               { return intersecting(line, quad); }
 	inline bool intersecting(const Quad& quad,   const LineSegment& lineSegment) { return intersecting(lineSegment, quad); }
 	inline bool intersecting(const Quad& quad,   const Plane& plane)             { return intersecting(plane, quad); }
-	inline bool intersecting(const Quad& quad_1, const Quad& quad_2)             { return get_intersection(quad_1, quad_2).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Quad& quad,   const Ray& ray)                 { return get_intersection(quad, ray).has_value(); }      // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Quad& quad,   const Sphere& sphere)           { return get_intersection(quad, sphere).has_value(); }   // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Quad& quad,   const Triangle& triangle)       { return get_intersection(quad, triangle).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Quad& quad_1, const Quad& quad_2);            // IMPLEMENTED
+	       bool intersecting(const Quad& quad,   const Ray& ray);                // IMPLEMENTED
+	       bool intersecting(const Quad& quad,   const Sphere& sphere);          // IMPLEMENTED
+	       bool intersecting(const Quad& quad,   const Triangle& triangle);      // IMPLEMENTED
 
 	// Ray functions
 	//==============================================================================================================================
@@ -400,9 +420,9 @@ namespace Geometry
 	inline bool intersecting(const Ray& ray,   const LineSegment& lineSegment) { return intersecting(lineSegment, ray); }
 	inline bool intersecting(const Ray& ray,   const Plane& plane)             { return intersecting(plane, ray); }
 	inline bool intersecting(const Ray& ray,   const Quad& quad)               { return intersecting(quad, ray); }
-	inline bool intersecting(const Ray& ray_1, const Ray& ray_2)               { return get_intersection(ray_1, ray_2).has_value(); }  // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Ray& ray,   const Sphere& sphere)           { return get_intersection(ray, sphere).has_value(); }   // Expensive get_intersection call for lack of bespoke intersection function #TODO
-	inline bool intersecting(const Ray& ray,   const Triangle& triangle)       { return get_intersection(ray, triangle).has_value(); } // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Ray& ray_1, const Ray& ray_2);              // IMPLEMENTED
+	       bool intersecting(const Ray& ray,   const Sphere& sphere);          // IMPLEMENTED
+	inline bool intersecting(const Ray& ray,   const Triangle& triangle)       { return get_intersection(ray, triangle).has_value(); } // get_intersection is the Moller-Trumbore test without extra work
 
 	// Sphere functions
 	//==============================================================================================================================
@@ -416,7 +436,7 @@ namespace Geometry
 	inline bool intersecting(const Sphere& sphere,   const Quad& quad)               { return intersecting(quad, sphere); }
 	inline bool intersecting(const Sphere& sphere,   const Ray& ray)                 { return intersecting(ray, sphere); }
 	       bool intersecting(const Sphere& sphere_1, const Sphere& sphere_2);        // IMPLEMENTED
-	inline bool intersecting(const Sphere& sphere,   const Triangle& triangle)       { return get_intersection(sphere, triangle).has_value(); }   // Expensive get_intersection call for lack of bespoke intersection function #TODO
+	       bool intersecting(const Sphere& sphere,   const Triangle& triangle);      // IMPLEMENTED
 
 	// Triangle functions
 	//==============================================================================================================================
@@ -435,5 +455,45 @@ namespace Geometry
 // end intersecting functions
 //==============================================================================================================================
 
+
+//==============================================================================================================================
+// Batch intersecting functions: Test one shape against many AABBs stored as a structure of arrays or one triangle against many triangles.
+//==============================================================================================================================
+
+	// A structure of arrays view of a batch of AABBs, every span holds one element per AABB.
+	// The batch intersecting functions load the same component of several AABBs into one SIMD register to test them together.
+	struct AABBArray
+	{
+		std::span<const float> m_min_x, m_min_y, m_min_z;
+		std::span<const float> m_max_x, m_max_y, m_max_z;
+
+		[[nodiscard]] size_t size() const { return m_min_x.size(); }
+		[[nodiscard]] AABB get(const size_t& index) const;
+	};
+	// The number of words a hit mask needs to hold one bit per AABB.
+	constexpr size_t hit_mask_size(const size_t& AABB_count) { return (AABB_count + 63) / 64; }
+
+	// Test the shape against every AABB in AABBs, giving each AABB the same result as the scalar intersecting function.
+	// 8 AABBs are tested at a time with AVX2 if the CPU supports it, otherwise 4 with SSE2. AABBs left over at the end use the scalar test.
+	//@param hits Hit mask of at least hit_mask_size(AABBs.size()) words. Bit i % 64 of hits[i / 64] is set if AABB i intersects the shape and cleared otherwise.
+	//@return The number of AABBs intersecting the shape.
+	size_t intersecting(const AABB& AABB,         const AABBArray& AABBs, std::span<uint64_t> hits);
+	size_t intersecting(const Frustrum& frustrum, const AABBArray& AABBs, std::span<uint64_t> hits);
+	size_t intersecting(const Sphere& sphere,     const AABBArray& AABBs, std::span<uint64_t> hits);
+	// Convert a hit mask to an index list.
+	//@param hits Hit mask as written by the batch intersecting functions.
+	//@param indices Written with the indices of the set bits of hits in ascending order. Indices past its size are counted but not written.
+	//@return The number of set bits in hits.
+	size_t hit_indices(std::span<const uint64_t> hits, std::span<uint32_t> indices);
+	// Test triangle against every triangle in triangles, giving each the same result as intersecting(triangle, triangles[i], test_co_planar).
+	// The plane of triangle is computed once and most candidates of a mesh pair are rejected against it before any other work, 8 at a time with
+	// AVX2 if the CPU supports it, otherwise 4 with SSE2. The remaining triangles and those left over at the end use the scalar test.
+	//@param hits Hit mask of at least hit_mask_size(triangles.size()) words. Bit i % 64 of hits[i / 64] is set if triangles[i] intersects triangle and cleared otherwise.
+	//@return The number of triangles intersecting triangle.
+	size_t intersecting(const Triangle& triangle, std::span<const Triangle> triangles, std::span<uint64_t> hits, bool test_co_planar = true);
+//==============================================================================================================================
+// end batch intersecting functions
+//==============================================================================================================================
+
 } // namespace Geometry
 DISABLE_WARNING_POP
\ No newline at end of file
@@ -0,0 +1,110 @@
+// The batch intersecting kernels, included by Intersect.cpp once per instruction set with Z_SIMD_TARGET set to the target to compile them for.
+// See SIMD.hpp.
+
+// Hit bits of the AABBs [i, i + Float::Width) of AABBs, bit n is set if AABB i + n intersects the shape.
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE uint32_t hit_bits(const AABB& AABB, const AABBArray& AABBs, const size_t& i)
+{
+	// Separated along any axis is a miss, as the scalar test.
+	const Float separated =
+		  (Float(AABB.m_max.x) < Float::load(&AABBs.m_min_x[i])) | (Float(AABB.m_min.x) > Float::load(&AABBs.m_max_x[i]))
+		| (Float(AABB.m_max.y) < Float::load(&AABBs.m_min_y[i])) | (Float(AABB.m_min.y) > Float::load(&AABBs.m_max_y[i]))
+		| (Float(AABB.m_max.z) < Float::load(&AABBs.m_min_z[i])) | (Float(AABB.m_min.z) > Float::load(&AABBs.m_max_z[i]));
+	return ~separated.bits() & ((1u << Float::Width) - 1u);
+}
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE uint32_t hit_bits(const Frustrum& frustrum, const AABBArray& AABBs, const size_t& i)
+{
+	const Float min_x = Float::load(&AABBs.m_min_x[i]), max_x = Float::load(&AABBs.m_max_x[i]);
+	const Float min_y = Float::load(&AABBs.m_min_y[i]), max_y = Float::load(&AABBs.m_max_y[i]);
+	const Float min_z = Float::load(&AABBs.m_min_z[i]), max_z = Float::load(&AABBs.m_max_z[i]);
+
+	// The positive vertex depends only on the plane normal so is selected once for all the lanes.
+	Float outside(0.f);
+	for (const Plane* plane : {&frustrum.m_left, &frustrum.m_right, &frustrum.m_bottom, &frustrum.m_top, &frustrum.m_near, &frustrum.m_far})
+	{
+		const Float distance = ((Float(plane->m_normal.x) * (plane->m_normal.x >= 0.f ? max_x : min_x)
+		                       + Float(plane->m_normal.y) * (plane->m_normal.y >= 0.f ? max_y : min_y))
+		                       + Float(plane->m_normal.z) * (plane->m_normal.z >= 0.f ? max_z : min_z))
+		                       + Float(plane->m_distance);
+		outside = outside | (distance < Float(0.f));
+	}
+	return ~outside.bits() & ((1u << Float::Width) - 1u);
+}
+// Displacement of p_center from the AABBs clamped to [p_min, p_max], matching glm::clamp(x, min, max) == min(max(x, min), max).
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE Float clamp_displacement(const float& p_center, const float* p_min, const float* p_max)
+{
+	const Float center(p_center);
+	const Float low         = Float::load(p_min);
+	const Float high        = Float::load(p_max);
+	const Float clamped_low = select(center < low, low, center);
+	return center - select(high < clamped_low, high, clamped_low);
+}
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE uint32_t hit_bits(const Sphere& sphere, const AABBArray& AABBs, const size_t& i)
+{
+	const Float dx = clamp_displacement<Float>(sphere.m_center.x, &AABBs.m_min_x[i], &AABBs.m_max_x[i]);
+	const Float dy = clamp_displacement<Float>(sphere.m_center.y, &AABBs.m_min_y[i], &AABBs.m_max_y[i]);
+	const Float dz = clamp_displacement<Float>(sphere.m_center.z, &AABBs.m_min_z[i], &AABBs.m_max_z[i]);
+	const Float outside = ((dx * dx + dy * dy) + dz * dz) > Float(sphere.m_radius * sphere.m_radius);
+	return ~outside.bits() & ((1u << Float::Width) - 1u);
+}
+
+// Set the hit bits of every AABB, Float::Width at a time. Float::Width divides 64 so the bits of a block never straddle two words.
+template <typename Float, typename Shape>
+Z_SIMD_TARGET void set_hits(const Shape& p_shape, const AABBArray& p_AABBs, std::span<uint64_t> p_hits)
+{
+	const size_t simd_end = (p_AABBs.size() / Float::Width) * Float::Width;
+	for (size_t i = 0; i < simd_end; i += Float::Width)
+		p_hits[i / 64] |= uint64_t(hit_bits<Float>(p_shape, p_AABBs, i)) << (i % 64);
+	set_hits_scalar(p_shape, p_AABBs, p_hits, simd_end);
+}
+
+// Bits of the triangles [i, i + Float::Width) of p_triangles with every point strictly further than the Epsilon snap from p_plane on the
+// same side. triangle_triangle rejects these on its first test, the rest need the full test. Distances computed as plane_distances.
+// The points of the block are gathered into lanes, the triangles are stored as points.
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE uint32_t one_side_bits(const TrianglePlane& p_plane, std::span<const Triangle> p_triangles, const size_t& i)
+{
+	const Float side(Use_Epsilon_Test ? Epsilon : 0.f);
+	uint32_t positive = (1u << Float::Width) - 1u;
+	uint32_t negative = positive;
+	for (const glm::vec3 Triangle::* point : {&Triangle::m_point_1, &Triangle::m_point_2, &Triangle::m_point_3})
+	{
+		std::array<float, Float::Width> x, y, z;
+		for (size_t lane = 0; lane < Float::Width; lane++)
+		{
+			const glm::vec3& position = p_triangles[i + lane].*point;
+			x[lane] = position.x;
+			y[lane] = position.y;
+			z[lane] = position.z;
+		}
+		const Float distance = ((Float(p_plane.m_normal.x) * Float::load(x.data())
+		                       + Float(p_plane.m_normal.y) * Float::load(y.data()))
+		                       + Float(p_plane.m_normal.z) * Float::load(z.data()))
+		                       + Float(p_plane.m_d);
+		positive &= (distance > side).bits();
+		negative &= (distance < -side).bits();
+	}
+	return positive | negative;
+}
+
+// Set the hit bits of every triangle of p_triangles intersecting p_triangle. Blocks of Float::Width triangles are first rejected against
+// p_plane, the plane of p_triangle, only the remaining triangles are tested with triangle_triangle.
+template <typename Float>
+Z_SIMD_TARGET void set_triangle_hits(const Triangle& p_triangle, const TrianglePlane& p_plane, std::span<const Triangle> p_triangles, std::span<uint64_t> p_hits, const bool& p_test_co_planar)
+{
+	const size_t simd_end = (p_triangles.size() / Float::Width) * Float::Width;
+	for (size_t i = 0; i < simd_end; i += Float::Width)
+	{
+		// Clear the lowest set bit each iteration, visiting only the candidates.
+		for (uint32_t candidates = ~one_side_bits<Float>(p_plane, p_triangles, i) & ((1u << Float::Width) - 1u); candidates != 0; candidates &= candidates - 1)
+		{
+			const size_t index = i + static_cast<size_t>(std::countr_zero(candidates));
+			if (triangle_triangle(p_triangle, p_plane, p_triangles[index], p_test_co_planar))
+				p_hits[index / 64] |= uint64_t(1) << (index % 64);
+		}
+	}
+	set_triangle_hits_scalar(p_triangle, p_plane, p_triangles, p_hits, p_test_co_planar, simd_end);
+}
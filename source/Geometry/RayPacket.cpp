@@ -0,0 +1,92 @@
+#include "RayPacket.hpp"
+
+#include "SIMD.hpp"
+
+#include "Utility/Logger.hpp"
+
+namespace Geometry
+{
+	namespace
+	{
+		using SIMD::FloatScalar;
+#if defined(Z_SIMD_SSE2)
+		using SIMD::FloatSSE2;
+#endif
+#if defined(Z_SIMD_AVX2)
+		using SIMD::FloatAVX2;
+#endif
+
+#define Z_SIMD_TARGET
+		namespace Kernel
+		{
+			#include "RayPacketKernel.inl"
+		}
+#undef Z_SIMD_TARGET
+#if defined(Z_SIMD_AVX2)
+	#define Z_SIMD_TARGET Z_TARGET_AVX2
+		namespace KernelAVX2
+		{
+			#include "RayPacketKernel.inl"
+		}
+	#undef Z_SIMD_TARGET
+#endif
+
+		// Slab test with the widest SIMD kernel the CPU supports.
+		uint32_t slab_test(const AABB& p_AABB, const RayPacket& p_packet, float* p_distances)
+		{
+#if defined(Z_SIMD_SSE2)
+			if (SIMD::use_AVX2())
+				return KernelAVX2::slab_test<FloatAVX2>(p_AABB, p_packet, p_distances);
+			else
+				return Kernel::slab_test<FloatSSE2>(p_AABB, p_packet, p_distances);
+#else
+			return Kernel::slab_test<FloatScalar>(p_AABB, p_packet, p_distances);
+#endif
+		}
+	} // namespace
+
+	RayPacket::RayPacket(const Ray* p_rays, const size_t& p_count, const float& p_max_distance)
+		: m_start_x{}
+		, m_start_y{}
+		, m_start_z{}
+		, m_inverse_direction_x{}
+		, m_inverse_direction_y{}
+		, m_inverse_direction_z{}
+		, m_max_distance{}
+		, m_count{p_count}
+	{
+		ASSERT(p_count <= Size, "RayPacket holds at most RayPacket::Size rays.");
+
+		// Unused lanes get a unit ray so their slab tests stay finite, the negative max distance stops them hitting.
+		const auto unused = Ray(glm::vec3(0.f), glm::vec3(1.f));
+		for (size_t i = 0; i < Size; i++)
+		{
+			const auto& ray = i < p_count ? p_rays[i] : unused;
+			m_start_x[i]             = ray.m_start.x;
+			m_start_y[i]             = ray.m_start.y;
+			m_start_z[i]             = ray.m_start.z;
+			m_inverse_direction_x[i] = 1.f / ray.m_direction.x;
+			m_inverse_direction_y[i] = 1.f / ray.m_direction.y;
+			m_inverse_direction_z[i] = 1.f / ray.m_direction.z;
+			m_max_distance[i]        = i < p_count ? p_max_distance : -1.f;
+		}
+	}
+
+	uint32_t RayPacket::active_lanes() const
+	{
+		uint32_t active = 0;
+		for (size_t i = 0; i < Size; i++)
+			if (m_max_distance[i] >= 0.f)
+				active |= 1u << i;
+		return active;
+	}
+
+	uint32_t intersecting(const AABB& p_AABB, const RayPacket& p_packet)
+	{
+		return slab_test(p_AABB, p_packet, nullptr);
+	}
+	uint32_t get_intersection(const AABB& p_AABB, const RayPacket& p_packet, std::array<float, RayPacket::Size>& p_distances)
+	{
+		return slab_test(p_AABB, p_packet, p_distances.data());
+	}
+} // namespace Geometry
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Geometry/AABB.hpp"
+#include "Geometry/Ray.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace Geometry
+{
+	// Up to Size rays stored as a structure of arrays so one AABB is slab tested against every ray of the packet in a single SIMD pass.
+	// Packets share traversals of spatial structures, AABBTree::query(RayPacket) visits a node if any ray of the packet enters it.
+	// Reference: Ray Tracing Animated Scenes using Coherent Grid Traversal (Wald et al.) - packet traversal
+	struct RayPacket
+	{
+		static constexpr size_t Size = 8; // One AVX register or two SSE registers per component.
+
+		// Pack p_rays[0, p_count), at most Size rays. Lanes past p_count are unused and never hit.
+		//@param p_max_distance Hits farther along each ray than this, in multiples of its direction, are ignored.
+		RayPacket(const Ray* p_rays, const size_t& p_count, const float& p_max_distance = std::numeric_limits<float>::max());
+
+		// Stop lane p_lane hitting anything farther than p_distance. Pass a negative distance to retire the lane so it hits nothing.
+		void set_max_distance(const size_t& p_lane, const float& p_distance) { m_max_distance[p_lane] = p_distance; }
+		// Bit i set for every lane that can still hit something.
+		[[nodiscard]] uint32_t active_lanes() const;
+
+		std::array<float, Size> m_start_x;
+		std::array<float, Size> m_start_y;
+		std::array<float, Size> m_start_z;
+		std::array<float, Size> m_inverse_direction_x; // 1 / direction, infinite where the ray is parallel to the axis.
+		std::array<float, Size> m_inverse_direction_y;
+		std::array<float, Size> m_inverse_direction_z;
+		std::array<float, Size> m_max_distance; // Negative for unused or retired lanes.
+		size_t m_count;
+	};
+
+	// Bit i of the result is set if ray i of p_packet enters p_AABB no farther than its max distance. Makes RayPacket a valid AABBTree::query shape.
+	// A ray starting inside p_AABB enters it at distance 0, an AABB behind a ray is not hit.
+	// Rays lying exactly in the plane of a face they are parallel to can miss.
+	uint32_t intersecting(const AABB& p_AABB, const RayPacket& p_packet);
+	// As intersecting(AABB, RayPacket), also writing the distance along each ray it enters p_AABB to p_distances. Only the lanes hit are valid.
+	uint32_t get_intersection(const AABB& p_AABB, const RayPacket& p_packet, std::array<float, RayPacket::Size>& p_distances);
+} // namespace Geometry
@@ -0,0 +1,49 @@
+// The RayPacket slab test kernel, included by RayPacket.cpp once per instruction set with Z_SIMD_TARGET set to the target to compile it for.
+// See SIMD.hpp.
+
+// Narrow p_entry and p_exit of the lanes [lane, lane + Float::Width) to the slab [p_min, p_max] of one axis.
+// A ray parallel to a slab has an infinite inverse direction, giving infinite entry and exit distances of the correct sign when
+// it starts outside the slab. Starting on a slab plane gives 0 * inf = NaN which is dropped by passing it as the first operand of min/max.
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE void slab(const float& p_min, const float& p_max, const float* p_start, const float* p_inverse_direction, Float& p_entry, Float& p_exit)
+{
+	const Float start             = Float::load(p_start);
+	const Float inverse_direction = Float::load(p_inverse_direction);
+	const Float t_1 = (Float(p_min) - start) * inverse_direction;
+	const Float t_2 = (Float(p_max) - start) * inverse_direction;
+	p_entry = max(min(t_1, t_2), p_entry);
+	p_exit  = min(max(t_1, t_2), p_exit);
+}
+// Bit n set if lane n enters the AABB no later than it exits. Entry and exit are never NaN, the NaNs of slab were dropped.
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE uint32_t entered_bits(const Float& p_entry, const Float& p_exit)
+{
+	return ~(p_exit < p_entry).bits() & ((1u << Float::Width) - 1u);
+}
+Z_SIMD_TARGET Z_FORCE_INLINE uint32_t entered_bits(const FloatScalar& p_entry, const FloatScalar& p_exit)
+{
+	return p_entry.m_value <= p_exit.m_value ? 1u : 0u;
+}
+
+// Slab test p_AABB against every lane of p_packet Float::Width lanes at a time, as get_intersection(AABB, Ray) per lane.
+// Reference: Fast, Branchless Ray/Bounding Box Intersections (Tavian Barnes)
+template <typename Float>
+Z_SIMD_TARGET uint32_t slab_test(const AABB& p_AABB, const RayPacket& p_packet, float* p_distances)
+{
+	static_assert(RayPacket::Size % Float::Width == 0, "RayPacket::Size must be a multiple of the SIMD width.");
+
+	uint32_t hits = 0;
+	for (size_t lane = 0; lane < RayPacket::Size; lane += Float::Width)
+	{
+		Float entry = Float(0.f);
+		Float exit  = Float::load(&p_packet.m_max_distance[lane]);
+		slab<Float>(p_AABB.m_min.x, p_AABB.m_max.x, &p_packet.m_start_x[lane], &p_packet.m_inverse_direction_x[lane], entry, exit);
+		slab<Float>(p_AABB.m_min.y, p_AABB.m_max.y, &p_packet.m_start_y[lane], &p_packet.m_inverse_direction_y[lane], entry, exit);
+		slab<Float>(p_AABB.m_min.z, p_AABB.m_max.z, &p_packet.m_start_z[lane], &p_packet.m_inverse_direction_z[lane], entry, exit);
+
+		if (p_distances)
+			entry.store(p_distances + lane);
+		hits |= entered_bits(entry, exit) << lane;
+	}
+	return hits;
+}
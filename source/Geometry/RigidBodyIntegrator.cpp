@@ -0,0 +1,87 @@
+#include "RigidBodyIntegrator.hpp"
+
+#include "SIMD.hpp"
+
+#include "Utility/Logger.hpp"
+
+namespace Geometry
+{
+	namespace
+	{
+		using SIMD::FloatScalar;
+#if defined(Z_SIMD_SSE2)
+		using SIMD::FloatSSE2;
+#endif
+#if defined(Z_SIMD_AVX2)
+		using SIMD::FloatAVX2;
+#endif
+
+#define Z_SIMD_TARGET
+		namespace Kernel
+		{
+			#include "RigidBodyIntegratorKernel.inl"
+		}
+#undef Z_SIMD_TARGET
+#if defined(Z_SIMD_AVX2)
+	#define Z_SIMD_TARGET Z_TARGET_AVX2
+		namespace KernelAVX2
+		{
+			#include "RigidBodyIntegratorKernel.inl"
+		}
+	#undef Z_SIMD_TARGET
+#endif
+
+		// Integrate as much of [p_begin, p_end) as fits the widest SIMD kernel the CPU supports.
+		//@return The end of the bodies integrated, the bodies after it are left for the scalar path.
+		size_t integrate_SIMD(RigidBodyBatch& p_bodies, const float& p_delta_time, const size_t& p_begin, const size_t& p_end)
+		{
+#if defined(Z_SIMD_AVX2)
+			if (SIMD::use_AVX2())
+			{
+				const size_t simd_end = p_begin + ((p_end - p_begin) / FloatAVX2::Width) * FloatAVX2::Width;
+				KernelAVX2::integrate_range<FloatAVX2>(p_bodies, p_delta_time, p_begin, simd_end);
+				return simd_end;
+			}
+#endif
+#if defined(Z_SIMD_SSE2)
+			const size_t simd_end = p_begin + ((p_end - p_begin) / FloatSSE2::Width) * FloatSSE2::Width;
+			Kernel::integrate_range<FloatSSE2>(p_bodies, p_delta_time, p_begin, simd_end);
+			return simd_end;
+#else
+			(void)p_bodies; (void)p_delta_time; (void)p_end;
+			return p_begin;
+#endif
+		}
+	} // namespace
+
+	void RigidBodyBatch::resize(const size_t& p_size)
+	{
+		m_force.resize(p_size);
+		m_torque.resize(p_size);
+		m_mass.resize(p_size);
+		for (auto& element : m_inverse_inertia_tensor)
+			element.resize(p_size);
+
+		m_position.resize(p_size);
+		m_momentum.resize(p_size);
+		m_angular_momentum.resize(p_size);
+		m_orientation.resize(p_size);
+
+		m_velocity.resize(p_size);
+		m_angular_velocity.resize(p_size);
+		m_direction.resize(p_size);
+	}
+
+	void integrate(RigidBodyBatch& p_bodies, const float& p_delta_time, const IntegrationMode& p_mode, const size_t& p_begin, const size_t& p_end)
+	{
+		ASSERT(p_begin <= p_end && p_end <= p_bodies.size(), "Integration range out of bounds of the RigidBodyBatch");
+
+		const size_t scalar_begin = p_mode == IntegrationMode::SIMD ? integrate_SIMD(p_bodies, p_delta_time, p_begin, p_end) : p_begin;
+		Kernel::integrate_range<FloatScalar>(p_bodies, p_delta_time, scalar_begin, p_end);
+	}
+
+	const char* get_SIMD_instruction_set()
+	{
+		return SIMD::get_instruction_set();
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "glm/gtc/quaternion.hpp"
+#include "glm/vec3.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+	// Structure of arrays state of a batch of rigid bodies, each array holds one element per body.
+	// Bodies are stored per component so integrate can load the same component of several bodies into one SIMD register.
+	struct RigidBodyBatch
+	{
+		struct Vec3Array
+		{
+			std::vector<float> x, y, z;
+
+			void set(const size_t& p_index, const glm::vec3& p_value) { x[p_index] = p_value.x; y[p_index] = p_value.y; z[p_index] = p_value.z; }
+			[[nodiscard]] glm::vec3 get(const size_t& p_index) const  { return glm::vec3(x[p_index], y[p_index], z[p_index]); }
+			void resize(const size_t& p_size)                         { x.resize(p_size); y.resize(p_size); z.resize(p_size); }
+		};
+		struct QuatArray
+		{
+			std::vector<float> w, x, y, z;
+
+			void set(const size_t& p_index, const glm::quat& p_value) { w[p_index] = p_value.w; x[p_index] = p_value.x; y[p_index] = p_value.y; z[p_index] = p_value.z; }
+			[[nodiscard]] glm::quat get(const size_t& p_index) const  { return glm::quat(w[p_index], x[p_index], y[p_index], z[p_index]); }
+			void resize(const size_t& p_size)                         { w.resize(p_size); x.resize(p_size); y.resize(p_size); z.resize(p_size); }
+		};
+
+		// Inputs
+		Vec3Array m_force;  // Total force F acting over the step including gravity (N).
+		Vec3Array m_torque; // T (N m)
+		std::vector<float> m_mass;                                  // m (kg)
+		std::array<std::vector<float>, 9> m_inverse_inertia_tensor; // World-space I⁻¹ column major, element [column * 3 + row].
+
+		// Inputs updated by integrate
+		Vec3Array m_position;
+		Vec3Array m_momentum;         // p
+		Vec3Array m_angular_momentum; // L
+		QuatArray m_orientation;
+
+		// Outputs
+		Vec3Array m_velocity;                    // v
+		Vec3Array m_angular_velocity;            // ω
+		Vec3Array m_direction;        // Starting_Forward_Direction (0,0,-1) rotated by the orientation.
+
+		void resize(const size_t& p_size);
+		[[nodiscard]] size_t size() const { return m_mass.size(); }
+	};
+
+	enum class IntegrationMode : uint8_t
+	{
+		Scalar, // One body at a time. The reference for testing IntegrationMode::SIMD against.
+		SIMD    // 8 bodies at a time with AVX2 if the CPU supports it or 4 with SSE2, bodies left over at the end of the range use the scalar path.
+	};
+
+	// Integrate the bodies [p_begin, p_end) of p_bodies forward by p_delta_time seconds using semi-implicit Euler.
+	// Scalar and SIMD modes perform the same sequence of IEEE operations per body so produce bit-for-bit identical results.
+	// Ranges that don't overlap can be integrated concurrently.
+	void integrate(RigidBodyBatch& p_bodies, const float& p_delta_time, const IntegrationMode& p_mode, const size_t& p_begin, const size_t& p_end);
+	// The instruction set IntegrationMode::SIMD uses on this CPU: "AVX2", "SSE2" or "None" where SIMD falls back to Scalar.
+	const char* get_SIMD_instruction_set();
+}
@@ -0,0 +1,108 @@
+// The integrate_range kernel, included by RigidBodyIntegrator.cpp once per instruction set with Z_SIMD_TARGET set to the target to compile it for.
+// See SIMD.hpp.
+
+// Component p_row of ω = I⁻¹ L, dot(row p_row of I⁻¹, L).
+template <typename Float>
+Z_SIMD_TARGET Z_FORCE_INLINE Float L_dot_row(const RigidBodyBatch& p_bodies, const Float& p_L_x, const Float& p_L_y, const Float& p_L_z, const size_t& p_row, const size_t& i)
+{
+	return (p_L_x * Float::load(&p_bodies.m_inverse_inertia_tensor[p_row][i])
+		  + p_L_y * Float::load(&p_bodies.m_inverse_inertia_tensor[3 + p_row][i]))
+		  + p_L_z * Float::load(&p_bodies.m_inverse_inertia_tensor[6 + p_row][i]);
+}
+
+// Integrate bodies [p_begin, p_end) Float::Width at a time, p_end - p_begin must be a multiple of Float::Width.
+template <typename Float>
+Z_SIMD_TARGET void integrate_range(RigidBodyBatch& p_bodies, const float& p_delta_time, const size_t& p_begin, const size_t& p_end)
+{
+	const Float dt(p_delta_time);
+	const Float half(0.5f);
+	const Float one(1.f);
+	const Float two(2.f);
+	auto& b = p_bodies;
+
+	for (size_t i = p_begin; i < p_end; i += Float::Width)
+	{
+		{ // Linear motion
+			const Float mass = Float::load(&b.m_mass[i]);
+
+			// Change in momentum is equal to the force: dp = F dt
+			const Float momentum_x = Float::load(&b.m_momentum.x[i]) + Float::load(&b.m_force.x[i]) * dt;
+			const Float momentum_y = Float::load(&b.m_momentum.y[i]) + Float::load(&b.m_force.y[i]) * dt;
+			const Float momentum_z = Float::load(&b.m_momentum.z[i]) + Float::load(&b.m_force.z[i]) * dt;
+			momentum_x.store(&b.m_momentum.x[i]);
+			momentum_y.store(&b.m_momentum.y[i]);
+			momentum_z.store(&b.m_momentum.z[i]);
+
+			// v = p / m
+			const Float velocity_x = momentum_x / mass;
+			const Float velocity_y = momentum_y / mass;
+			const Float velocity_z = momentum_z / mass;
+			velocity_x.store(&b.m_velocity.x[i]);
+			velocity_y.store(&b.m_velocity.y[i]);
+			velocity_z.store(&b.m_velocity.z[i]);
+
+			// dx = v dt
+			(Float::load(&b.m_position.x[i]) + velocity_x * dt).store(&b.m_position.x[i]);
+			(Float::load(&b.m_position.y[i]) + velocity_y * dt).store(&b.m_position.y[i]);
+			(Float::load(&b.m_position.z[i]) + velocity_z * dt).store(&b.m_position.z[i]);
+		}
+
+		// Angular motion
+		// dL = T dt
+		const Float angular_momentum_x = Float::load(&b.m_angular_momentum.x[i]) + Float::load(&b.m_torque.x[i]) * dt;
+		const Float angular_momentum_y = Float::load(&b.m_angular_momentum.y[i]) + Float::load(&b.m_torque.y[i]) * dt;
+		const Float angular_momentum_z = Float::load(&b.m_angular_momentum.z[i]) + Float::load(&b.m_torque.z[i]) * dt;
+		angular_momentum_x.store(&b.m_angular_momentum.x[i]);
+		angular_momentum_y.store(&b.m_angular_momentum.y[i]);
+		angular_momentum_z.store(&b.m_angular_momentum.z[i]);
+
+		// ω = I⁻¹ L
+		const Float angular_velocity_x = L_dot_row(b, angular_momentum_x, angular_momentum_y, angular_momentum_z, 0, i);
+		const Float angular_velocity_y = L_dot_row(b, angular_momentum_x, angular_momentum_y, angular_momentum_z, 1, i);
+		const Float angular_velocity_z = L_dot_row(b, angular_momentum_x, angular_momentum_y, angular_momentum_z, 2, i);
+		angular_velocity_x.store(&b.m_angular_velocity.x[i]);
+		angular_velocity_y.store(&b.m_angular_velocity.y[i]);
+		angular_velocity_z.store(&b.m_angular_velocity.z[i]);
+
+		Float qw = Float::load(&b.m_orientation.w[i]);
+		Float qx = Float::load(&b.m_orientation.x[i]);
+		Float qy = Float::load(&b.m_orientation.y[i]);
+		Float qz = Float::load(&b.m_orientation.z[i]);
+		{ // Integrate spin = 0.5 * quat(0, ω dt) * orientation. https://www.cs.cmu.edu/~baraff/sigcourse/notesd1.pdf
+			const Float ax = angular_velocity_x * dt;
+			const Float ay = angular_velocity_y * dt;
+			const Float az = angular_velocity_z * dt;
+
+			const Float spin_w = -((ax * qx + ay * qy) + az * qz);
+			const Float spin_x = (ax * qw + ay * qz) - az * qy;
+			const Float spin_y = (ay * qw + az * qx) - ax * qz;
+			const Float spin_z = (az * qw + ax * qy) - ay * qx;
+
+			qw = qw + half * spin_w;
+			qx = qx + half * spin_x;
+			qy = qy + half * spin_y;
+			qz = qz + half * spin_z;
+
+			// The spin is perpendicular to the unit orientation so the length is always >= 1 and safe to divide by.
+			const Float inverse_length = one / sqrt((qw * qw + qx * qx) + (qy * qy + qz * qz));
+			qw = qw * inverse_length;
+			qx = qx * inverse_length;
+			qy = qy * inverse_length;
+			qz = qz * inverse_length;
+			qw.store(&b.m_orientation.w[i]);
+			qx.store(&b.m_orientation.x[i]);
+			qy.store(&b.m_orientation.y[i]);
+			qz.store(&b.m_orientation.z[i]);
+		}
+
+		{ // The forward direction (0,0,-1) rotated by the orientation is the negated third column of its rotation matrix (as glm::mat4_cast).
+			const Float rotation_x = two * (qx * qz + qw * qy);
+			const Float rotation_y = two * (qy * qz - qw * qx);
+			const Float rotation_z = one - two * (qx * qx + qy * qy);
+			const Float inverse_length = one / sqrt((rotation_x * rotation_x + rotation_y * rotation_y) + rotation_z * rotation_z);
+			(-rotation_x * inverse_length).store(&b.m_direction.x[i]);
+			(-rotation_y * inverse_length).store(&b.m_direction.y[i]);
+			(-rotation_z * inverse_length).store(&b.m_direction.z[i]);
+		}
+	}
+}
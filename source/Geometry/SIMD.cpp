@@ -0,0 +1,43 @@
+#include "SIMD.hpp"
+
+#if defined(Z_SIMD_AVX2) && defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+namespace Geometry::SIMD
+{
+	namespace
+	{
+		bool CPU_supports_AVX2()
+		{
+#if !defined(Z_SIMD_AVX2)
+			return false;
+#elif defined(_MSC_VER)
+			// CPUID.1:ECX.OSXSAVE[bit 27] and XCR0 show the OS saves the AVX registers, CPUID.7:EBX.AVX2[bit 5] shows the CPU supports AVX2.
+			int info[4];
+			__cpuid(info, 1);
+			const bool OS_saves_AVX = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+			__cpuidex(info, 7, 0);
+			return OS_saves_AVX && (info[1] & (1 << 5)) != 0;
+#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+#endif
+		}
+	} // namespace
+
+	bool use_AVX2()
+	{
+		static const bool supported = CPU_supports_AVX2();
+		return supported;
+	}
+
+	const char* get_instruction_set()
+	{
+#if defined(Z_SIMD_SSE2)
+		return use_AVX2() ? "AVX2" : "SSE2";
+#else
+		return "None";
+#endif
+	}
+} // namespace Geometry::SIMD
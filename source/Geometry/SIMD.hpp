@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Float vector types shared by the Geometry SIMD kernels (RigidBodyIntegrator, TransformBatch, RayPacket and the batch intersecting functions).
+// Only include this from source files.
+//
+// x86-64 always has SSE2 so the SSE2 kernels are compiled unconditionally. The AVX2 kernels are compiled for the avx2 target and only called
+// when use_AVX2() finds the CPU supports it. The rest of the program is never compiled for AVX2 so it runs on any x86-64 CPU.
+// GCC and Clang only inline AVX2 code into functions compiled for the avx2 target and calls between functions compiled for different targets
+// pass and return __m256 differently, so every function taking or returning FloatAVX2 must be compiled for the avx2 target. A kernel is written
+// as templates over the Float type in a <Name>Kernel.inl file declared with Z_SIMD_TARGET. The source file includes it twice, in namespace Kernel
+// with Z_SIMD_TARGET empty for FloatScalar and FloatSSE2 and in namespace KernelAVX2 with Z_SIMD_TARGET defined as Z_TARGET_AVX2 for FloatAVX2.
+// Lambdas don't inherit the target of the function they are declared in so must not be used in kernels.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define Z_SIMD_SSE2
+	#define Z_SIMD_AVX2
+	#include <immintrin.h>
+#endif
+
+#if defined(Z_SIMD_AVX2) && (defined(__GNUC__) || defined(__clang__))
+	#define Z_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+	#define Z_TARGET_AVX2
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#define Z_FORCE_INLINE __forceinline
+#else
+	#define Z_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace Geometry::SIMD
+{
+	// Does the CPU running the program support AVX2. Checked once and cached.
+	bool use_AVX2();
+	// The instruction set the SIMD kernels use on this CPU: "AVX2", "SSE2" or "None" where they fall back to scalar.
+	const char* get_instruction_set();
+
+	// Every operation maps to a single correctly rounded IEEE operation in every type so each lane computes exactly what FloatScalar computes.
+	// min(a, b) returns b unless a < b and max(a, b) returns b unless a > b in every type, matching the SSE/AVX instructions.
+	// Comparisons of the vector types return a lane mask with every bit of a lane set where true, bits() packs the sign bit of each lane into
+	// the low Width bits.
+	struct FloatScalar
+	{
+		static constexpr size_t Width = 1;
+		float m_value;
+
+		Z_FORCE_INLINE FloatScalar(const float& p_value) : m_value{p_value} {}
+		Z_FORCE_INLINE static FloatScalar load(const float* p_address) { return *p_address; }
+		Z_FORCE_INLINE void store(float* p_address) const               { *p_address = m_value; }
+	};
+	Z_FORCE_INLINE FloatScalar operator+(const FloatScalar& p_lhs, const FloatScalar& p_rhs) { return p_lhs.m_value + p_rhs.m_value; }
+	Z_FORCE_INLINE FloatScalar operator-(const FloatScalar& p_lhs, const FloatScalar& p_rhs) { return p_lhs.m_value - p_rhs.m_value; }
+	Z_FORCE_INLINE FloatScalar operator*(const FloatScalar& p_lhs, const FloatScalar& p_rhs) { return p_lhs.m_value * p_rhs.m_value; }
+	Z_FORCE_INLINE FloatScalar operator/(const FloatScalar& p_lhs, const FloatScalar& p_rhs) { return p_lhs.m_value / p_rhs.m_value; }
+	Z_FORCE_INLINE FloatScalar operator-(const FloatScalar& p_value)                         { return -p_value.m_value; }
+	Z_FORCE_INLINE FloatScalar sqrt(const FloatScalar& p_value)                              { return std::sqrt(p_value.m_value); }
+	Z_FORCE_INLINE FloatScalar min(const FloatScalar& p_lhs, const FloatScalar& p_rhs)       { return p_lhs.m_value < p_rhs.m_value ? p_lhs : p_rhs; }
+	Z_FORCE_INLINE FloatScalar max(const FloatScalar& p_lhs, const FloatScalar& p_rhs)       { return p_lhs.m_value > p_rhs.m_value ? p_lhs : p_rhs; }
+
+#if defined(Z_SIMD_SSE2)
+	struct FloatSSE2
+	{
+		static constexpr size_t Width = 4;
+		__m128 m_value;
+
+		Z_FORCE_INLINE FloatSSE2(const __m128& p_value) : m_value{p_value} {}
+		Z_FORCE_INLINE FloatSSE2(const float& p_value) : m_value{_mm_set1_ps(p_value)} {}
+		Z_FORCE_INLINE static FloatSSE2 load(const float* p_address) { return _mm_loadu_ps(p_address); }
+		Z_FORCE_INLINE void store(float* p_address) const             { _mm_storeu_ps(p_address, m_value); }
+		Z_FORCE_INLINE uint32_t bits() const                          { return static_cast<uint32_t>(_mm_movemask_ps(m_value)); }
+	};
+	Z_FORCE_INLINE FloatSSE2 operator+(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs) { return _mm_add_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 operator-(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs) { return _mm_sub_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 operator*(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs) { return _mm_mul_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 operator/(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs) { return _mm_div_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 operator-(const FloatSSE2& p_value)                       { return _mm_xor_ps(p_value.m_value, _mm_set1_ps(-0.f)); }
+	Z_FORCE_INLINE FloatSSE2 operator|(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs) { return _mm_or_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 operator<(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs) { return _mm_cmplt_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 operator>(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs) { return _mm_cmpgt_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 sqrt(const FloatSSE2& p_value)                            { return _mm_sqrt_ps(p_value.m_value); }
+	Z_FORCE_INLINE FloatSSE2 min(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs)       { return _mm_min_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 max(const FloatSSE2& p_lhs, const FloatSSE2& p_rhs)       { return _mm_max_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_FORCE_INLINE FloatSSE2 select(const FloatSSE2& p_mask, const FloatSSE2& p_true, const FloatSSE2& p_false) { return _mm_or_ps(_mm_and_ps(p_mask.m_value, p_true.m_value), _mm_andnot_ps(p_mask.m_value, p_false.m_value)); }
+#endif
+
+#if defined(Z_SIMD_AVX2)
+	struct FloatAVX2
+	{
+		static constexpr size_t Width = 8;
+		__m256 m_value;
+
+		Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2(const __m256& p_value) : m_value{p_value} {}
+		Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2(const float& p_value) : m_value{_mm256_set1_ps(p_value)} {}
+		Z_TARGET_AVX2 Z_FORCE_INLINE static FloatAVX2 load(const float* p_address) { return _mm256_loadu_ps(p_address); }
+		Z_TARGET_AVX2 Z_FORCE_INLINE void store(float* p_address) const             { _mm256_storeu_ps(p_address, m_value); }
+		Z_TARGET_AVX2 Z_FORCE_INLINE uint32_t bits() const                          { return static_cast<uint32_t>(_mm256_movemask_ps(m_value)); }
+	};
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator+(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs) { return _mm256_add_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator-(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs) { return _mm256_sub_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator*(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs) { return _mm256_mul_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator/(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs) { return _mm256_div_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator-(const FloatAVX2& p_value)                       { return _mm256_xor_ps(p_value.m_value, _mm256_set1_ps(-0.f)); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator|(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs) { return _mm256_or_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator<(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs) { return _mm256_cmp_ps(p_lhs.m_value, p_rhs.m_value, _CMP_LT_OQ); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 operator>(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs) { return _mm256_cmp_ps(p_lhs.m_value, p_rhs.m_value, _CMP_GT_OQ); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 sqrt(const FloatAVX2& p_value)                            { return _mm256_sqrt_ps(p_value.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 min(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs)       { return _mm256_min_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 max(const FloatAVX2& p_lhs, const FloatAVX2& p_rhs)       { return _mm256_max_ps(p_lhs.m_value, p_rhs.m_value); }
+	Z_TARGET_AVX2 Z_FORCE_INLINE FloatAVX2 select(const FloatAVX2& p_mask, const FloatAVX2& p_true, const FloatAVX2& p_false) { return _mm256_blendv_ps(p_false.m_value, p_true.m_value, p_mask.m_value); }
+#endif
+} // namespace Geometry::SIMD
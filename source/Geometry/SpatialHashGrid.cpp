@@ -0,0 +1,235 @@
+#include "SpatialHashGrid.hpp"
+
+#include "Utility/Logger.hpp"
+#include "Utility/ThreadPool.hpp"
+
+#include "glm/glm.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace Geometry
+{
+	namespace
+	{
+		constexpr int Cell_Bits       = 21;
+		constexpr int64_t Cell_Offset = int64_t(1) << (Cell_Bits - 1);
+		constexpr uint64_t Cell_Mask  = (uint64_t(1) << Cell_Bits) - 1;
+
+		uint64_t pack_cell(const int64_t& p_x, const int64_t& p_y, const int64_t& p_z)
+		{
+			// Cells outside +-2^20 wrap around, sharing a key with a distant cell. This only costs extra AABB tests, pairs are still correct.
+			return (uint64_t(p_x + Cell_Offset) & Cell_Mask)
+				| ((uint64_t(p_y + Cell_Offset) & Cell_Mask) << Cell_Bits)
+				| ((uint64_t(p_z + Cell_Offset) & Cell_Mask) << (Cell_Bits * 2));
+		}
+		// Fibonacci hashing of a packed cell into p_bits bits.
+		size_t hash_cell(const uint64_t& p_cell, const int& p_bits)
+		{
+			return p_bits == 0 ? 0 : static_cast<size_t>((p_cell * 0x9E3779B97F4A7C15ull) >> (64 - p_bits));
+		}
+	}
+
+	SpatialHashGrid::SpatialHashGrid(float p_cell_size) noexcept
+		: m_cell_size{p_cell_size}
+		, m_IDs{}
+		, m_mins{}
+		, m_maxs{}
+		, m_filters{}
+		, m_set{}
+		, m_ID_to_index{}
+		, m_bucket_start{}
+		, m_entry_proxy{}
+		, m_entry_cell{}
+		, m_pairs{}
+		, m_range_pairs{}
+	{}
+
+	void SpatialHashGrid::set(const ProxyID& p_ID, const AABB& p_AABB, const CollisionFilter& p_filter)
+	{
+		if (p_ID >= m_ID_to_index.size())
+			m_ID_to_index.resize(p_ID + 1, Invalid_Index);
+
+		auto& index = m_ID_to_index[p_ID];
+		if (index == Invalid_Index)
+		{
+			index = m_IDs.size();
+			m_IDs.push_back(p_ID);
+			m_mins.push_back(p_AABB.m_min);
+			m_maxs.push_back(p_AABB.m_max);
+			m_filters.push_back(p_filter);
+			m_set.push_back(true);
+		}
+		else
+		{
+			m_mins[index]    = p_AABB.m_min;
+			m_maxs[index]    = p_AABB.m_max;
+			m_filters[index] = p_filter;
+			m_set[index]     = true;
+		}
+	}
+	void SpatialHashGrid::keep(const ProxyID& p_ID)
+	{
+		ASSERT(contains(p_ID), "ProxyID is not in the SpatialHashGrid");
+		m_set[m_ID_to_index[p_ID]] = true;
+	}
+	void SpatialHashGrid::remove(const ProxyID& p_ID)
+	{
+		if (p_ID < m_ID_to_index.size() && m_ID_to_index[p_ID] != Invalid_Index)
+			m_set[m_ID_to_index[p_ID]] = false; // Erased in the next find_pairs.
+	}
+	void SpatialHashGrid::clear()
+	{
+		m_IDs.clear();
+		m_mins.clear();
+		m_maxs.clear();
+		m_filters.clear();
+		m_set.clear();
+		m_ID_to_index.clear();
+		m_pairs.clear();
+	}
+	void SpatialHashGrid::set_cell_size(const float& p_cell_size)
+	{
+		ASSERT(p_cell_size > 0.f, "Cell size must be positive");
+		m_cell_size = p_cell_size;
+	}
+
+	SpatialHashGrid::CellKey SpatialHashGrid::get_cell_key(const glm::vec3& p_point) const
+	{
+		const auto cell = glm::floor(p_point / m_cell_size);
+		return pack_cell(static_cast<int64_t>(cell.x), static_cast<int64_t>(cell.y), static_cast<int64_t>(cell.z));
+	}
+
+	const std::vector<std::pair<SpatialHashGrid::ProxyID, SpatialHashGrid::ProxyID>>& SpatialHashGrid::find_pairs(Utility::ThreadPool* p_thread_pool)
+	{
+		m_pairs.clear();
+
+		// Erase the proxies that were not set since the last find_pairs, swapping the last proxy into the gap.
+		for (size_t i = 0; i < m_IDs.size();)
+		{
+			if (m_set[i])
+			{
+				m_set[i] = false;
+				i++;
+				continue;
+			}
+
+			m_ID_to_index[m_IDs[i]] = Invalid_Index;
+			if (i != m_IDs.size() - 1)
+			{
+				m_IDs[i]     = m_IDs.back();
+				m_mins[i]    = m_mins.back();
+				m_maxs[i]    = m_maxs.back();
+				m_filters[i] = m_filters.back();
+				m_set[i]     = m_set.back();
+				m_ID_to_index[m_IDs[i]] = i;
+			}
+			m_IDs.pop_back();
+			m_mins.pop_back();
+			m_maxs.pop_back();
+			m_filters.pop_back();
+			m_set.pop_back();
+		}
+
+		if (m_IDs.empty())
+			return m_pairs;
+
+		// Visit every cell overlapped by proxy p_index.
+		auto foreach_cell = [this](const size_t& p_index, auto&& p_func)
+		{
+			const auto low  = glm::floor(m_mins[p_index] / m_cell_size);
+			const auto high = glm::floor(m_maxs[p_index] / m_cell_size);
+			for (auto z = static_cast<int64_t>(low.z); z <= static_cast<int64_t>(high.z); z++)
+				for (auto y = static_cast<int64_t>(low.y); y <= static_cast<int64_t>(high.y); y++)
+					for (auto x = static_cast<int64_t>(low.x); x <= static_cast<int64_t>(high.x); x++)
+						p_func(pack_cell(x, y, z));
+		};
+
+		{ // Counting sort the cell entries into buckets.
+			size_t entry_count = 0;
+			for (size_t i = 0; i < m_IDs.size(); i++)
+				foreach_cell(i, [&entry_count](const CellKey&) { entry_count++; });
+
+			// Twice as many buckets as entries keeps the chance of unrelated cells sharing a bucket low.
+			const int bucket_bits     = std::bit_width(entry_count * 2 - 1);
+			const size_t bucket_count = size_t(1) << bucket_bits;
+
+			m_bucket_start.assign(bucket_count + 1, 0);
+			for (size_t i = 0; i < m_IDs.size(); i++)
+				foreach_cell(i, [&](const CellKey& p_cell) { m_bucket_start[hash_cell(p_cell, bucket_bits) + 1]++; });
+			for (size_t b = 1; b <= bucket_count; b++)
+				m_bucket_start[b] += m_bucket_start[b - 1];
+
+			m_entry_proxy.resize(entry_count);
+			m_entry_cell.resize(entry_count);
+			std::vector<size_t> bucket_cursor(m_bucket_start.begin(), m_bucket_start.end() - 1);
+			for (size_t i = 0; i < m_IDs.size(); i++)
+			{
+				foreach_cell(i, [&](const CellKey& p_cell)
+				{
+					const size_t entry   = bucket_cursor[hash_cell(p_cell, bucket_bits)]++;
+					m_entry_proxy[entry] = static_cast<uint32_t>(i);
+					m_entry_cell[entry]  = p_cell;
+				});
+			}
+		}
+
+		{ // Generate the pairs, splitting the buckets into fixed ranges. Each range outputs to its own vector.
+			const size_t bucket_count = m_bucket_start.size() - 1;
+			const size_t range_count  = p_thread_pool ? std::clamp(bucket_count / Min_Buckets_Per_Range, size_t(1), p_thread_pool->get_thread_count()) : 1;
+			m_range_pairs.resize(range_count);
+
+			auto find_pairs_in_range = [this, bucket_count, range_count](const size_t& p_begin, const size_t& p_end)
+			{
+				for (size_t range = p_begin; range < p_end; range++)
+					find_pairs_in_buckets(bucket_count * range / range_count, bucket_count * (range + 1) / range_count, m_range_pairs[range]);
+			};
+			if (p_thread_pool)
+				p_thread_pool->parallel_for(range_count, find_pairs_in_range, 1);
+			else
+				find_pairs_in_range(0, range_count);
+
+			for (const auto& range_pairs : m_range_pairs)
+				m_pairs.insert(m_pairs.end(), range_pairs.begin(), range_pairs.end());
+		}
+
+		// Sort to give the same output regardless of how the buckets were split.
+		std::sort(m_pairs.begin(), m_pairs.end());
+		return m_pairs;
+	}
+
+	void SpatialHashGrid::find_pairs_in_buckets(const size_t& p_begin, const size_t& p_end, std::vector<std::pair<ProxyID, ProxyID>>& p_pairs) const
+	{
+		p_pairs.clear();
+
+		for (size_t b = p_begin; b < p_end; b++)
+		{
+			const size_t end = m_bucket_start[b + 1];
+			for (size_t e1 = m_bucket_start[b]; e1 < end; e1++)
+			{
+				const auto i    = m_entry_proxy[e1];
+				const auto cell = m_entry_cell[e1];
+
+				for (size_t e2 = e1 + 1; e2 < end; e2++)
+				{
+					if (m_entry_cell[e2] != cell)
+						continue;
+
+					const auto j = m_entry_proxy[e2];
+					if (!can_collide(m_filters[i], m_filters[j]))
+						continue;
+					if (m_maxs[i].x < m_mins[j].x || m_mins[i].x > m_maxs[j].x
+					 || m_maxs[i].y < m_mins[j].y || m_mins[i].y > m_maxs[j].y
+					 || m_maxs[i].z < m_mins[j].z || m_mins[i].z > m_maxs[j].z)
+						continue;
+
+					// A pair sharing several cells is only output by the cell containing the minimum corner of their overlap.
+					if (get_cell_key(glm::max(m_mins[i], m_mins[j])) != cell)
+						continue;
+
+					p_pairs.push_back(m_IDs[i] < m_IDs[j] ? std::make_pair(m_IDs[i], m_IDs[j]) : std::make_pair(m_IDs[j], m_IDs[i]));
+				}
+			}
+		}
+	}
+} // namespace Geometry
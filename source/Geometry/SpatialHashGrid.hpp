@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Geometry/AABB.hpp"
+#include "Geometry/CollisionFilter.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Utility
+{
+	class ThreadPool;
+}
+namespace Geometry
+{
+	// A uniform grid broadphase finding the pairs of overlapping AABBs in a set, an alternative to SweepAndPrune for many bodies of a similar size.
+	// Each AABB is added to every grid cell it overlaps. Cells are hashed into buckets which are stored contiguously (counting sort) and
+	// the pairs are found by testing the proxies sharing a cell, optionally splitting the buckets across a ThreadPool.
+	// Proxies whose CollisionFilters can't collide are skipped before their AABBs are tested.
+	// Works best with a cell size a little larger than the typical AABB, AABBs much larger than a cell are added to many cells.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 7.1 Uniform Grids pg 285
+	class SpatialHashGrid
+	{
+	public:
+		using ProxyID = size_t; // User supplied identifier per AABB e.g. an ECS::EntityID.
+
+		//@param p_cell_size Width of the cubic grid cells.
+		SpatialHashGrid(float p_cell_size = 1.f) noexcept;
+
+		// Insert or update the AABB and filter of p_ID.
+		// Every proxy must be set before each call to find_pairs, proxies not set since the previous find_pairs are removed.
+		void set(const ProxyID& p_ID, const AABB& p_AABB, const CollisionFilter& p_filter = {});
+		// Keep p_ID through the next find_pairs without changing its AABB or filter, for proxies that haven't moved since they were last set.
+		void keep(const ProxyID& p_ID);
+		// Remove p_ID immediately, it will not appear in the next find_pairs unless set again.
+		void remove(const ProxyID& p_ID);
+		void clear();
+
+		// Rebuild the grid and find all the overlapping pairs.
+		// Each pair is output once with the lower ProxyID first, sorted. The returned reference is valid until the next call to find_pairs.
+		//@param p_thread_pool Generate the pairs in parallel on p_thread_pool, nullptr generates them on the calling thread.
+		const std::vector<std::pair<ProxyID, ProxyID>>& find_pairs(Utility::ThreadPool* p_thread_pool = nullptr);
+		// The pairs output by the last find_pairs.
+		[[nodiscard]] const std::vector<std::pair<ProxyID, ProxyID>>& get_pairs() const { return m_pairs; }
+
+		// Removed proxies are still contained until the next find_pairs erases them.
+		[[nodiscard]] bool contains(const ProxyID& p_ID) const { return p_ID < m_ID_to_index.size() && m_ID_to_index[p_ID] != Invalid_Index; }
+		[[nodiscard]] size_t size() const { return m_IDs.size(); }
+		[[nodiscard]] float get_cell_size() const { return m_cell_size; }
+		void set_cell_size(const float& p_cell_size);
+
+	private:
+		using CellKey = uint64_t; // Cell coordinates packed into 21 bits per axis.
+
+		static constexpr size_t Invalid_Index          = std::numeric_limits<size_t>::max();
+		static constexpr size_t Min_Buckets_Per_Range  = 1024; // Fewest buckets handed to a thread at once.
+
+		CellKey get_cell_key(const glm::vec3& p_point) const;
+		void find_pairs_in_buckets(const size_t& p_begin, const size_t& p_end, std::vector<std::pair<ProxyID, ProxyID>>& p_pairs) const;
+
+		float m_cell_size;
+
+		// Proxies (SoA)
+		std::vector<ProxyID> m_IDs;
+		std::vector<glm::vec3> m_mins;
+		std::vector<glm::vec3> m_maxs;
+		std::vector<CollisionFilter> m_filters;
+		std::vector<bool> m_set;          // Has the proxy been set since the last find_pairs.
+		std::vector<size_t> m_ID_to_index; // Index of each ProxyID in the proxy arrays or Invalid_Index.
+
+		// Cell entries grouped by bucket (SoA). Entries of bucket b are [m_bucket_start[b], m_bucket_start[b + 1]).
+		std::vector<size_t> m_bucket_start;
+		std::vector<uint32_t> m_entry_proxy;  // Index into the proxy arrays.
+		std::vector<CellKey> m_entry_cell;    // The cell of the entry, buckets can contain more than one cell.
+
+		std::vector<std::pair<ProxyID, ProxyID>> m_pairs;
+		std::vector<std::vector<std::pair<ProxyID, ProxyID>>> m_range_pairs; // Pairs output per range of buckets before being joined into m_pairs.
+	};
+} // namespace Geometry
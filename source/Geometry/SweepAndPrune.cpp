@@ -0,0 +1,144 @@
+#include "SweepAndPrune.hpp"
+
+#include "Utility/Logger.hpp"
+
+#include <algorithm>
+
+namespace Geometry
+{
+	void SweepAndPrune::set(const ProxyID& p_ID, const AABB& p_AABB, const CollisionFilter& p_filter)
+	{
+		if (p_ID >= m_ID_to_index.size())
+			m_ID_to_index.resize(p_ID + 1, Invalid_Index);
+
+		auto& index = m_ID_to_index[p_ID];
+		if (index == Invalid_Index)
+		{
+			index = m_proxies.size();
+			m_proxies.push_back({p_AABB, p_ID, p_filter, true});
+			m_inserted_since_sort++;
+		}
+		else
+		{
+			m_proxies[index].m_AABB   = p_AABB;
+			m_proxies[index].m_filter = p_filter;
+			m_proxies[index].m_set    = true;
+		}
+	}
+	void SweepAndPrune::keep(const ProxyID& p_ID)
+	{
+		ASSERT(contains(p_ID), "ProxyID is not in the SweepAndPrune");
+		m_proxies[m_ID_to_index[p_ID]].m_set = true;
+	}
+	void SweepAndPrune::remove(const ProxyID& p_ID)
+	{
+		if (p_ID >= m_ID_to_index.size() || m_ID_to_index[p_ID] == Invalid_Index)
+			return;
+
+		// Erasing keeps the remaining proxies in sorted order, the proxies after it shift down one index.
+		const size_t index = m_ID_to_index[p_ID];
+		m_proxies.erase(m_proxies.begin() + index);
+		m_ID_to_index[p_ID] = Invalid_Index;
+		for (size_t i = index; i < m_proxies.size(); i++)
+			m_ID_to_index[m_proxies[i].m_ID] = i;
+	}
+	void SweepAndPrune::clear()
+	{
+		m_proxies.clear();
+		m_ID_to_index.clear();
+		m_pairs.clear();
+		m_inserted_since_sort = 0;
+	}
+
+	const std::vector<std::pair<SweepAndPrune::ProxyID, SweepAndPrune::ProxyID>>& SweepAndPrune::find_pairs()
+	{
+		m_pairs.clear();
+
+		{ // Erase the proxies that were not set since the last find_pairs.
+			auto erase_from = std::remove_if(m_proxies.begin(), m_proxies.end(), [this](const Proxy& p_proxy)
+			{
+				if (!p_proxy.m_set)
+					m_ID_to_index[p_proxy.m_ID] = Invalid_Index;
+				return !p_proxy.m_set;
+			});
+			m_proxies.erase(erase_from, m_proxies.end());
+		}
+
+		{ // Sort by the minimum on the sweep axis.
+			const int axis = m_sweep_axis;
+			// Insertion sort is adaptive, with only small movements between ticks the proxies are mostly sorted already.
+			// When many proxies were appended or the axis changed the order is mostly random and std::sort is used instead.
+			if (m_sweep_axis_changed || m_inserted_since_sort > m_proxies.size() / 8)
+				std::sort(m_proxies.begin(), m_proxies.end(), [axis](const Proxy& p_lhs, const Proxy& p_rhs) { return p_lhs.m_AABB.m_min[axis] < p_rhs.m_AABB.m_min[axis]; });
+			else
+			{
+				for (size_t i = 1; i < m_proxies.size(); i++)
+				{
+					if (!(m_proxies[i].m_AABB.m_min[axis] < m_proxies[i - 1].m_AABB.m_min[axis]))
+						continue;
+
+					Proxy proxy = m_proxies[i];
+					size_t j    = i;
+					for (; j > 0 && proxy.m_AABB.m_min[axis] < m_proxies[j - 1].m_AABB.m_min[axis]; j--)
+						m_proxies[j] = m_proxies[j - 1];
+					m_proxies[j] = proxy;
+				}
+			}
+
+			m_inserted_since_sort = 0;
+			m_sweep_axis_changed  = false;
+			for (size_t i = 0; i < m_proxies.size(); i++)
+				m_ID_to_index[m_proxies[i].m_ID] = i;
+		}
+
+		// Sweep the sorted proxies. Only the proxies starting before the end of proxy i on the sweep axis can overlap it.
+		// The variance of the AABB centers is accumulated alongside to pick the sweep axis with the greatest spread for the next call.
+		glm::vec3 center_sum         = glm::vec3(0.f);
+		glm::vec3 center_squared_sum = glm::vec3(0.f);
+		const int axis_1 = (m_sweep_axis + 1) % 3;
+		const int axis_2 = (m_sweep_axis + 2) % 3;
+
+		for (size_t i = 0; i < m_proxies.size(); i++)
+		{
+			auto& proxy = m_proxies[i];
+			proxy.m_set = false;
+
+			const auto center   = proxy.m_AABB.get_center();
+			center_sum         += center;
+			center_squared_sum += center * center;
+
+			for (size_t j = i + 1; j < m_proxies.size(); j++)
+			{
+				const auto& other = m_proxies[j];
+				if (other.m_AABB.m_min[m_sweep_axis] > proxy.m_AABB.m_max[m_sweep_axis])
+					break;
+				if (!can_collide(proxy.m_filter, other.m_filter))
+					continue;
+
+				if (proxy.m_AABB.m_max[axis_1] < other.m_AABB.m_min[axis_1] || proxy.m_AABB.m_min[axis_1] > other.m_AABB.m_max[axis_1]
+				 || proxy.m_AABB.m_max[axis_2] < other.m_AABB.m_min[axis_2] || proxy.m_AABB.m_min[axis_2] > other.m_AABB.m_max[axis_2])
+					continue;
+
+				m_pairs.push_back(std::minmax(proxy.m_ID, other.m_ID));
+			}
+		}
+
+		if (!m_proxies.empty())
+		{
+			const auto count    = static_cast<float>(m_proxies.size());
+			const auto variance = center_squared_sum - (center_sum * center_sum) / count;
+
+			int greatest_axis = 0;
+			if (variance[1] > variance[greatest_axis]) greatest_axis = 1;
+			if (variance[2] > variance[greatest_axis]) greatest_axis = 2;
+
+			if (greatest_axis != m_sweep_axis)
+			{
+				m_sweep_axis         = greatest_axis;
+				m_sweep_axis_changed = true;
+			}
+		}
+
+		return m_pairs;
+	}
+} // namespace Geometry
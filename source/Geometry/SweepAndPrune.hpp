@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Geometry/AABB.hpp"
+#include "Geometry/CollisionFilter.hpp"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Geometry
+{
+	// A persistent sweep-and-prune broadphase finding the pairs of overlapping AABBs in a set.
+	// Proxies stay sorted by their minimum on the sweep axis between calls to find_pairs. Bodies move little between physics ticks so
+	// re-sorting with an insertion sort is close to O(n), the sweep then only tests the proxies overlapping on the sweep axis.
+	// Proxies whose CollisionFilters can't collide are skipped before the remaining axes are tested.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 7.5 Sorting and Sweeping Methods pg 329
+	class SweepAndPrune
+	{
+	public:
+		using ProxyID = size_t; // User supplied identifier per AABB e.g. an ECS::EntityID. IDs index a lookup table so should be densely packed.
+
+		// Insert or update the AABB and filter of p_ID.
+		// Every proxy must be set before each call to find_pairs, proxies not set since the previous find_pairs are removed.
+		void set(const ProxyID& p_ID, const AABB& p_AABB, const CollisionFilter& p_filter = {});
+		// Keep p_ID through the next find_pairs without changing its AABB or filter, for proxies that haven't moved since they were last set.
+		void keep(const ProxyID& p_ID);
+		// Erase the proxy of p_ID now, it is in no pairs output by later calls to find_pairs unless set again.
+		// The proxies after it shift down to stay sorted. Proxies that are no longer set are erased by find_pairs without calling remove.
+		void remove(const ProxyID& p_ID);
+		void clear();
+
+		// Re-sort the proxies and sweep them to find all the overlapping pairs.
+		// Each pair is output once with the lower ProxyID first. The returned reference is valid until the next call to find_pairs.
+		const std::vector<std::pair<ProxyID, ProxyID>>& find_pairs();
+		// The pairs output by the last find_pairs.
+		[[nodiscard]] const std::vector<std::pair<ProxyID, ProxyID>>& get_pairs() const { return m_pairs; }
+
+		[[nodiscard]] bool contains(const ProxyID& p_ID) const { return p_ID < m_ID_to_index.size() && m_ID_to_index[p_ID] != Invalid_Index; }
+		[[nodiscard]] size_t size() const { return m_proxies.size(); }
+		[[nodiscard]] int get_sweep_axis() const { return m_sweep_axis; }
+
+	private:
+		static constexpr size_t Invalid_Index = std::numeric_limits<size_t>::max();
+
+		struct Proxy
+		{
+			AABB m_AABB;
+			ProxyID m_ID;
+			CollisionFilter m_filter;
+			bool m_set; // Has this proxy been set since the last find_pairs.
+		};
+
+		std::vector<Proxy> m_proxies;                     // Sorted by m_AABB.m_min[m_sweep_axis] as of the last find_pairs.
+		std::vector<size_t> m_ID_to_index;                // Index of each ProxyID in m_proxies or Invalid_Index.
+		std::vector<std::pair<ProxyID, ProxyID>> m_pairs; // The output of the last find_pairs.
+		size_t m_inserted_since_sort = 0;                 // Proxies appended to m_proxies out of order since the last find_pairs.
+		int m_sweep_axis             = 0;                 // The axis proxies are sorted and swept along, chosen as the axis of greatest spread.
+		bool m_sweep_axis_changed    = false;
+	};
+} // namespace Geometry
@@ -0,0 +1,84 @@
+#include "TransformBatch.hpp"
+
+#include "SIMD.hpp"
+
+#include "Utility/Logger.hpp"
+
+#include <array>
+
+namespace Geometry
+{
+	namespace
+	{
+		using SIMD::FloatScalar;
+#if defined(Z_SIMD_SSE2)
+		using SIMD::FloatSSE2;
+#endif
+#if defined(Z_SIMD_AVX2)
+		using SIMD::FloatAVX2;
+#endif
+
+		std::vector<float>& get_axis(TransformBatch::Vec3Array& p_array, const size_t& p_axis)
+		{
+			return p_axis == 0 ? p_array.x : p_axis == 1 ? p_array.y : p_array.z;
+		}
+
+#define Z_SIMD_TARGET
+		namespace Kernel
+		{
+			#include "TransformBatchKernel.inl"
+		}
+#undef Z_SIMD_TARGET
+#if defined(Z_SIMD_AVX2)
+	#define Z_SIMD_TARGET Z_TARGET_AVX2
+		namespace KernelAVX2
+		{
+			#include "TransformBatchKernel.inl"
+		}
+	#undef Z_SIMD_TARGET
+#endif
+
+		// Build as much of [p_begin, p_end) as fits the widest SIMD kernel the CPU supports.
+		//@return The end of the entities built, the entities after it are left for the scalar path.
+		size_t build_SIMD(TransformBatch& p_batch, const size_t& p_begin, const size_t& p_end)
+		{
+#if defined(Z_SIMD_AVX2)
+			if (SIMD::use_AVX2())
+			{
+				const size_t simd_end = p_begin + ((p_end - p_begin) / FloatAVX2::Width) * FloatAVX2::Width;
+				KernelAVX2::build_range<FloatAVX2>(p_batch, p_begin, simd_end);
+				return simd_end;
+			}
+#endif
+#if defined(Z_SIMD_SSE2)
+			const size_t simd_end = p_begin + ((p_end - p_begin) / FloatSSE2::Width) * FloatSSE2::Width;
+			Kernel::build_range<FloatSSE2>(p_batch, p_begin, simd_end);
+			return simd_end;
+#else
+			(void)p_batch; (void)p_end;
+			return p_begin;
+#endif
+		}
+	} // namespace
+
+	void TransformBatch::resize(const size_t& p_size)
+	{
+		m_position.resize(p_size);
+		m_orientation.resize(p_size);
+		m_scale.resize(p_size);
+		m_local_AABB_min.resize(p_size);
+		m_local_AABB_max.resize(p_size);
+
+		m_model.resize(p_size);
+		m_world_AABB_min.resize(p_size);
+		m_world_AABB_max.resize(p_size);
+	}
+
+	void build_transforms(TransformBatch& p_batch, const TransformMode& p_mode, const size_t& p_begin, const size_t& p_end)
+	{
+		ASSERT(p_begin <= p_end && p_end <= p_batch.size(), "Transform range out of bounds of the TransformBatch");
+
+		const size_t scalar_begin = p_mode == TransformMode::SIMD ? build_SIMD(p_batch, p_begin, p_end) : p_begin;
+		Kernel::build_range<FloatScalar>(p_batch, scalar_begin, p_end);
+	}
+}
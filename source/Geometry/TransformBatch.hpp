@@ -0,0 +1,47 @@
+#pragma once
+
+#include "RigidBodyIntegrator.hpp"
+
+#include "glm/mat4x4.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+	// Structure of arrays transforms of a batch of entities and their object space AABBs, each array holds one element per entity.
+	// build_transforms loads the same component of several entities into one SIMD register to build their model matrices and world AABBs together.
+	struct TransformBatch
+	{
+		using Vec3Array = RigidBodyBatch::Vec3Array;
+		using QuatArray = RigidBodyBatch::QuatArray;
+
+		// Inputs
+		Vec3Array m_position;
+		QuatArray m_orientation; // Unit quaternions.
+		Vec3Array m_scale;
+		Vec3Array m_local_AABB_min; // Object space AABB.
+		Vec3Array m_local_AABB_max;
+
+		// Outputs
+		std::vector<glm::mat4> m_model; // Translate * Rotate * Scale, as Component::Transform::update_model.
+		Vec3Array m_world_AABB_min;     // The object space AABB transformed by m_model, as AABB::transform.
+		Vec3Array m_world_AABB_max;
+
+		void resize(const size_t& p_size);
+		[[nodiscard]] size_t size() const { return m_model.size(); }
+	};
+
+	enum class TransformMode : uint8_t
+	{
+		Scalar, // One entity at a time. The reference for testing TransformMode::SIMD against.
+		SIMD    // 8 entities at a time with AVX2 if the CPU supports it or 4 with SSE2, entities left over at the end of the range use the scalar path.
+	};
+
+	// Build the model matrices and world AABBs of the entities [p_begin, p_end) of p_batch.
+	// World AABBs use Arvo's method, each world axis extent is the translation plus the sum of the min and max of the model's row applied to the
+	// object space min and max. Scalar and SIMD modes perform the same sequence of IEEE operations per entity so produce bit-for-bit identical results.
+	// Ranges that don't overlap can be built concurrently.
+	// Reference: Transforming Axis-Aligned Bounding Boxes (James Arvo) - Graphics Gems pg 548
+	void build_transforms(TransformBatch& p_batch, const TransformMode& p_mode, const size_t& p_begin, const size_t& p_end);
+}
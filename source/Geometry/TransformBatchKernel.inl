@@ -0,0 +1,63 @@
+// The build_range kernel, included by TransformBatch.cpp once per instruction set with Z_SIMD_TARGET set to the target to compile it for.
+// See SIMD.hpp.
+
+// Build entities [p_begin, p_end) Float::Width at a time, p_end - p_begin must be a multiple of Float::Width.
+template <typename Float>
+Z_SIMD_TARGET void build_range(TransformBatch& p_batch, const size_t& p_begin, const size_t& p_end)
+{
+	const Float one(1.f);
+	const Float two(2.f);
+	auto& b = p_batch;
+
+	for (size_t i = p_begin; i < p_end; i += Float::Width)
+	{
+		const Float qw = Float::load(&b.m_orientation.w[i]);
+		const Float qx = Float::load(&b.m_orientation.x[i]);
+		const Float qy = Float::load(&b.m_orientation.y[i]);
+		const Float qz = Float::load(&b.m_orientation.z[i]);
+		const Float sx = Float::load(&b.m_scale.x[i]);
+		const Float sy = Float::load(&b.m_scale.y[i]);
+		const Float sz = Float::load(&b.m_scale.z[i]);
+
+		// Rotate * Scale, the rotation matrix of the orientation (as glm::mat4_cast) with its columns scaled. model[column * 3 + row].
+		const Float xx = qx * qx, yy = qy * qy, zz = qz * qz;
+		const Float xy = qx * qy, xz = qx * qz, yz = qy * qz;
+		const Float wx = qw * qx, wy = qw * qy, wz = qw * qz;
+		const std::array<Float, 9> model =
+		{
+			(one - two * (yy + zz)) * sx, (two * (xy + wz)) * sx,       (two * (xz - wy)) * sx,
+			(two * (xy - wz)) * sy,       (one - two * (xx + zz)) * sy, (two * (yz + wx)) * sy,
+			(two * (xz + wy)) * sz,       (two * (yz - wx)) * sz,       (one - two * (xx + yy)) * sz
+		};
+
+		// Arvo's method. Each product of a model element with the object space min and max is a candidate for the world extent of the row,
+		// the smaller is added to the world min and the larger to the world max. Adds in the same order as AABB::transform.
+		for (size_t row = 0; row < 3; row++)
+		{
+			Float world_min = Float::load(&get_axis(b.m_position, row)[i]);
+			Float world_max = world_min;
+			for (size_t column = 0; column < 3; column++)
+			{
+				const Float e = model[column * 3 + row] * Float::load(&get_axis(b.m_local_AABB_min, column)[i]);
+				const Float f = model[column * 3 + row] * Float::load(&get_axis(b.m_local_AABB_max, column)[i]);
+				world_min = world_min + min(e, f);
+				world_max = world_max + max(f, e);
+			}
+			world_min.store(&get_axis(b.m_world_AABB_min, row)[i]);
+			world_max.store(&get_axis(b.m_world_AABB_max, row)[i]);
+		}
+
+		// Columns are written in bulk from the lanes, the matrices are per entity.
+		std::array<std::array<float, Float::Width>, 9> model_lanes;
+		for (size_t element = 0; element < 9; element++)
+			model[element].store(model_lanes[element].data());
+
+		for (size_t lane = 0; lane < Float::Width; lane++)
+		{
+			auto& entity_model = b.m_model[i + lane];
+			for (int column = 0; column < 3; column++)
+				entity_model[column] = glm::vec4(model_lanes[column * 3][lane], model_lanes[column * 3 + 1][lane], model_lanes[column * 3 + 2][lane], 0.f);
+			entity_model[3] = glm::vec4(b.m_position.x[i + lane], b.m_position.y[i + lane], b.m_position.z[i + lane], 1.f);
+		}
+	}
+}
@@ -0,0 +1,170 @@
+#include "TriangleBVH.hpp"
+
+#include "glm/glm.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace Geometry
+{
+	namespace
+	{
+		constexpr float Miss = std::numeric_limits<float>::infinity();
+
+		// Distance along a ray to where it enters the box [p_min, p_max] or Miss if it misses or enters past p_max_distance.
+		// Starting inside the box enters at 0. Slab test as in intersecting(AABB, Ray) using the precomputed 1 / direction.
+		float entry_distance(const glm::vec3& p_min, const glm::vec3& p_max, const glm::vec3& p_start, const glm::vec3& p_inverse_direction, const float& p_max_distance)
+		{
+			float entry = 0.f;
+			float exit  = p_max_distance;
+			for (int i = 0; i < 3; i++)
+			{
+				float near = (p_min[i] - p_start[i]) * p_inverse_direction[i];
+				float far  = (p_max[i] - p_start[i]) * p_inverse_direction[i];
+				if (near > far)
+					std::swap(near, far);
+
+				entry = std::max(entry, near);
+				exit  = std::min(exit, far);
+			}
+			return entry <= exit ? entry : Miss;
+		}
+	} // namespace
+
+	TriangleBVH::TriangleBVH() noexcept
+		: m_nodes{}
+		, m_triangles{}
+	{}
+
+	TriangleBVH::TriangleBVH(std::vector<Triangle>&& p_triangles)
+		: m_nodes{}
+		, m_triangles{}
+	{
+		if (p_triangles.empty())
+			return;
+
+		ASSERT(p_triangles.size() <= std::numeric_limits<uint32_t>::max(), "TriangleBVH indexes triangles with 32 bits.");
+		const auto triangle_count = static_cast<uint32_t>(p_triangles.size());
+
+		// The triangles are partitioned by the centers of their AABBs.
+		std::vector<AABB> triangle_bounds;
+		triangle_bounds.reserve(triangle_count);
+		for (const auto& triangle : p_triangles)
+		{
+			auto& bound = triangle_bounds.emplace_back(triangle.m_point_1, triangle.m_point_1);
+			bound.unite(triangle.m_point_2);
+			bound.unite(triangle.m_point_3);
+		}
+
+		std::vector<uint32_t> order(triangle_count);
+		std::iota(order.begin(), order.end(), 0);
+
+		m_nodes.reserve(2 * (triangle_count / Max_Leaf_Size + 1));
+		build(0, triangle_count, order, triangle_bounds);
+
+		m_triangles.reserve(triangle_count);
+		for (const auto& index : order)
+			m_triangles.push_back(p_triangles[index]);
+	}
+
+	void TriangleBVH::build(const uint32_t& p_begin, const uint32_t& p_end, std::vector<uint32_t>& p_order, const std::vector<AABB>& p_triangle_bounds)
+	{
+		// Nodes index the triangles by their position in p_order, m_triangles is filled in p_order once the build is complete.
+		const size_t node_index = m_nodes.size();
+		m_nodes.emplace_back();
+
+		AABB bound          = p_triangle_bounds[p_order[p_begin]];
+		const auto center   = bound.get_center();
+		AABB centroid_bound = AABB(center, center);
+		for (uint32_t i = p_begin + 1; i < p_end; i++)
+		{
+			const auto& triangle_bound = p_triangle_bounds[p_order[i]];
+			bound.unite(triangle_bound);
+			centroid_bound.unite(triangle_bound.get_center());
+		}
+
+		const uint32_t count = p_end - p_begin;
+		if (count <= Max_Leaf_Size)
+		{
+			m_nodes[node_index] = {bound.m_min, p_begin, bound.m_max, count};
+			return;
+		}
+
+		// Split at the median centroid along the longest axis of the centroid bound, halving the triangles in each child.
+		const auto extent = centroid_bound.get_size();
+		const int axis    = extent.x > extent.y && extent.x > extent.z ? 0 : extent.y > extent.z ? 1 : 2;
+		const uint32_t middle = p_begin + count / 2;
+		std::nth_element(p_order.begin() + p_begin, p_order.begin() + middle, p_order.begin() + p_end, [&p_triangle_bounds, &axis](const uint32_t& p_a, const uint32_t& p_b)
+		{
+			return p_triangle_bounds[p_a].get_center()[axis] < p_triangle_bounds[p_b].get_center()[axis];
+		});
+
+		build(p_begin, middle, p_order, p_triangle_bounds);
+		m_nodes[node_index] = {bound.m_min, static_cast<uint32_t>(m_nodes.size()), bound.m_max, 0};
+		build(middle, p_end, p_order, p_triangle_bounds);
+	}
+
+	AABB TriangleBVH::get_bound() const
+	{
+		return m_nodes.empty() ? AABB() : AABB(m_nodes.front().m_min, m_nodes.front().m_max);
+	}
+
+	std::optional<TriangleBVH::RayHit> TriangleBVH::raycast(const Ray& p_ray, float p_max_distance) const
+	{
+		if (m_nodes.empty())
+			return std::nullopt;
+
+		// A zero direction component gives an infinite inverse, the slab test then keeps only rays starting inside that slab.
+		const glm::vec3 inverse_direction = glm::vec3(1.f) / p_ray.m_direction;
+
+		// Nodes are pushed with their entry distance so nodes farther than a hit found after pushing them are skipped without a retest.
+		std::array<std::pair<uint32_t, float>, Max_Stack_Size> stack;
+		size_t stack_size = 0;
+
+		const float root_entry = entry_distance(m_nodes.front().m_min, m_nodes.front().m_max, p_ray.m_start, inverse_direction, p_max_distance);
+		if (root_entry != Miss)
+			stack[stack_size++] = {0, root_entry};
+
+		std::optional<RayHit> closest;
+		while (stack_size > 0)
+		{
+			const auto [node_index, entry] = stack[--stack_size];
+			if (entry > p_max_distance)
+				continue;
+
+			const Node& node = m_nodes[node_index];
+			if (node.is_leaf())
+			{
+				for (uint32_t i = node.m_index; i < node.m_index + node.m_count; i++)
+				{
+					float distance = 0.f;
+					const auto contact = get_intersection(p_ray, m_triangles[i], &distance);
+					if (contact && distance <= p_max_distance)
+					{
+						closest        = RayHit{*contact, distance, i};
+						p_max_distance = distance;
+					}
+				}
+			}
+			else
+			{
+				// Push the farther child first so the nearer child is visited first and can shorten the ray for the farther one.
+				const Node& left  = m_nodes[node_index + 1];
+				const Node& right = m_nodes[node.m_index];
+				const float left_entry  = entry_distance(left.m_min, left.m_max, p_ray.m_start, inverse_direction, p_max_distance);
+				const float right_entry = entry_distance(right.m_min, right.m_max, p_ray.m_start, inverse_direction, p_max_distance);
+
+				ASSERT(stack_size + 2 <= Max_Stack_Size, "TriangleBVH raycast stack overflow.");
+				const bool left_first = left_entry <= right_entry;
+				const std::pair<uint32_t, float> near_child = left_first ? std::pair{node_index + 1, left_entry} : std::pair{node.m_index, right_entry};
+				const std::pair<uint32_t, float> far_child  = left_first ? std::pair{node.m_index, right_entry} : std::pair{node_index + 1, left_entry};
+				if (far_child.second != Miss)
+					stack[stack_size++] = far_child;
+				if (near_child.second != Miss)
+					stack[stack_size++] = near_child;
+			}
+		}
+		return closest;
+	}
+} // namespace Geometry
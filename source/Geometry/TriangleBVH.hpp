@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Geometry/AABB.hpp"
+#include "Geometry/Intersect.hpp"
+#include "Geometry/Ray.hpp"
+#include "Geometry/Triangle.hpp"
+
+#include "Utility/Logger.hpp"
+
+#include "glm/vec3.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace Geometry
+{
+	// A static bounding volume hierarchy over the triangles of a mesh supporting ray, sphere and AABB queries in O(log n).
+	// Built once from a triangle list and never modified. The nodes are stored depth first in a flat array, the left child of a branch
+	// is the next node so only the right child index is stored, keeping a node to 32 bytes (two per cache line).
+	// The triangles are reordered so the triangles of each leaf are contiguous.
+	// Reference: Real-Time Collision Detection (Christer Ericson) - 6.2 Building Strategies for Hierarchy Construction pg 239
+	// Reference: Physically Based Rendering (Pharr, Jakob, Humphreys) - 4.3.4 Compact BVH for Traversal
+	class TriangleBVH
+	{
+	public:
+		// The closest triangle hit by a Ray.
+		struct RayHit
+		{
+			ContactPoint m_contact; // Position on the triangle and the triangle normal facing the ray.
+			float m_distance;       // Distance along the ray in multiples of the ray direction.
+			size_t m_triangle;      // Index into get_triangles().
+		};
+
+		TriangleBVH() noexcept;
+		// Build the hierarchy over p_triangles. Leaves hold at most Max_Leaf_Size triangles.
+		explicit TriangleBVH(std::vector<Triangle>&& p_triangles);
+
+		[[nodiscard]] bool empty() const { return m_triangles.empty(); }
+		[[nodiscard]] size_t size() const { return m_triangles.size(); }
+		[[nodiscard]] size_t node_count() const { return m_nodes.size(); }
+		// The triangles in leaf order, not the order they were built from.
+		[[nodiscard]] const std::vector<Triangle>& get_triangles() const { return m_triangles; }
+		// The AABB enclosing every triangle (the root node). Zero size AABB if empty.
+		[[nodiscard]] AABB get_bound() const;
+
+		// The closest triangle hit by p_ray no farther than p_max_distance along it or nullopt if p_ray misses every triangle.
+		// Children are visited nearest first and skipped once they are farther than the closest hit so far.
+		[[nodiscard]] std::optional<RayHit> raycast(const Ray& p_ray, float p_max_distance = std::numeric_limits<float>::max()) const;
+
+		// Call p_func(const Triangle&) for every triangle intersecting p_shape. p_shape can be any type with intersecting(AABB, Shape) and
+		// intersecting(Shape, Triangle) overloads e.g. AABB, Sphere or Ray.
+		template <typename Shape, typename Func>
+		void query(const Shape& p_shape, Func&& p_func) const
+		{
+			if (m_nodes.empty())
+				return;
+
+			std::array<uint32_t, Max_Stack_Size> stack;
+			size_t stack_size = 0;
+			stack[stack_size++] = 0;
+
+			while (stack_size > 0)
+			{
+				const Node& node = m_nodes[stack[--stack_size]];
+				if (!intersecting(AABB(node.m_min, node.m_max), p_shape))
+					continue;
+
+				if (node.is_leaf())
+				{
+					for (uint32_t i = node.m_index; i < node.m_index + node.m_count; i++)
+						if (intersecting(p_shape, m_triangles[i]))
+							p_func(m_triangles[i]);
+				}
+				else
+				{
+					ASSERT(stack_size + 2 <= Max_Stack_Size, "TriangleBVH query stack overflow.");
+					stack[stack_size++] = node.m_index;
+					stack[stack_size++] = index_of(node) + 1;
+				}
+			}
+		}
+
+		static constexpr uint32_t Max_Leaf_Size = 4;
+
+	private:
+		static constexpr size_t Max_Stack_Size = 64; // Median splits halve the triangles per level, the height is at most log2(n) + 1.
+
+		struct Node
+		{
+			glm::vec3 m_min;
+			uint32_t m_index; // Leaves: first triangle. Branches: right child, the left child is the next node.
+			glm::vec3 m_max;
+			uint32_t m_count; // Number of triangles in a leaf, 0 for branches.
+
+			bool is_leaf() const { return m_count > 0; }
+		};
+		static_assert(sizeof(Node) == 32, "TriangleBVH::Node should be 32 bytes to fit two per cache line.");
+
+		uint32_t index_of(const Node& p_node) const { return static_cast<uint32_t>(&p_node - m_nodes.data()); }
+		// Append the subtree over the triangles p_order[p_begin, p_end) to m_nodes, partitioning p_order by the centers of p_triangle_bounds.
+		void build(const uint32_t& p_begin, const uint32_t& p_end, std::vector<uint32_t>& p_order, const std::vector<AABB>& p_triangle_bounds);
+
+		std::vector<Node> m_nodes;
+		std::vector<Triangle> m_triangles;
+	};
+} // namespace Geometry
@@ -50,6 +50,7 @@ namespace OpenGL
 		, m_screen_quad{make_screen_quad_mesh()}
 		, m_view_information{}
 		, m_post_processing_options{}
+		, m_interpolation_alpha{1.f}
 	{
 		const auto windowSize = m_window.size();
 		m_screen_framebuffer.attachColourBuffer(windowSize.x, windowSize.y);
@@ -77,7 +78,7 @@ namespace OpenGL
 
 		FBO::unbind();
 
-		m_shadow_mapper.shadow_pass(m_scene_system.m_scene);
+		m_shadow_mapper.shadow_pass(m_scene_system.m_scene, m_interpolation_alpha);
 
 		{ // Prepare m_screen_framebuffer for rendering
 			const auto window_size = m_window.size();
@@ -102,7 +103,7 @@ namespace OpenGL
 
 				DrawCall dc;
 				dc.set_uniform("view_position", m_view_information.m_view_position);
-				dc.set_uniform("model", p_transform.m_model);
+				dc.set_uniform("model", p_transform.get_interpolated_model(m_interpolation_alpha));
 				dc.set_uniform("shininess", texComponent.m_shininess);
 				dc.set_texture("diffuse",  texComponent.m_diffuse.has_value()  ? texComponent.m_diffuse  : m_missing_texture);
 				dc.set_texture("specular", texComponent.m_specular.has_value() ? texComponent.m_specular : m_blank_texture);
@@ -111,7 +112,7 @@ namespace OpenGL
 			else
 			{
 				DrawCall dc;
-				dc.set_uniform("model", p_transform.m_model);
+				dc.set_uniform("model", p_transform.get_interpolated_model(m_interpolation_alpha));
 				dc.set_uniform("colour", glm::vec4(0.06f, 0.44f, 0.81f, 1.f));
 				dc.submit(m_uniform_colour_shader, mesh_comp.m_mesh);
 			}
@@ -65,6 +65,7 @@ namespace OpenGL
 	public:
 		ViewInformation m_view_information;
 		PostProcessingOptions m_post_processing_options;
+		float m_interpolation_alpha; // Fraction [0-1) of the physics tick elapsed since the last tick. Meshes are drawn between the previous and current tick state.
 
 		// OpenGLRenderer reads and renders the current state of pStorage when draw() is called.
 		OpenGLRenderer(Platform::Window& p_window, System::SceneSystem& p_scene_system, System::MeshSystem& p_mesh_system, System::TextureSystem& p_texture_system) noexcept;
@@ -23,7 +23,7 @@ namespace OpenGL
 		m_depth_map_FBO.attach_depth_buffer(m_resolution);
 	}
 
-	void ShadowMapper::shadow_pass(System::Scene& p_scene)
+	void ShadowMapper::shadow_pass(System::Scene& p_scene, const float& p_interpolation_alpha)
 	{
 		ASSERT(m_depth_map_FBO.isComplete(), "[OPENGL][SHADOW MAPPER] framebuffer not complete, have you attached a depth buffer + empty draw and read buffers.");
 
@@ -44,7 +44,7 @@ namespace OpenGL
 					DrawCall dc;
 					dc.m_cull_face_enabled = false;
 					dc.set_uniform("light_space_mat", p_light.get_view_proj(p_scene.m_bound));
-					dc.set_uniform("model", p_transform.m_model);
+					dc.set_uniform("model", p_transform.get_interpolated_model(p_interpolation_alpha));
 					dc.submit(m_shadow_depth_shader, p_mesh.m_mesh);
 				});
 			});
@@ -26,7 +26,8 @@ namespace OpenGL
 	public:
 		ShadowMapper(Platform::Window& p_window) noexcept;
 
-		void shadow_pass(System::Scene& p_scene);
+		// p_interpolation_alpha: Fraction of the physics tick to interpolate the Transforms by, see Transform::get_interpolated_model.
+		void shadow_pass(System::Scene& p_scene, const float& p_interpolation_alpha);
 		const Texture& get_depth_map() const { return m_depth_map_FBO.m_depth_map.value(); };
 
 		void draw_UI();
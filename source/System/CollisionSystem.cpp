@@ -1,64 +1,219 @@
 #include "CollisionSystem.hpp"
-#include "MeshSystem.hpp"
 #include "SceneSystem.hpp"
 
 #include "Component/Collider.hpp"
 #include "Component/Mesh.hpp"
+#include "Component/RigidBody.hpp"
 #include "Component/Transform.hpp"
 
+#include "Geometry/Frustrum.hpp"
 #include "Geometry/Point.hpp"
 #include "Geometry/Ray.hpp"
+#include "Geometry/RayPacket.hpp"
+#include "Geometry/Sphere.hpp"
 #include "Geometry/Triangle.hpp"
 
+#include "Utility/ThreadPool.hpp"
+
+#include <cmath>
+
 namespace System
 {
-	CollisionSystem::CollisionSystem(SceneSystem& p_scene_system) noexcept
-		: m_scene_system{p_scene_system}
+	CollisionSystem::CollisionSystem(Scene& p_scene) noexcept
+		: m_scene{p_scene}
+		, m_sweep_and_prune{}
+		, m_spatial_hash_grid{}
+		, m_AABB_tree{}
 	{}
 
-	std::optional<Geometry::ContactPoint> CollisionSystem::get_collision(const ECS::Entity& p_entity, const ECS::Entity* p_collided_entity) const
+	void CollisionSystem::update(Utility::ThreadPool& p_thread_pool)
 	{
-		auto& scene = m_scene_system.get_current_scene();
-		if (scene.has_components<Component::Collider, Component::Mesh, Component::Transform>(p_entity))
+		auto& scene = m_scene.m_entities;
+
+		// The Data::Mesh of an Entity can be swapped between ticks so Colliders are pointed at it first, a new mesh dirties the Transform.
+		scene.foreach_parallel([](Component::Transform& p_transform, Component::Mesh& p_mesh, Component::Collider& p_collider)
 		{
-			auto& collider  = scene.get_component<Component::Collider>(p_entity);
-			auto& mesh      = scene.get_component<Component::Mesh>(p_entity);
-			auto& transform = scene.get_component<Component::Transform>(p_entity);
+			if (p_collider.m_collision_mesh != &*p_mesh.m_mesh)
+			{
+				p_collider.m_collision_mesh = &*p_mesh.m_mesh;
+				p_transform.mark_dirty();
+			}
+		}, p_thread_pool);
 
-			const auto rotation_matrix = glm::mat4_cast(transform.m_orientation);
-			collider.m_world_AABB      = Geometry::AABB::transform(mesh.m_mesh->AABB, transform.m_position, rotation_matrix, transform.m_scale);
-			collider.m_collided        = false;
+		// The batched Transform pass. Only Transforms marked dirty since the last update are gathered to rebuild their model matrix, and the
+		// world AABB of their Collider or their Mesh without a Collider. The rest keep theirs from previous ticks.
+		// Every gathered Transform has its dirty flag cleared at the end of update, after the structure updates below have read it.
+		// The archetypes are walked directly so which components an Entity owns is resolved once per archetype instead of once per Entity.
+		m_transform_targets.clear();
+		m_transforms.resize(scene.count_components<Component::Transform>());
+		scene.foreach_archetype<Component::Transform>([this](const ECS::Storage::ArchetypeView& p_archetype)
+		{
+			const bool has_collider = p_archetype.has_components<Component::Collider>();
+			const bool has_mesh     = p_archetype.has_components<Component::Mesh>();
+			const auto transforms   = p_archetype.get_components<Component::Transform>();
+			const auto colliders    = has_collider ? std::make_optional(p_archetype.get_components<Component::Collider>()) : std::nullopt;
+			const auto meshes       = has_mesh     ? std::make_optional(p_archetype.get_components<Component::Mesh>())     : std::nullopt;
 
-			scene.foreach([&](const ECS::Entity& p_entity_other, Component::Transform& p_transform_other, Component::Mesh& p_mesh_other, Component::Collider& p_collider_other)
-			{(void)p_mesh_other;
-				if (&collider != &p_collider_other)
-				{
-					const auto rotation_matrix_other = glm::mat4_cast(p_transform_other.m_orientation);
-					p_collider_other.m_world_AABB    = Geometry::AABB::transform(mesh.m_mesh->AABB, p_transform_other.m_position, rotation_matrix_other, p_transform_other.m_scale);
+			for (size_t i = 0; i < p_archetype.size(); i++)
+			{
+				auto& transform = transforms[i];
+				if (!transform.m_dirty)
+					continue;
 
-					if (Geometry::intersecting(collider.m_world_AABB, p_collider_other.m_world_AABB)) // Broad phase AABB check
-					{
-						p_collided_entity = &p_entity_other;
-						collider.m_collided = true;
-						return;
-					}
+				Component::Collider* collider = colliders ? &(*colliders)[i] : nullptr;
+				const Data::CollisionMesh* collision_mesh = collider ? collider->m_collision_mesh
+				                                          : meshes   ? &*(*meshes)[i].m_mesh
+				                                                     : nullptr;
+
+				// Transforms without a collision mesh only need their model, the world AABB built from the empty local AABB is discarded.
+				const size_t index = m_transform_targets.size();
+				m_transform_targets.push_back({&transform, collider, p_archetype.get_entity(i).ID, collision_mesh != nullptr});
+				m_transforms.m_position.set(index, transform.m_position);
+				m_transforms.m_orientation.set(index, transform.m_orientation);
+				m_transforms.m_scale.set(index, transform.m_scale);
+				m_transforms.m_local_AABB_min.set(index, collision_mesh ? collision_mesh->AABB.m_min : glm::vec3(0.f));
+				m_transforms.m_local_AABB_max.set(index, collision_mesh ? collision_mesh->AABB.m_max : glm::vec3(0.f));
+			}
+		});
+		m_transforms.resize(m_transform_targets.size());
+
+		// Every element is built independently, each range writes only to its own elements.
+		p_thread_pool.parallel_for(m_transforms.size(), [this](const size_t& p_begin, const size_t& p_end)
+		{
+			Geometry::build_transforms(m_transforms, Geometry::TransformMode::SIMD, p_begin, p_end);
+		}, 256);
+
+		for (size_t index = 0; index < m_transform_targets.size(); index++)
+		{
+			const auto& target = m_transform_targets[index];
+			target.m_transform->m_model = m_transforms.m_model[index];
+			if (!target.m_has_collision_mesh)
+				continue;
+
+			const auto world_AABB = Geometry::AABB(m_transforms.m_world_AABB_min.get(index), m_transforms.m_world_AABB_max.get(index));
+			if (target.m_collider)
+				target.m_collider->m_world_AABB = world_AABB;
+			else
+				m_AABB_tree.set(target.m_entity, world_AABB); // Meshes without a Collider are only in the tree for culling.
+		}
+
+		const bool use_grid = m_scene.m_broadphase == Scene::Broadphase::SpatialHashGrid;
+		if (use_grid && m_spatial_hash_grid.get_cell_size() != m_scene.m_grid_cell_size)
+			m_spatial_hash_grid.set_cell_size(m_scene.m_grid_cell_size);
+
+		scene.foreach_archetype<Component::Transform, Component::Collider>([this, use_grid](const ECS::Storage::ArchetypeView& p_archetype)
+		{
+			const auto transforms   = p_archetype.get_components<Component::Transform>();
+			const auto colliders    = p_archetype.get_components<Component::Collider>();
+			const bool has_body     = p_archetype.has_components<Component::RigidBody>();
+			const auto rigid_bodies = has_body ? std::make_optional(p_archetype.get_components<Component::RigidBody>()) : std::nullopt;
+			// Sleeping bodies haven't moved since their proxy was last set, it's kept as it is until they wake.
+			const bool sleeping     = p_archetype.has_components<Component::Sleeping>();
+
+			for (size_t i = 0; i < p_archetype.size(); i++)
+			{
+				auto& collider = colliders[i];
+				collider.m_collided = false;
+				if (!collider.m_collision_mesh)
+					continue;
+
+				// Only dynamic bodies respond to contacts, Colliders without a RigidBody are static.
+				const auto& entity   = p_archetype.get_entity(i);
+				const bool is_static = !rigid_bodies || (*rigid_bodies)[i].m_type != Component::RigidBody::Type::Dynamic;
+				const auto filter    = Geometry::CollisionFilter{collider.m_layer, collider.m_mask, is_static};
+
+				if (transforms[i].m_dirty || !m_AABB_tree.contains(entity.ID))
+					m_AABB_tree.set(entity.ID, collider.m_world_AABB); // Only reinserts if the Entity moved out of its fat AABB.
+				else
+					m_AABB_tree.keep(entity.ID);
+
+				if (use_grid)
+				{
+					if (sleeping && !transforms[i].m_dirty && m_spatial_hash_grid.contains(entity.ID))
+						m_spatial_hash_grid.keep(entity.ID);
+					else
+						m_spatial_hash_grid.set(entity.ID, collider.m_world_AABB, filter);
+				}
+				else
+				{
+					if (sleeping && !transforms[i].m_dirty && m_sweep_and_prune.contains(entity.ID))
+						m_sweep_and_prune.keep(entity.ID);
+					else
+						m_sweep_and_prune.set(entity.ID, collider.m_world_AABB, filter);
 				}
-			});
+			}
+		});
+		// Meshes without a Collider built above are already set. Their world AABB is only kept in the tree so is rebuilt if it was removed.
+		scene.foreach_archetype<Component::Transform, Component::Mesh>([this](const ECS::Storage::ArchetypeView& p_archetype)
+		{
+			if (p_archetype.has_components<Component::Collider>())
+				return;
+
+			const auto transforms = p_archetype.get_components<Component::Transform>();
+			const auto meshes     = p_archetype.get_components<Component::Mesh>();
+			for (size_t i = 0; i < p_archetype.size(); i++)
+			{
+				const auto& transform = transforms[i];
+				if (transform.m_dirty)
+					continue;
+
+				const auto& entity = p_archetype.get_entity(i);
+				if (m_AABB_tree.contains(entity.ID))
+					m_AABB_tree.keep(entity.ID);
+				else
+					m_AABB_tree.set(entity.ID, Geometry::AABB::transform(meshes[i].m_mesh->AABB, transform.m_model));
+			}
+		});
+		for (const auto& target : m_transform_targets)
+			target.m_transform->m_dirty = false;
+
+		// Entities removed from the scene were not set above and are dropped from the tree and broadphase here.
+		m_AABB_tree.remove_unset();
+		m_scene.m_bound = m_AABB_tree.get_bound();
+
+		// The broadphase not in use is cleared so switching back starts from a fresh set of proxies.
+		if (use_grid)
+			m_sweep_and_prune.clear();
+		else
+			m_spatial_hash_grid.clear();
+
+		for (const auto& [entity_1, entity_2] : use_grid ? m_spatial_hash_grid.find_pairs(&p_thread_pool) : m_sweep_and_prune.find_pairs())
+		{
+			scene.get_component<Component::Collider>(entity_1).m_collided = true;
+			scene.get_component<Component::Collider>(entity_2).m_collided = true;
 		}
+	}
 
-		return std::nullopt;
+	void CollisionSystem::reset()
+	{
+		m_sweep_and_prune.clear();
+		m_spatial_hash_grid.clear();
+		m_AABB_tree.clear();
+	}
+
+	const std::vector<std::pair<ECS::EntityID, ECS::EntityID>>& CollisionSystem::get_candidate_pairs() const
+	{
+		if (m_scene.m_broadphase == Scene::Broadphase::SpatialHashGrid)
+			return m_spatial_hash_grid.get_pairs();
+		else
+			return m_sweep_and_prune.get_pairs();
 	}
 
 	bool CollisionSystem::castRay(const Geometry::Ray& p_ray, glm::vec3& out_first_intersection) const
 	{
 		std::optional<float> min_intersection_along_ray;
+		auto& scene = m_scene.m_entities;
 
-		m_scene_system.get_current_scene().foreach([&](Component::Collider& p_collider)
+		m_AABB_tree.query(p_ray, [&](const ECS::EntityID& p_entity)
 		{
+			if (!scene.has_components<Component::Collider>(p_entity))
+				return;
+
+			auto& collider         = scene.get_component<Component::Collider>(p_entity);
 			float length_along_ray = 0.f;
-			if (auto intersection = Geometry::get_intersection(p_collider.m_world_AABB, p_ray, &length_along_ray))
+			if (auto intersection = Geometry::get_intersection(collider.m_world_AABB, p_ray, &length_along_ray))
 			{
-				p_collider.m_collided = true;
+				collider.m_collided = true;
 
 				if (!min_intersection_along_ray.has_value() || length_along_ray < min_intersection_along_ray)
 				{
@@ -74,14 +229,160 @@ namespace System
 	std::vector<std::pair<ECS::Entity, float>> CollisionSystem::get_entities_along_ray(const Geometry::Ray& p_ray) const
 	{
 		std::vector<std::pair<ECS::Entity, float>> entities_and_distance;
+		auto& scene = m_scene.m_entities;
 
-		m_scene_system.get_current_scene().foreach([&](ECS::Entity& p_entity, Component::Collider& p_collider)
+		m_AABB_tree.query(p_ray, [&](const ECS::EntityID& p_entity)
 		{
+			if (!scene.has_components<Component::Collider>(p_entity))
+				return;
+
 			float length_along_ray = 0.f;
-			if (auto intersection = Geometry::get_intersection(p_collider.m_world_AABB, p_ray, &length_along_ray))
+			if (auto intersection = Geometry::get_intersection(scene.get_component<Component::Collider>(p_entity).m_world_AABB, p_ray, &length_along_ray))
 				entities_and_distance.push_back({p_entity, length_along_ray});
 		});
 
 		return entities_and_distance;
 	}
-} // namespace System
\ No newline at end of file
+
+	std::vector<std::optional<CollisionSystem::RayHit>> CollisionSystem::cast_rays(const std::vector<Geometry::Ray>& p_rays, const RayQuery& p_query, const float& p_max_distance, Utility::ThreadPool* p_thread_pool) const
+	{
+		std::vector<std::optional<RayHit>> hits(p_rays.size());
+		auto& scene = m_scene.m_entities;
+
+		// Each packet writes only the hits of its own rays.
+		auto cast_packets = [&](const size_t& p_begin, const size_t& p_end)
+		{
+			for (size_t packet_index = p_begin; packet_index < p_end; packet_index++)
+			{
+				const size_t first = packet_index * Geometry::RayPacket::Size;
+				auto packet        = Geometry::RayPacket(&p_rays[first], std::min(Geometry::RayPacket::Size, p_rays.size() - first), p_max_distance);
+				std::array<float, Geometry::RayPacket::Size> distances;
+
+				// Every hit shortens its lane so the rest of the traversal skips nodes farther than it, Any retires the lane instead.
+				m_AABB_tree.query(packet, [&](const ECS::EntityID& p_entity)
+				{
+					if (!scene.has_components<Component::Collider>(p_entity))
+						return;
+
+					const uint32_t lanes_hit = Geometry::get_intersection(scene.get_component<Component::Collider>(p_entity).m_world_AABB, packet, distances);
+					for (size_t lane = 0; lane < packet.m_count; lane++)
+					{
+						if (!(lanes_hit & (1u << lane)))
+							continue;
+
+						const auto& ray = p_rays[first + lane];
+						hits[first + lane] = RayHit{p_entity, distances[lane], ray.m_start + ray.m_direction * distances[lane]};
+						packet.set_max_distance(lane, p_query == RayQuery::Any ? -1.f : distances[lane]);
+					}
+				});
+			}
+		};
+
+		const size_t packet_count = (p_rays.size() + Geometry::RayPacket::Size - 1) / Geometry::RayPacket::Size;
+		if (p_thread_pool)
+			p_thread_pool->parallel_for(packet_count, cast_packets, 8);
+		else
+			cast_packets(0, packet_count);
+
+		return hits;
+	}
+
+	// Query p_tree for the Entities with a Collider intersecting p_shape. The tree stores fat AABBs so the Collider world AABB is tested exactly.
+	template <typename Shape>
+	static std::vector<ECS::Entity> get_colliders_in(const Geometry::AABBTree& p_tree, ECS::Storage& p_scene, const Shape& p_shape)
+	{
+		std::vector<ECS::Entity> entities;
+
+		p_tree.query(p_shape, [&](const ECS::EntityID& p_entity)
+		{
+			if (p_scene.has_components<Component::Collider>(p_entity) && Geometry::intersecting(p_scene.get_component<Component::Collider>(p_entity).m_world_AABB, p_shape))
+				entities.push_back(p_entity);
+		});
+
+		return entities;
+	}
+	std::vector<ECS::Entity> CollisionSystem::get_entities_in(const Geometry::AABB& p_AABB) const
+	{
+		return get_colliders_in(m_AABB_tree, m_scene.m_entities, p_AABB);
+	}
+	std::vector<ECS::Entity> CollisionSystem::get_entities_in(const Geometry::Frustrum& p_frustrum) const
+	{
+		return get_colliders_in(m_AABB_tree, m_scene.m_entities, p_frustrum);
+	}
+
+	// Query p_tree for the Entities with a Collider in p_mask intersecting p_shape, writing as many as fit into p_entities.
+	template <typename Shape>
+	static size_t overlap_colliders(const Geometry::AABBTree& p_tree, ECS::Storage& p_scene, const Shape& p_shape, std::span<ECS::EntityID> p_entities, const uint32_t& p_mask)
+	{
+		size_t count = 0;
+
+		p_tree.query(p_shape, [&](const ECS::EntityID& p_entity)
+		{
+			if (!p_scene.has_components<Component::Collider>(p_entity))
+				return;
+
+			const auto& collider = p_scene.get_component<Component::Collider>(p_entity);
+			if ((collider.m_layer & p_mask) != 0 && Geometry::intersecting(collider.m_world_AABB, p_shape))
+			{
+				if (count < p_entities.size())
+					p_entities[count] = p_entity;
+				count++;
+			}
+		});
+
+		return count;
+	}
+
+	size_t CollisionSystem::overlap(const Geometry::Sphere& p_sphere, std::span<ECS::EntityID> p_entities, const uint32_t& p_mask) const
+	{
+		return overlap_colliders(m_AABB_tree, m_scene.m_entities, p_sphere, p_entities, p_mask);
+	}
+	size_t CollisionSystem::overlap(const Geometry::AABB& p_AABB, std::span<ECS::EntityID> p_entities, const uint32_t& p_mask) const
+	{
+		return overlap_colliders(m_AABB_tree, m_scene.m_entities, p_AABB, p_entities, p_mask);
+	}
+	size_t CollisionSystem::overlap(const Geometry::Frustrum& p_frustrum, std::span<ECS::EntityID> p_entities, const uint32_t& p_mask) const
+	{
+		return overlap_colliders(m_AABB_tree, m_scene.m_entities, p_frustrum, p_entities, p_mask);
+	}
+
+	size_t CollisionSystem::find_nearest(const glm::vec3& p_point, std::span<Neighbour> p_neighbours, const float& p_max_distance, const uint32_t& p_mask) const
+	{
+		if (p_neighbours.empty())
+			return 0;
+
+		auto& scene = m_scene.m_entities;
+		size_t count               = 0;
+		float max_distance_squared = p_max_distance * p_max_distance; // Overflows to infinity for the default, keeping every Collider in range.
+
+		// p_neighbours is kept sorted by insertion holding squared distances until the search finishes.
+		m_AABB_tree.query_nearest(p_point, max_distance_squared, [&](const ECS::EntityID& p_entity)
+		{
+			if (!scene.has_components<Component::Collider>(p_entity))
+				return max_distance_squared;
+
+			const auto& collider = scene.get_component<Component::Collider>(p_entity);
+			if ((collider.m_layer & p_mask) == 0)
+				return max_distance_squared;
+
+			const float distance_squared = Geometry::distance_squared(collider.m_world_AABB, p_point);
+			if (distance_squared > max_distance_squared || (count == p_neighbours.size() && distance_squared >= p_neighbours.back().m_distance))
+				return max_distance_squared;
+
+			// When full the farthest neighbour is dropped.
+			size_t index = count < p_neighbours.size() ? count++ : count - 1;
+			for (; index > 0 && p_neighbours[index - 1].m_distance > distance_squared; index--)
+				p_neighbours[index] = p_neighbours[index - 1];
+			p_neighbours[index] = Neighbour{p_entity, distance_squared};
+
+			if (count == p_neighbours.size())
+				max_distance_squared = p_neighbours.back().m_distance;
+			return max_distance_squared;
+		});
+
+		for (size_t i = 0; i < count; i++)
+			p_neighbours[i].m_distance = std::sqrt(p_neighbours[i].m_distance);
+
+		return count;
+	}
+} // namespace System
@@ -1,41 +1,130 @@
 #pragma once
 
 #include "ECS/Storage.hpp"
+#include "Geometry/AABBTree.hpp"
+#include "Geometry/CollisionFilter.hpp"
 #include "Geometry/Intersect.hpp"
+#include "Geometry/Ray.hpp"
+#include "Geometry/SpatialHashGrid.hpp"
+#include "Geometry/SweepAndPrune.hpp"
+#include "Geometry/TransformBatch.hpp"
 
 #include "glm/fwd.hpp"
 
+#include <cstdint>
+#include <limits>
 #include <optional>
+#include <span>
 #include <vector>
 #include <utility>
 
 namespace Geometry
 {
-	class Ray;
+	class Frustrum;
+	class Sphere;
 }
 namespace Component
 {
+	class Collider;
 	struct Transform;
 }
+namespace Utility
+{
+	class ThreadPool;
+}
 namespace System
 {
-	class SceneSystem;
+	class Scene;
 
 	// An optimisation layer and helper for quickly finding collision information for an Entity in a scene.
+	// Every tick update() refreshes the world space AABBs of all the Colliders and finds the pairs of Entities whose AABBs overlap.
+	// Pairs whose Collider layers and masks exclude each other, and pairs without a dynamic RigidBody, are skipped by the broadphase.
+	// The broadphase proxies of Component::Sleeping bodies are kept as they were when they fell asleep, a Collider layer or mask changed
+	// while asleep applies once the body wakes or its Transform is marked dirty.
+	// Spatial queries (rays, spheres, AABBs, frustrums and nearest neighbours) traverse an AABBTree of every Entity with a Mesh instead of scanning all the Colliders.
 	class CollisionSystem
 	{
 	private:
-		SceneSystem& m_scene_system;
+		Scene& m_scene;
+		Geometry::SweepAndPrune m_sweep_and_prune;
+		Geometry::SpatialHashGrid m_spatial_hash_grid;
+		Geometry::AABBTree m_AABB_tree; // World AABBs of every Entity with a Transform and Mesh, keyed by EntityID.
+		// Where the model and world AABB of each element of m_transforms are written back to. The pointers are only valid during update.
+		struct TransformTarget
+		{
+			Component::Transform* m_transform;
+			Component::Collider* m_collider; // nullptr if the Entity has no Collider.
+			ECS::EntityID m_entity;
+			bool m_has_collision_mesh;       // The world AABB is discarded for Entities without one.
+		};
+		Geometry::TransformBatch m_transforms;            // The dirty Transforms gathered to build their models and world AABBs in SIMD batches.
+		std::vector<TransformTarget> m_transform_targets; // The target of each element of m_transforms.
 
 	public:
-		CollisionSystem(SceneSystem& p_scene_system) noexcept;
+		// The closest Collider hit by a ray in cast_rays.
+		struct RayHit
+		{
+			ECS::EntityID m_entity;
+			float m_distance;     // Distance along the ray in multiples of the ray direction.
+			glm::vec3 m_position; // Where the ray enters the Collider world AABB.
+		};
+		// A Collider found by find_nearest.
+		struct Neighbour
+		{
+			ECS::EntityID m_entity;
+			float m_distance; // Distance from the query point to the Collider world AABB, 0 if the point is inside it.
+		};
+		enum class RayQuery
+		{
+			Closest, // The nearest hit along each ray.
+			Any      // The first hit found along each ray, stops testing a ray as soon as it hits. For line of sight checks.
+		};
+
+		CollisionSystem(Scene& p_scene) noexcept;
 
-		// Returns the collision shape of p_entity in world space.
-		std::optional<Geometry::ContactPoint> get_collision(const ECS::Entity& p_entity, const ECS::Entity* p_collided_entity = nullptr) const;
+		// Update the Collider world AABBs from their Transform and Data::CollisionMesh and run the broadphase selected by the Scene over them.
+		// Only Transforms marked dirty rebuild their model matrix and world AABB, built together in Geometry::build_transforms, then have the flag cleared.
+		// Refits the AABBTree and sets the Scene bound from its root. Must be called once per physics tick after the Transforms have been integrated.
+		//@param p_thread_pool Used to compute the world AABBs and run the SpatialHashGrid broadphase in parallel.
+		void update(Utility::ThreadPool& p_thread_pool);
+		// Clear the AABBTree and broadphases so the next update rebuilds them from the scene alone, as after construction.
+		void reset();
+		// The pairs of Entities with overlapping world AABBs found in the last update. Each pair appears once, lower EntityID first.
+		const std::vector<std::pair<ECS::EntityID, ECS::EntityID>>& get_candidate_pairs() const;
 
 		// Does this ray collide with any entities.
 		bool castRay(const Geometry::Ray& p_ray, glm::vec3& out_first_intersection) const;
 		// Returns all the entities colliding with p_ray. These are returned as pairs of Entity and the length along the ray from the Ray origin.
 		std::vector<std::pair<ECS::Entity, float>> get_entities_along_ray(const Geometry::Ray& p_ray) const;
+		// Cast every ray in p_rays against the Collider world AABBs. Element i of the result is the hit for p_rays[i] or nullopt if it hits nothing.
+		// Rays are traced in Geometry::RayPacket::Size packets sharing one AABBTree traversal, rays in a packet should start close together
+		// and point in similar directions for the traversal to be shared well.
+		// Unlike castRay a Collider behind the ray start is not hit, a ray starting inside a Collider hits it at distance 0 and m_collided is not set.
+		//@param p_max_distance Hits farther along a ray than this, in multiples of its direction, are ignored.
+		//@param p_thread_pool If set, packets are traced in parallel across the pool. The scene is only read.
+		std::vector<std::optional<RayHit>> cast_rays(const std::vector<Geometry::Ray>& p_rays, const RayQuery& p_query = RayQuery::Closest, const float& p_max_distance = std::numeric_limits<float>::max(), Utility::ThreadPool* p_thread_pool = nullptr) const;
+		// Returns all the entities with a Collider intersecting p_AABB.
+		std::vector<ECS::Entity> get_entities_in(const Geometry::AABB& p_AABB) const;
+		// Returns all the entities with a Collider intersecting p_frustrum.
+		std::vector<ECS::Entity> get_entities_in(const Geometry::Frustrum& p_frustrum) const;
+
+		// Overlap queries for gameplay code run many times per tick, e.g. area of effect damage and AI perception. The Entities whose Collider
+		// world AABB intersects the shape and has a layer in p_mask are written to p_entities, nothing is allocated.
+		//@param p_entities Caller owned buffer the Entities are written to in no particular order.
+		//@param p_mask Only Colliders in one of these layers are returned.
+		//@return The number of Entities overlapping the shape. Only the first p_entities.size() are written if it is larger.
+		size_t overlap(const Geometry::Sphere& p_sphere, std::span<ECS::EntityID> p_entities, const uint32_t& p_mask = Geometry::CollisionFilter::All_Layers) const;
+		size_t overlap(const Geometry::AABB& p_AABB, std::span<ECS::EntityID> p_entities, const uint32_t& p_mask = Geometry::CollisionFilter::All_Layers) const;
+		size_t overlap(const Geometry::Frustrum& p_frustrum, std::span<ECS::EntityID> p_entities, const uint32_t& p_mask = Geometry::CollisionFilter::All_Layers) const;
+		// Find the p_neighbours.size() Colliders nearest to p_point, measured to their world AABBs, without allocating.
+		// The AABBTree is traversed nearest first and the search radius shrinks to the current farthest neighbour once the buffer is full.
+		//@param p_neighbours Caller owned buffer the neighbours are written to, nearest first.
+		//@param p_max_distance Colliders farther than this from p_point are ignored.
+		//@param p_mask Only Colliders in one of these layers are returned.
+		//@return The number of neighbours written, fewer than p_neighbours.size() if not enough Colliders are in range.
+		size_t find_nearest(const glm::vec3& p_point, std::span<Neighbour> p_neighbours, const float& p_max_distance = std::numeric_limits<float>::max(), const uint32_t& p_mask = Geometry::CollisionFilter::All_Layers) const;
+
+		// The AABBTree of every Entity with a Transform and Mesh as of the last update, Colliders or not. Use for culling.
+		const Geometry::AABBTree& get_AABB_tree() const { return m_AABB_tree; }
 	};
 } // namespace System
\ No newline at end of file
@@ -45,37 +45,37 @@ namespace System
 			{
 				auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
 				mb.add_cone(glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 1.f, 0.f), 1.f, 16);
-				return mb.get_mesh();
+				return mb.get_mesh(true);
 			}
 			case Geometry::ShapeType::Cuboid:
 			{
 				auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
 				mb.add_cuboid(glm::vec3(0.f), glm::vec3(2.f, 2.f, 2.f));
-				return mb.get_mesh();
+				return mb.get_mesh(true);
 			}
 			case Geometry::ShapeType::Cylinder:
 			{
 				auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
 				mb.add_cylinder(glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 1.f, 0.f), 1.f, 16);
-				return mb.get_mesh();
+				return mb.get_mesh(true);
 			}
 			case Geometry::ShapeType::Plane:
 			{
 				auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
 				mb.add_quad(glm::vec3(-1000.f, 0.f, -1000.f), glm::vec3(1000.f, 0.f, -1000.f), glm::vec3(-1000.f, 0.f, 1000.f), glm::vec3(1000.f, 0.f, 1000.f));
-				return mb.get_mesh();
+				return mb.get_mesh(true);
 			}
 			case Geometry::ShapeType::Sphere:
 			{
 				auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
 				mb.add_icosphere(glm::vec3(0.f, 0.f, 0.f), 1.f, 4);
-				return mb.get_mesh();
+				return mb.get_mesh(true);
 			}
 			case Geometry::ShapeType::Quad:
 			{
 				auto mb = Utility::MeshBuilder<Data::Vertex, OpenGL::PrimitiveMode::Triangles>{};
 				mb.add_quad(glm::vec3(-1.f, 0.f, -1.f), glm::vec3(1.f, 0.f, -1.f), glm::vec3(-1.f, 0.f, 1.f), glm::vec3(1.f, 0.f, 1.f));
-				return mb.get_mesh();
+				return mb.get_mesh(true);
 			}
 			default:
 				throw std::runtime_error("Invalid shape type");
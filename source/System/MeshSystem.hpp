@@ -13,6 +13,7 @@ namespace System
 
 	class MeshSystem
 	{
+		// The primitive meshes have no collision shapes, they are built with a triangle BVH so Entities using them collide with their triangles.
 		[[nodiscard]] static Data::Mesh make_mesh(Geometry::ShapeType p_shape_type);
 
 		System::TextureSystem& m_texture_system;
@@ -22,6 +23,7 @@ namespace System
 		MeshSystem(TextureSystem& p_texture_system) noexcept;
 
 		// Insert a mesh into the mesh manager.
+		// Meshes that collide without collision shapes (e.g. imported models) must be built with a triangle BVH, see Data::Mesh.
 		//@param p_mesh_data The mesh data to insert by move.
 		//@returns A reference to the inserted mesh.
 		[[nodiscard]] MeshRef insert(Data::Mesh&& p_mesh_data);
@@ -0,0 +1,254 @@
+#include "PhysicsRecording.hpp"
+
+#include "Utility/File.hpp"
+#include "Utility/Logger.hpp"
+
+#include <array>
+#include <fstream>
+#include <type_traits>
+
+namespace System
+{
+	namespace
+	{
+		constexpr std::array<char, 4> Magic = {'Z', 'P', 'H', 'Y'};
+		constexpr uint32_t Version          = 2;
+		constexpr uint64_t FNV_Offset_Basis = 14695981039346656037ull;
+		constexpr uint64_t FNV_Prime        = 1099511628211ull;
+
+		// Only scalars are written as raw bytes, glm types are written one component at a time and Bodies one member at a time.
+		template <typename T>
+		void write(std::ofstream& p_file, const T& p_value)
+		{
+			static_assert(std::is_arithmetic_v<T>);
+			p_file.write(reinterpret_cast<const char*>(&p_value), sizeof(T));
+		}
+		template <typename T>
+		bool read(std::ifstream& p_file, T& p_value)
+		{
+			static_assert(std::is_arithmetic_v<T>);
+			return static_cast<bool>(p_file.read(reinterpret_cast<char*>(&p_value), sizeof(T)));
+		}
+
+		template <glm::length_t Length>
+		void write(std::ofstream& p_file, const glm::vec<Length, float>& p_value)
+		{
+			for (glm::length_t i = 0; i < Length; i++)
+				write(p_file, p_value[i]);
+		}
+		template <glm::length_t Length>
+		bool read(std::ifstream& p_file, glm::vec<Length, float>& p_value)
+		{
+			bool valid = true;
+			for (glm::length_t i = 0; valid && i < Length; i++)
+				valid = read(p_file, p_value[i]);
+			return valid;
+		}
+		void write(std::ofstream& p_file, const glm::quat& p_value)
+		{
+			write(p_file, p_value.w);
+			write(p_file, p_value.x);
+			write(p_file, p_value.y);
+			write(p_file, p_value.z);
+		}
+		bool read(std::ifstream& p_file, glm::quat& p_value)
+		{
+			return read(p_file, p_value.w) && read(p_file, p_value.x) && read(p_file, p_value.y) && read(p_file, p_value.z);
+		}
+		void write(std::ofstream& p_file, const glm::mat3& p_value)
+		{
+			for (glm::length_t column = 0; column < 3; column++)
+				write(p_file, p_value[column]);
+		}
+		bool read(std::ifstream& p_file, glm::mat3& p_value)
+		{
+			return read(p_file, p_value[0]) && read(p_file, p_value[1]) && read(p_file, p_value[2]);
+		}
+
+		void write(std::ofstream& p_file, const PhysicsRecording::Body& p_body)
+		{
+			write(p_file, static_cast<uint64_t>(p_body.m_entity));
+			write(p_file, p_body.m_position);
+			write(p_file, p_body.m_orientation);
+			write(p_file, p_body.m_scale);
+			write(p_file, p_body.m_momentum);
+			write(p_file, p_body.m_velocity);
+			write(p_file, p_body.m_angular_momentum);
+			write(p_file, p_body.m_angular_velocity);
+			write(p_file, p_body.m_inertia_tensor);
+			write(p_file, p_body.m_mass);
+			write(p_file, static_cast<uint8_t>(p_body.m_apply_gravity));
+			write(p_file, static_cast<uint8_t>(p_body.m_type));
+		}
+		bool read(std::ifstream& p_file, PhysicsRecording::Body& p_body)
+		{
+			uint64_t entity       = 0;
+			uint8_t apply_gravity = 0;
+			uint8_t type          = 0;
+			const bool valid = read(p_file, entity)
+				&& read(p_file, p_body.m_position)
+				&& read(p_file, p_body.m_orientation)
+				&& read(p_file, p_body.m_scale)
+				&& read(p_file, p_body.m_momentum)
+				&& read(p_file, p_body.m_velocity)
+				&& read(p_file, p_body.m_angular_momentum)
+				&& read(p_file, p_body.m_angular_velocity)
+				&& read(p_file, p_body.m_inertia_tensor)
+				&& read(p_file, p_body.m_mass)
+				&& read(p_file, apply_gravity)
+				&& read(p_file, type)
+				&& type <= static_cast<uint8_t>(Component::RigidBody::Type::Dynamic);
+
+			p_body.m_entity        = static_cast<ECS::EntityID>(entity);
+			p_body.m_apply_gravity = apply_gravity != 0;
+			p_body.m_type          = static_cast<Component::RigidBody::Type>(type);
+			return valid;
+		}
+	} // namespace
+
+	PhysicsRecording::Body::Body(const ECS::EntityID& p_entity, const Component::Transform& p_transform, const Component::RigidBody& p_rigid_body) noexcept
+		: m_entity{p_entity}
+		, m_position{p_transform.m_position}
+		, m_orientation{p_transform.m_orientation}
+		, m_scale{p_transform.m_scale}
+		, m_momentum{p_rigid_body.m_momentum}
+		, m_velocity{p_rigid_body.m_velocity}
+		, m_angular_momentum{p_rigid_body.m_angular_momentum}
+		, m_angular_velocity{p_rigid_body.m_angular_velocity}
+		, m_inertia_tensor{p_rigid_body.m_inertia_tensor}
+		, m_mass{p_rigid_body.m_mass}
+		, m_apply_gravity{p_rigid_body.m_apply_gravity}
+		, m_type{p_rigid_body.m_type}
+	{}
+	void PhysicsRecording::Body::restore(Component::Transform& p_transform, Component::RigidBody& p_rigid_body) const
+	{
+		p_transform.m_position    = m_position;
+		p_transform.m_orientation = m_orientation;
+		p_transform.m_direction   = glm::normalize(m_orientation * Component::Transform::Starting_Forward_Direction);
+		p_transform.m_scale       = m_scale;
+		p_transform.store_previous_state();
+		p_transform.mark_dirty();
+
+		p_rigid_body.m_momentum         = m_momentum;
+		p_rigid_body.m_velocity         = m_velocity;
+		p_rigid_body.m_angular_momentum = m_angular_momentum;
+		p_rigid_body.m_angular_velocity = m_angular_velocity;
+		p_rigid_body.m_inertia_tensor   = m_inertia_tensor;
+		p_rigid_body.m_mass             = m_mass;
+		p_rigid_body.m_apply_gravity    = m_apply_gravity;
+		p_rigid_body.m_type             = m_type;
+	}
+
+	bool PhysicsRecording::save(const std::filesystem::path& p_path) const
+	{
+		std::ofstream file(p_path, std::ios::binary);
+		if (!file)
+		{
+			LOG_ERROR("[PHYSICS RECORDING] Failed to open '{}' for writing", p_path.string());
+			return false;
+		}
+
+		for (const auto& character : Magic)
+			write(file, character);
+		write(file, Version);
+
+		write(file, static_cast<uint64_t>(m_bodies.size()));
+		for (const auto& body : m_bodies)
+			write(file, body);
+
+		write(file, static_cast<uint64_t>(m_ticks.size()));
+		for (const auto& tick : m_ticks)
+		{
+			write(file, tick.m_delta_time.count());
+			write(file, tick.m_checksum);
+			write(file, static_cast<uint32_t>(tick.m_forces.size()));
+			for (const auto& force : tick.m_forces)
+			{
+				write(file, static_cast<uint64_t>(force.m_entity));
+				write(file, force.m_force);
+				write(file, force.m_torque);
+			}
+		}
+
+		LOG("[PHYSICS RECORDING] Saved {} bodies over {} ticks to '{}'", m_bodies.size(), m_ticks.size(), p_path.string());
+		return static_cast<bool>(file);
+	}
+
+	std::optional<PhysicsRecording> PhysicsRecording::load(const std::filesystem::path& p_path)
+	{
+		if (!Utility::File::exists(p_path))
+		{
+			LOG_ERROR("[PHYSICS RECORDING] File with path '{}' doesnt exist", p_path.string());
+			return std::nullopt;
+		}
+
+		std::ifstream file(p_path, std::ios::binary);
+		std::array<char, 4> magic = {};
+		uint32_t version          = 0;
+		if (!read(file, magic[0]) || !read(file, magic[1]) || !read(file, magic[2]) || !read(file, magic[3]) || magic != Magic
+			|| !read(file, version) || version != Version)
+		{
+			LOG_ERROR("[PHYSICS RECORDING] '{}' is not a version {} physics recording", p_path.string(), Version);
+			return std::nullopt;
+		}
+
+		PhysicsRecording recording;
+		bool valid = true;
+
+		uint64_t body_count = 0;
+		valid &= read(file, body_count);
+		for (uint64_t i = 0; valid && i < body_count; i++)
+			valid &= read(file, recording.m_bodies.emplace_back());
+
+		uint64_t tick_count = 0;
+		valid &= read(file, tick_count);
+		for (uint64_t i = 0; valid && i < tick_count; i++)
+		{
+			float delta_time     = 0.f;
+			uint32_t force_count = 0;
+			auto& tick           = recording.m_ticks.emplace_back();
+			valid &= read(file, delta_time) && read(file, tick.m_checksum) && read(file, force_count);
+			tick.m_delta_time = DeltaTime(delta_time);
+
+			for (uint32_t j = 0; valid && j < force_count; j++)
+			{
+				uint64_t entity = 0;
+				auto& force     = tick.m_forces.emplace_back();
+				valid &= read(file, entity) && read(file, force.m_force) && read(file, force.m_torque);
+				force.m_entity = static_cast<ECS::EntityID>(entity);
+			}
+		}
+
+		if (!valid)
+		{
+			LOG_ERROR("[PHYSICS RECORDING] '{}' is truncated or corrupt", p_path.string());
+			return std::nullopt;
+		}
+		return recording;
+	}
+
+	uint64_t PhysicsRecording::get_checksum(ECS::Storage& p_scene)
+	{
+		// FNV-1a over the raw bytes so any difference in any bit changes the checksum.
+		uint64_t hash = FNV_Offset_Basis;
+		auto hash_bytes = [&hash](const auto& p_value)
+		{
+			const auto* bytes = reinterpret_cast<const unsigned char*>(&p_value);
+			for (size_t i = 0; i < sizeof(p_value); i++)
+			{
+				hash ^= bytes[i];
+				hash *= FNV_Prime;
+			}
+		};
+
+		p_scene.foreach([&hash_bytes](ECS::Entity& p_entity, Component::Transform& p_transform, Component::RigidBody& p_rigid_body)
+		{
+			hash_bytes(p_entity.ID);
+			hash_bytes(p_transform.m_position);
+			hash_bytes(p_transform.m_orientation);
+			hash_bytes(p_rigid_body.m_momentum);
+			hash_bytes(p_rigid_body.m_angular_momentum);
+		});
+		return hash;
+	}
+} // namespace System
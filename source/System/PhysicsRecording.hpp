@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Component/RigidBody.hpp"
+#include "Component/Transform.hpp"
+#include "ECS/Storage.hpp"
+#include "Utility/Config.hpp"
+
+#include "glm/gtx/quaternion.hpp"
+#include "glm/mat3x3.hpp"
+#include "glm/vec3.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace System
+{
+	// The starting state and per-tick inputs of a run of PhysicsSystem ticks. Recorded by PhysicsSystem::start_recording and
+	// re-simulated by PhysicsSystem::replay to reproduce the same workload, e.g. to compare optimisations or find a slow tick.
+	// Only the Transform and RigidBody state of the bodies is recorded, a recording must be replayed in the scene it was recorded in
+	// (same meshes, colliders and EntityIDs). Changes made to the bodies outside of forces (e.g. moving them in the editor) are not recorded.
+	struct PhysicsRecording
+	{
+		// The Transform and RigidBody members a tick reads. Members derived from these (m_model, m_direction) or reset by
+		// PhysicsSystem::reset before the first tick (forces, sleep state) are left out.
+		struct Body
+		{
+			ECS::EntityID m_entity;
+			glm::vec3 m_position;
+			glm::quat m_orientation;
+			glm::vec3 m_scale;
+			glm::vec3 m_momentum;
+			glm::vec3 m_velocity;
+			glm::vec3 m_angular_momentum;
+			glm::vec3 m_angular_velocity;
+			glm::mat3 m_inertia_tensor;
+			float m_mass;
+			bool m_apply_gravity;
+			Component::RigidBody::Type m_type;
+
+			Body() noexcept = default;
+			Body(const ECS::EntityID& p_entity, const Component::Transform& p_transform, const Component::RigidBody& p_rigid_body) noexcept;
+			// Set the recorded members of p_transform and p_rigid_body and mark p_transform dirty.
+			void restore(Component::Transform& p_transform, Component::RigidBody& p_rigid_body) const;
+		};
+		// A force and torque applied to a RigidBody before a tick.
+		struct Force
+		{
+			ECS::EntityID m_entity;
+			glm::vec3 m_force;
+			glm::vec3 m_torque;
+		};
+		struct Tick
+		{
+			DeltaTime m_delta_time;
+			std::vector<Force> m_forces;
+			uint64_t m_checksum; // get_checksum of the scene after the tick.
+		};
+
+		std::vector<Body> m_bodies; // State of every body when the recording started.
+		std::vector<Tick> m_ticks;
+
+		// Write the recording to p_path in a compact binary format, one member at a time so the file doesn't depend on the component layouts.
+		//@return True if the file was written.
+		bool save(const std::filesystem::path& p_path) const;
+		// Read a recording written by save. Returns nullopt if the file doesn't exist, is truncated or was written by a different version.
+		static std::optional<PhysicsRecording> load(const std::filesystem::path& p_path);
+
+		// Hash of the position, orientation and momenta of every body in p_scene.
+		// Equal checksums after the same tick mean the simulation matched bit for bit.
+		static uint64_t get_checksum(ECS::Storage& p_scene);
+	};
+} // namespace System
@@ -3,23 +3,293 @@
 #include "SceneSystem.hpp"
 
 #include "Component/Camera.hpp"
-#include "Component/Mesh.hpp"
+#include "Component/Collider.hpp"
+#include "Component/CollisionMesh.hpp"
 #include "Component/RigidBody.hpp"
+#include "Component/Terrain.hpp"
 #include "Component/Transform.hpp"
 #include "ECS/Storage.hpp"
 #include "Geometry/Geometry.hpp"
+#include "Utility/Logger.hpp"
+#include "Utility/Stopwatch.hpp"
 #include "Utility/Utility.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <limits>
+
 namespace System
 {
-	PhysicsSystem::PhysicsSystem(SceneSystem& scene_system, CollisionSystem& collision_system)
+	namespace
+	{
+		// Identifies an unordered pair of Entities, lower EntityID in the high bits.
+		uint64_t get_pair_key(const ECS::EntityID& p_entity_1, const ECS::EntityID& p_entity_2)
+		{
+			return (static_cast<uint64_t>(std::min(p_entity_1, p_entity_2)) << 32) | static_cast<uint64_t>(std::max(p_entity_1, p_entity_2));
+		}
+
+		// Rotation * Scale of p_transform, with m_position maps object space to world space.
+		glm::mat3 get_linear(const Component::Transform& p_transform)
+		{
+			auto linear = glm::mat3_cast(p_transform.m_orientation);
+			linear[0] *= p_transform.m_scale.x;
+			linear[1] *= p_transform.m_scale.y;
+			linear[2] *= p_transform.m_scale.z;
+			return linear;
+		}
+		// p_tensor about the local axes of p_transform rotated into world space, R p_tensor Rᵀ.
+		// m_inertia_tensor is about the body's local axes, angular momentum and the contact arms are in world space.
+		glm::mat3 to_world_space(const glm::mat3& p_tensor, const Component::Transform& p_transform)
+		{
+			const auto rotation = glm::mat3_cast(p_transform.m_orientation);
+			return rotation * p_tensor * glm::transpose(rotation);
+		}
+
+		// Whether p_entity is moved by forces and contacts. Static and kinematic bodies and Entities without a RigidBody (Terrain) are not.
+		bool is_dynamic(ECS::Storage& p_scene, const ECS::EntityID& p_entity)
+		{
+			return p_scene.has_components<Component::RigidBody>(p_entity) && p_scene.get_component<Component::RigidBody>(p_entity).m_type == Component::RigidBody::Type::Dynamic;
+		}
+		// Whether p_entity won't move this tick unless a contact wakes it: sleeping, static, kinematic without momentum or without a RigidBody.
+		bool is_resting(ECS::Storage& p_scene, const ECS::EntityID& p_entity)
+		{
+			if (!p_scene.has_components<Component::RigidBody>(p_entity))
+				return true;
+
+			const auto& rigid_body = p_scene.get_component<Component::RigidBody>(p_entity);
+			switch (rigid_body.m_type)
+			{
+				case Component::RigidBody::Type::Static:    return true;
+				case Component::RigidBody::Type::Kinematic: return rigid_body.m_momentum == glm::vec3(0.f) && rigid_body.m_angular_momentum == glm::vec3(0.f);
+				case Component::RigidBody::Type::Dynamic:   return rigid_body.m_asleep;
+			}
+			return true;
+		}
+		// Whether p_entity still takes part in the narrow phase, false once it's deleted or loses its Collider or Terrain.
+		bool is_collidable(ECS::Storage& p_scene, const ECS::EntityID& p_entity)
+		{
+			return p_scene.has_components<Component::Collider>(p_entity) || p_scene.has_components<Component::Terrain>(p_entity);
+		}
+		// Whether the Collider layers and masks of p_entity_1 and p_entity_2 let them collide.
+		bool layers_collide(ECS::Storage& p_scene, const ECS::EntityID& p_entity_1, const ECS::EntityID& p_entity_2)
+		{
+			const auto& collider_1 = p_scene.get_component<Component::Collider>(p_entity_1);
+			const auto& collider_2 = p_scene.get_component<Component::Collider>(p_entity_2);
+			return Geometry::can_collide({collider_1.m_layer, collider_1.m_mask}, {collider_2.m_layer, collider_2.m_mask});
+		}
+
+		// The collision data of p_entity or nullptr if it has no Collider or its Collider has none.
+		const Data::CollisionMesh* get_collision_mesh(ECS::Storage& p_scene, const ECS::EntityID& p_entity)
+		{
+			return p_scene.has_components<Component::Collider>(p_entity) ? p_scene.get_component<Component::Collider>(p_entity).m_collision_mesh : nullptr;
+		}
+		// Whether p_entity has collision shapes for GJK/EPA.
+		bool has_collision_shapes(ECS::Storage& p_scene, const ECS::EntityID& p_entity)
+		{
+			const auto* collision_mesh = get_collision_mesh(p_scene, p_entity);
+			return collision_mesh && !collision_mesh->collision_shapes.empty();
+		}
+
+		// The collision shapes of p_entity in world space.
+		template <typename Func>
+		void foreach_world_shape(ECS::Storage& p_scene, const ECS::EntityID& p_entity, Func&& p_func)
+		{
+			const auto& transform = p_scene.get_component<Component::Transform>(p_entity);
+			const auto linear     = get_linear(transform);
+			for (const auto& shape : p_scene.get_component<Component::Collider>(p_entity).m_collision_mesh->collision_shapes)
+				p_func(Geometry::ConvexShape{shape, linear, transform.m_position});
+		}
+
+		// p_manifold from the perspective of the other shape. The points move onto the surface of the other shape along the normal.
+		Geometry::ContactManifold flip(Geometry::ContactManifold p_manifold)
+		{
+			for (size_t i = 0; i < p_manifold.m_count; i++)
+			{
+				auto& point     = p_manifold.m_points[i];
+				point.position += point.normal * point.penetration_depth;
+				point.normal    = -point.normal;
+			}
+			return p_manifold;
+		}
+
+		// p_world_AABB in the object space placed in world space by p_linear and p_translation, enclosing the transformed box.
+		// Reference: Graphics Gems (James Arvo) - Transforming Axis-Aligned Bounding Boxes pg 548
+		Geometry::AABB to_object_space(const Geometry::AABB& p_world_AABB, const glm::mat3& p_linear, const glm::vec3& p_translation)
+		{
+			const auto inverse_linear = glm::inverse(p_linear);
+			const auto center         = inverse_linear * (p_world_AABB.get_center() - p_translation);
+			const auto world_extents  = p_world_AABB.get_size() * 0.5f;
+			auto extents = glm::vec3(0.f);
+			for (int column = 0; column < 3; column++)
+				for (int row = 0; row < 3; row++)
+					extents[row] += std::abs(inverse_linear[column][row]) * world_extents[column];
+			return Geometry::AABB(center - extents, center + extents);
+		}
+
+		// Add the contacts between the collision shapes of p_entity and the triangles of p_triangles placed in world space by p_linear
+		// and p_translation to p_manifold, from the perspective of p_entity. Only the triangles overlapping the world AABB of p_entity are tested.
+		// p_triangles is a Geometry::TriangleBVH or Geometry::Heightfield, anything with a query(AABB, func(const Triangle&)).
+		template <typename Triangles>
+		void add_triangle_contacts(ECS::Storage& p_scene, const ECS::EntityID& p_entity, const Triangles& p_triangles, const glm::mat3& p_linear, const glm::vec3& p_translation, Geometry::ContactManifold& p_manifold)
+		{
+			const auto& world_AABB = p_scene.get_component<Component::Collider>(p_entity).m_world_AABB;
+			p_triangles.query(to_object_space(world_AABB, p_linear, p_translation), [&](const Geometry::Triangle& p_triangle)
+			{
+				const auto triangle_shape = Geometry::Shape(p_triangle);
+				const auto triangle       = Geometry::ConvexShape{triangle_shape, p_linear, p_translation};
+				foreach_world_shape(p_scene, p_entity, [&](const Geometry::ConvexShape& p_shape)
+				{
+					if (const auto shape_manifold = Geometry::get_contact_manifold(p_shape, triangle))
+						for (const auto& contact_point : *shape_manifold)
+							p_manifold.add(contact_point);
+				});
+			});
+		}
+
+		// The contacts between the triangles of two meshes without collision shapes, from the perspective of p_entity_1. Only the triangles
+		// inside the overlap of the two world AABBs are tested, each triangle of mesh 1 against every candidate of mesh 2 in one batch.
+		std::optional<Geometry::ContactManifold> get_triangle_contact_manifold(ECS::Storage& p_scene, const ECS::EntityID& p_entity_1, const Data::CollisionMesh& p_mesh_1, const ECS::EntityID& p_entity_2, const Data::CollisionMesh& p_mesh_2)
+		{
+			const auto& AABB_1 = p_scene.get_component<Component::Collider>(p_entity_1).m_world_AABB;
+			const auto& AABB_2 = p_scene.get_component<Component::Collider>(p_entity_2).m_world_AABB;
+			if (!Geometry::intersecting(AABB_1, AABB_2))
+				return std::nullopt;
+			const auto overlap = Geometry::AABB(glm::max(AABB_1.m_min, AABB_2.m_min), glm::min(AABB_1.m_max, AABB_2.m_max));
+
+			const auto& transform_1 = p_scene.get_component<Component::Transform>(p_entity_1);
+			const auto& transform_2 = p_scene.get_component<Component::Transform>(p_entity_2);
+			const auto linear_1     = get_linear(transform_1);
+			const auto linear_2     = get_linear(transform_2);
+			auto to_world = [](const Geometry::Triangle& p_triangle, const glm::mat3& p_linear, const glm::vec3& p_translation)
+			{
+				return Geometry::Triangle(p_linear * p_triangle.m_point_1 + p_translation, p_linear * p_triangle.m_point_2 + p_translation, p_linear * p_triangle.m_point_3 + p_translation);
+			};
+
+			// Per narrow phase thread so the pairs don't allocate once the buffers have grown to the largest pair.
+			thread_local std::vector<Geometry::Triangle> triangles_2;
+			thread_local std::vector<uint64_t> hits;
+			triangles_2.clear();
+			p_mesh_2.triangle_BVH.query(to_object_space(overlap, linear_2, transform_2.m_position), [&](const Geometry::Triangle& p_triangle)
+			{
+				triangles_2.push_back(to_world(p_triangle, linear_2, transform_2.m_position));
+			});
+			if (triangles_2.empty())
+				return std::nullopt;
+			hits.resize(Geometry::hit_mask_size(triangles_2.size()));
+
+			Geometry::ContactManifold manifold;
+			p_mesh_1.triangle_BVH.query(to_object_space(overlap, linear_1, transform_1.m_position), [&](const Geometry::Triangle& p_triangle)
+			{
+				const auto triangle_1 = to_world(p_triangle, linear_1, transform_1.m_position);
+				if (Geometry::intersecting(triangle_1, triangles_2, hits) == 0)
+					return;
+
+				for (size_t word_index = 0; word_index < hits.size(); word_index++)
+				{
+					// Clear the lowest set bit each iteration, visiting only the hits.
+					for (uint64_t word = hits[word_index]; word != 0; word &= word - 1)
+						if (const auto contact = Geometry::get_intersection(triangle_1, triangles_2[word_index * 64 + std::countr_zero(word)]))
+							manifold.add(*contact);
+				}
+			});
+
+			if (manifold.m_count == 0)
+				return std::nullopt;
+			return manifold;
+		}
+
+		// The contacts between every pair of collision shapes of p_entity_1 and p_entity_2 merged into one manifold keeping the deepest points.
+		// A mesh without collision shapes collides using the triangles of its triangle_BVH against the collision shapes or triangles of the other.
+		// Falls back to the world AABBs when neither works.
+		std::optional<Geometry::ContactManifold> get_contact_manifold(ECS::Storage& p_scene, const ECS::EntityID& p_entity_1, const ECS::EntityID& p_entity_2)
+		{
+			const auto* mesh_1 = get_collision_mesh(p_scene, p_entity_1);
+			const auto* mesh_2 = get_collision_mesh(p_scene, p_entity_2);
+			const bool has_shapes_1 = mesh_1 && !mesh_1->collision_shapes.empty();
+			const bool has_shapes_2 = mesh_2 && !mesh_2->collision_shapes.empty();
+
+			if ((has_shapes_1 && !has_shapes_2 && mesh_2 && !mesh_2->triangle_BVH.empty())
+			 || (has_shapes_2 && !has_shapes_1 && mesh_1 && !mesh_1->triangle_BVH.empty()))
+			{
+				const auto& shapes_entity    = has_shapes_1 ? p_entity_1 : p_entity_2;
+				const auto& triangles_entity = has_shapes_1 ? p_entity_2 : p_entity_1;
+				const auto& transform        = p_scene.get_component<Component::Transform>(triangles_entity);
+
+				Geometry::ContactManifold manifold;
+				add_triangle_contacts(p_scene, shapes_entity, (has_shapes_1 ? mesh_2 : mesh_1)->triangle_BVH, get_linear(transform), transform.m_position, manifold);
+				if (manifold.m_count == 0)
+					return std::nullopt;
+				return has_shapes_1 ? manifold : flip(manifold);
+			}
+			if (!has_shapes_1 && !has_shapes_2 && mesh_1 && mesh_2 && !mesh_1->triangle_BVH.empty() && !mesh_2->triangle_BVH.empty())
+				return get_triangle_contact_manifold(p_scene, p_entity_1, *mesh_1, p_entity_2, *mesh_2);
+			if (!has_shapes_1 || !has_shapes_2)
+			{
+				const auto contact = Geometry::get_intersection(p_scene.get_component<Component::Collider>(p_entity_1).m_world_AABB, p_scene.get_component<Component::Collider>(p_entity_2).m_world_AABB);
+				if (!contact)
+					return std::nullopt;
+
+				Geometry::ContactManifold manifold;
+				manifold.add(*contact);
+				return manifold;
+			}
+
+			Geometry::ContactManifold manifold;
+			foreach_world_shape(p_scene, p_entity_1, [&](const Geometry::ConvexShape& p_shape_1)
+			{
+				foreach_world_shape(p_scene, p_entity_2, [&](const Geometry::ConvexShape& p_shape_2)
+				{
+					if (const auto shape_manifold = Geometry::get_contact_manifold(p_shape_1, p_shape_2))
+						for (const auto& contact_point : *shape_manifold)
+							manifold.add(contact_point);
+				});
+			});
+
+			if (manifold.m_count == 0)
+				return std::nullopt;
+			return manifold;
+		}
+	} // namespace
+
+	PhysicsSystem::PhysicsSystem(Scene& scene, CollisionSystem& collision_system)
 		: m_update_count{0}
-		, m_restitution{0.8f}
 		, m_apply_collision_response{true}
-		, m_scene_system{scene_system}
+		, m_contact_solver{}
+		, m_integration_mode{Geometry::IntegrationMode::SIMD}
+		, m_contact_events{}
+		, m_allow_sleeping{true}
+		, m_sleep_linear_velocity{0.2f}
+		, m_sleep_angular_velocity{0.2f}
+		, m_time_to_sleep{DeltaTime(0.5f)}
+		, m_continuous_collision{true}
+		, m_CCD_velocity{5.f}
+		, m_scene{scene}
 		, m_collision_system{collision_system}
 		, m_total_simulation_time{DeltaTime::zero()}
 		, m_gravity{glm::vec3(0.f, -9.81f, 0.f)}
+		, m_thread_pool{}
+		, m_bodies{}
+		, m_pair_contacts{}
+		, m_terrain_pairs{}
+		, m_contacts{}
+		, m_contact_pairs{}
+		, m_contact_event_batch{}
+		, m_solver_bodies{}
+		, m_solver_entities{}
+		, m_solver_body_of{}
+		, m_sleeping_islands{}
+		, m_sleeping_island_of{}
+		, m_awake_bodies{}
+		, m_awake_rigid_bodies{}
+		, m_body_slot_of{}
+		, m_island_parent{}
+		, m_island_sleep_timer{}
+		, m_island_index{}
+		, m_fast_bodies{}
+		, m_fallen_asleep_bodies{}
+		, m_woken_bodies{}
+		, m_stage_timings{}
+		, m_recording{}
 	{}
 
 	void PhysicsSystem::integrate(const DeltaTime& p_delta_time)
@@ -27,82 +297,622 @@ namespace System
 		m_update_count++;
 		m_total_simulation_time += p_delta_time;
 
-		auto& scene = m_scene_system.get_current_scene();
-		scene.foreach([this, &p_delta_time, &scene](ECS::Entity& entity, Component::RigidBody& rigid_body, Component::Transform& transform)
+		auto& scene = m_scene.m_entities;
+		// Renders until the next tick interpolate from the state at the start of this tick.
+		// Sleeping bodies don't move, their previous state was stored when they fell asleep.
+		scene.foreach_archetype<Component::Transform>([](const ECS::Storage::ArchetypeView& p_archetype)
+		{
+			if (p_archetype.has_components<Component::Sleeping>())
+				return;
+
+			const auto transforms = p_archetype.get_components<Component::Transform>();
+			for (size_t i = 0; i < p_archetype.size(); i++)
+				transforms[i].store_previous_state();
+		});
+
+		if (m_recording)
+		{
+			auto& tick = m_recording->m_ticks.emplace_back();
+			tick.m_delta_time = p_delta_time;
+			scene.foreach([&tick](ECS::Entity& entity, Component::RigidBody& rigid_body)
+			{
+				if (rigid_body.m_force != glm::vec3(0.f) || rigid_body.m_torque != glm::vec3(0.f))
+					tick.m_forces.push_back({entity, rigid_body.m_force, rigid_body.m_torque});
+			});
+		}
+
+		auto time = [](auto&& p_stage)
+		{
+			Utility::Stopwatch stopwatch;
+			p_stage();
+			return stopwatch.duration_since_start<float, std::milli>();
+		};
+
+		m_stage_timings.m_sleeping             = time([&]() { wake_bodies(); });
+		m_stage_timings.m_integration          = time([&]() { integrate_bodies(p_delta_time); });
+		m_stage_timings.m_continuous_collision = time([&]() { if (m_continuous_collision) sweep_fast_bodies(); });
+		// After moving all the bodies, update the Collider world AABBs and find the overlapping pairs in one broadphase pass.
+		m_stage_timings.m_broadphase           = time([&]() { m_collision_system.update(m_thread_pool); });
+		m_stage_timings.m_narrow_phase         = time([&]() { narrow_phase(); update_contact_pairs(); });
+		m_stage_timings.m_collision_response   = time([&]() { if (m_apply_collision_response) resolve_contacts(p_delta_time); });
+		m_stage_timings.m_sleeping            += time([&]() { update_sleeping(p_delta_time); });
+
+		if (m_recording)
+			m_recording->m_ticks.back().m_checksum = PhysicsRecording::get_checksum(scene);
+
+		// Handlers see the state at the end of the tick.
+		if (!m_contact_event_batch.empty())
+			m_contact_events.dispatch(m_contact_event_batch);
+	}
+
+	const Contact* PhysicsSystem::find_contact(const ECS::EntityID& p_entity_1, const ECS::EntityID& p_entity_2) const
+	{
+		const auto pair = m_contact_pairs.find(get_pair_key(p_entity_1, p_entity_2));
+		return pair != m_contact_pairs.end() ? &pair->second.first : nullptr;
+	}
+
+	void PhysicsSystem::reset()
+	{
+		m_contact_solver.clear_cache();
+		m_collision_system.reset();
+		m_contacts.clear();
+		m_contact_pairs.clear();
+		m_sleeping_islands.clear();
+		m_sleeping_island_of.clear();
+		m_scene.m_entities.foreach([](Component::RigidBody& rigid_body) { rigid_body.wake(); });
+		m_scene.m_entities.foreach([this](ECS::Entity& entity, Component::Sleeping&) { m_woken_bodies.push_back(entity); });
+		remove_sleeping_tags();
+	}
+
+	void PhysicsSystem::start_recording()
+	{
+		reset();
+
+		m_recording.emplace();
+		m_scene.m_entities.foreach([this](ECS::Entity& entity, Component::Transform& transform, Component::RigidBody& rigid_body)
+		{
+			m_recording->m_bodies.emplace_back(entity, transform, rigid_body);
+		});
+		LOG("[PHYSICS] Started recording {} bodies", m_recording->m_bodies.size());
+	}
+	PhysicsRecording PhysicsSystem::stop_recording()
+	{
+		ASSERT(m_recording.has_value(), "[PHYSICS] stop_recording called without start_recording");
+		auto recording = std::move(*m_recording);
+		m_recording.reset();
+		return recording;
+	}
+
+	PhysicsSystem::ReplayReport PhysicsSystem::replay(const PhysicsRecording& p_recording)
+	{
+		ASSERT(!m_recording.has_value(), "[PHYSICS] Cannot replay while recording");
+		auto& scene = m_scene.m_entities;
+		for (const auto& body : p_recording.m_bodies)
+		{
+			if (!scene.has_components<Component::Transform, Component::RigidBody>(body.m_entity))
+			{
+				LOG_WARN("[PHYSICS] Recorded body {} is not in the scene, the replay will not match the recording", body.m_entity);
+				continue;
+			}
+			body.restore(scene.get_component<Component::Transform>(body.m_entity), scene.get_component<Component::RigidBody>(body.m_entity));
+		}
+		reset();
+
+		ReplayReport report;
+		report.m_tick_timings.reserve(p_recording.m_ticks.size());
+		report.m_checksums.reserve(p_recording.m_ticks.size());
+		for (size_t i = 0; i < p_recording.m_ticks.size(); i++)
+		{
+			const auto& tick = p_recording.m_ticks[i];
+			// Only non-zero forces are recorded, every other body had none applied before the tick.
+			scene.foreach([](Component::RigidBody& rigid_body)
+			{
+				rigid_body.m_force  = glm::vec3(0.f);
+				rigid_body.m_torque = glm::vec3(0.f);
+			});
+			for (const auto& force : tick.m_forces)
+			{
+				if (scene.has_components<Component::RigidBody>(force.m_entity))
+				{
+					auto& rigid_body    = scene.get_component<Component::RigidBody>(force.m_entity);
+					rigid_body.m_force  = force.m_force;
+					rigid_body.m_torque = force.m_torque;
+				}
+			}
+
+			integrate(tick.m_delta_time);
+
+			report.m_tick_timings.push_back(m_stage_timings);
+			report.m_checksums.push_back(PhysicsRecording::get_checksum(scene));
+			if (!report.m_first_mismatch && report.m_checksums.back() != tick.m_checksum)
+				report.m_first_mismatch = i;
+		}
+		return report;
+	}
+
+	void PhysicsSystem::wake_bodies()
+	{
+		// Bodies can be woken outside the PhysicsSystem by a force or RigidBody::wake, the rest of their island wakes with them.
+		// Neither tells the PhysicsSystem so the sleeping bodies are checked every tick, only their archetypes are visited.
+		auto& scene = m_scene.m_entities;
+		scene.foreach([this](ECS::Entity& entity, Component::RigidBody& rigid_body, Component::Sleeping&)
+		{
+			if (!rigid_body.m_asleep || rigid_body.m_force != glm::vec3(0.f) || rigid_body.m_torque != glm::vec3(0.f))
+				wake_island(entity);
+		});
+		remove_sleeping_tags();
+	}
+
+	void PhysicsSystem::integrate_bodies(const DeltaTime& p_delta_time)
+	{
+		auto& scene = m_scene.m_entities;
+		m_bodies.resize(scene.count_components<Component::RigidBody, Component::Transform>() - scene.count_components<Component::RigidBody, Component::Transform, Component::Sleeping>());
+
+		// Gather the components into m_bodies. The archetypes are visited in the same order when scattering the results back.
+		// Sleeping bodies are skipped an archetype at a time, bodies put to sleep outside the PhysicsSystem are skipped one by one until update_sleeping tags them.
+		size_t index = 0;
+		scene.foreach_archetype<Component::RigidBody, Component::Transform>([this, &index](const ECS::Storage::ArchetypeView& p_archetype)
+		{
+			if (p_archetype.has_components<Component::Sleeping>())
+				return;
+
+			const auto rigid_bodies = p_archetype.get_components<Component::RigidBody>();
+			const auto transforms   = p_archetype.get_components<Component::Transform>();
+			for (size_t i = 0; i < p_archetype.size(); i++)
+			{
+				const auto& rigid_body = rigid_bodies[i];
+				const auto& transform  = transforms[i];
+				if (rigid_body.m_asleep || rigid_body.m_type == Component::RigidBody::Type::Static)
+					continue;
+
+				// Kinematic bodies keep their momentum, only dynamic bodies are moved by forces.
+				const bool dynamic = rigid_body.m_type == Component::RigidBody::Type::Dynamic;
+				auto force = dynamic ? rigid_body.m_force : glm::vec3(0.f);
+				if (dynamic && rigid_body.m_apply_gravity)
+					force += rigid_body.m_mass * m_gravity; // F = ma
+
+				m_bodies.m_force.set(index, force);
+				m_bodies.m_torque.set(index, dynamic ? rigid_body.m_torque : glm::vec3(0.f));
+				m_bodies.m_mass[index] = rigid_body.m_mass;
+
+				const auto inverse_inertia_tensor = to_world_space(glm::inverse(rigid_body.m_inertia_tensor), transform);
+				for (int column = 0; column < 3; column++)
+					for (int row = 0; row < 3; row++)
+						m_bodies.m_inverse_inertia_tensor[column * 3 + row][index] = inverse_inertia_tensor[column][row];
+
+				m_bodies.m_position.set(index, transform.m_position);
+				m_bodies.m_momentum.set(index, rigid_body.m_momentum);
+				m_bodies.m_angular_momentum.set(index, rigid_body.m_angular_momentum);
+				m_bodies.m_orientation.set(index, transform.m_orientation);
+				index++;
+			}
+		});
+		m_bodies.resize(index);
+
+		// Every body is integrated independently, each range writes only to its own bodies.
+		m_thread_pool.parallel_for(m_bodies.size(), [this, &p_delta_time](const size_t& p_begin, const size_t& p_end)
+		{
+			Geometry::integrate(m_bodies, p_delta_time.count(), m_integration_mode, p_begin, p_end);
+		}, 256);
+
+		index = 0;
+		m_fast_bodies.clear();
+		const float CCD_velocity_squared = m_CCD_velocity * m_CCD_velocity;
+		scene.foreach_archetype<Component::RigidBody, Component::Transform>([this, &index, &CCD_velocity_squared](const ECS::Storage::ArchetypeView& p_archetype)
 		{
-			if (rigid_body.m_apply_gravity)
-				rigid_body.m_force += rigid_body.m_mass * m_gravity; // F = ma
+			if (p_archetype.has_components<Component::Sleeping>())
+				return;
 
-			{ // Linear motion
-				// Change in momentum is equal to the force = dp/dt = F
-				const auto change_in_momentum = rigid_body.m_force * p_delta_time.count(); // dp = F dt
-				rigid_body.m_momentum += change_in_momentum;
+			const auto rigid_bodies = p_archetype.get_components<Component::RigidBody>();
+			const auto transforms   = p_archetype.get_components<Component::Transform>();
+			for (size_t i = 0; i < p_archetype.size(); i++)
+			{
+				auto& rigid_body = rigid_bodies[i];
+				auto& transform  = transforms[i];
+				if (rigid_body.m_asleep || rigid_body.m_type == Component::RigidBody::Type::Static)
+					continue;
 
-				// Convert momentum to velocity by dividing by mass: p = mv
-				rigid_body.m_velocity = rigid_body.m_momentum / rigid_body.m_mass; // v = p/v
+				// Kinematic bodies aren't stopped by contacts so aren't swept.
+				const auto velocity = m_bodies.m_velocity.get(index);
+				if (m_continuous_collision && rigid_body.m_type == Component::RigidBody::Type::Dynamic && glm::dot(velocity, velocity) > CCD_velocity_squared)
+					m_fast_bodies.emplace_back(p_archetype.get_entity(i), transform.m_position);
 
-				// Integrate velocity to find new position: dx/dt = v
-				const auto change_in_position = rigid_body.m_velocity * p_delta_time.count(); // dx = v dt
-				transform.m_position += change_in_position;
+				rigid_body.m_force            = glm::vec3(0.f); // Reset back to 0 after applying the force and torque on the body.
+				rigid_body.m_torque           = glm::vec3(0.f);
+				rigid_body.m_momentum         = m_bodies.m_momentum.get(index);
+				rigid_body.m_velocity         = velocity;
+				rigid_body.m_angular_momentum = m_bodies.m_angular_momentum.get(index);
+				rigid_body.m_angular_velocity = m_bodies.m_angular_velocity.get(index);
 
-				rigid_body.m_force = glm::vec3(0.f); // Reset back to 0 after applying the force on the body.
+				transform.m_position    = m_bodies.m_position.get(index);
+				transform.m_orientation = m_bodies.m_orientation.get(index);
+				transform.m_direction   = m_bodies.m_direction.get(index);
+				transform.mark_dirty(); // The model and world AABB are rebuilt by m_collision_system.update.
+				index++;
 			}
+		});
+	}
+
+	void PhysicsSystem::sweep_fast_bodies()
+	{
+		// The Collider world AABBs and the AABB tree are still from the start of the tick. Other bodies are tested where they are
+		// after integrating, fast bodies hitting each other are stopped against the other's final position.
+		auto& scene = m_scene.m_entities;
+		for (const auto& [entity, start_position] : m_fast_bodies)
+		{
+			if (!has_collision_shapes(scene, entity))
+				continue;
+
+			auto& transform        = scene.get_component<Component::Transform>(entity);
+			const auto translation = transform.m_position - start_position;
+			const auto& start_AABB = scene.get_component<Component::Collider>(entity).m_world_AABB;
+			const auto swept_AABB  = Geometry::AABB(glm::min(start_AABB.m_min, start_AABB.m_min + translation), glm::max(start_AABB.m_max, start_AABB.m_max + translation));
+
+			// Only colliders the narrow phase would respond to can stop the body, Colliders without a RigidBody are static targets.
+			float time_of_impact = 1.f;
+			auto sweep_against = [&](const Geometry::ConvexShape& p_other_shape)
+			{
+				foreach_world_shape(scene, entity, [&](const Geometry::ConvexShape& p_shape)
+				{
+					const auto start_shape = Geometry::ConvexShape{p_shape.m_shape, p_shape.m_linear, p_shape.m_translation - translation};
+					if (const auto time = Geometry::time_of_impact(start_shape, translation, p_other_shape))
+						time_of_impact = std::min(time_of_impact, *time);
+				});
+			};
+			for (const auto& other : m_collision_system.get_entities_in(swept_AABB))
+			{
+				if (other == entity || !get_collision_mesh(scene, other) || !layers_collide(scene, entity, other))
+					continue;
+
+				foreach_world_shape(scene, other, sweep_against);
+			}
+			scene.foreach([&](Component::Terrain& terrain)
+			{
+				const auto terrain_space_AABB = Geometry::AABB(swept_AABB.m_min - terrain.m_position, swept_AABB.m_max - terrain.m_position);
+				terrain.m_heightfield.query(terrain_space_AABB, [&](const Geometry::Triangle& p_triangle)
+				{
+					const auto triangle_shape = Geometry::Shape(p_triangle);
+					sweep_against(Geometry::ConvexShape{triangle_shape, glm::mat3(1.f), terrain.m_position});
+				});
+			});
+
+			if (time_of_impact < 1.f)
+				transform.m_position = start_position + translation * time_of_impact;
+		}
+	}
+
+	void PhysicsSystem::narrow_phase()
+	{
+		auto& scene       = m_scene.m_entities;
+		const auto& pairs = m_collision_system.get_candidate_pairs();
+
+		// A Terrain has no Collider so isn't in the broadphase. The awake bodies overlapping its world AABB are tested against its heightfield.
+		m_terrain_pairs.clear();
+		scene.foreach([&](ECS::Entity& terrain_entity, Component::Terrain& terrain)
+		{
+			if (terrain.m_heightfield.empty())
+				return;
+
+			const auto AABB = terrain.m_heightfield.get_bound();
+			for (const auto& entity : m_collision_system.get_entities_in(Geometry::AABB(AABB.m_min + terrain.m_position, AABB.m_max + terrain.m_position)))
+			{
+				if (is_dynamic(scene, entity) && !scene.get_component<Component::RigidBody>(entity).m_asleep && has_collision_shapes(scene, entity))
+					m_terrain_pairs.emplace_back(entity, terrain_entity);
+			}
+		});
+
+		// Each pair is tested independently and writes its result to its own slot, the scene is only read.
+		// The terrain pairs follow the candidate pairs.
+		m_pair_contacts.resize(pairs.size() + m_terrain_pairs.size());
+		m_thread_pool.parallel_for(m_pair_contacts.size(), [&](const size_t& p_begin, const size_t& p_end)
+		{
+			for (size_t i = p_begin; i < p_end; i++)
+			{
+				if (i >= pairs.size())
+				{
+					const auto& [entity, terrain_entity] = m_terrain_pairs[i - pairs.size()];
+					const auto& terrain = scene.get_component<Component::Terrain>(terrain_entity);
+
+					Geometry::ContactManifold manifold;
+					add_triangle_contacts(scene, entity, terrain.m_heightfield, glm::mat3(1.f), terrain.m_position, manifold);
+					m_pair_contacts[i] = manifold.m_count > 0 ? std::optional(manifold) : std::nullopt;
+					continue;
+				}
+
+				const auto& [entity_1, entity_2] = pairs[i];
+				// The broadphase already skipped pairs without a dynamic body. Colliders without a RigidBody are static like Terrain.
+				// Pairs of resting bodies are skipped.
+				if (!(is_resting(scene, entity_1) && is_resting(scene, entity_2)))
+					m_pair_contacts[i] = get_contact_manifold(scene, entity_1, entity_2);
+				else
+					m_pair_contacts[i] = std::nullopt;
+			}
+		});
+
+		// Compact in pair order so the contacts are in the same order regardless of the number of threads.
+		m_contacts.clear();
+		for (size_t i = 0; i < pairs.size(); i++)
+		{
+			if (m_pair_contacts[i])
+				m_contacts.push_back({pairs[i].first, pairs[i].second, *m_pair_contacts[i]});
+		}
+		for (size_t i = 0; i < m_terrain_pairs.size(); i++)
+		{
+			if (const auto& manifold = m_pair_contacts[pairs.size() + i])
+				m_contacts.push_back({m_terrain_pairs[i].first, m_terrain_pairs[i].second, *manifold});
+		}
+
+		// A contact with an awake body wakes the sleeping island before the response is applied.
+		for (const auto& contact : m_contacts)
+		{
+			for (const auto& entity : {contact.m_entity_1, contact.m_entity_2})
+				if (scene.has_components<Component::RigidBody>(entity) && scene.get_component<Component::RigidBody>(entity).m_asleep)
+					wake_island(entity);
+		}
+		remove_sleeping_tags();
+	}
+
+	void PhysicsSystem::update_contact_pairs()
+	{
+		m_contact_event_batch.clear();
+		for (const auto& contact : m_contacts)
+		{
+			const auto [pair, inserted] = m_contact_pairs.try_emplace(get_pair_key(contact.m_entity_1, contact.m_entity_2), contact, m_update_count);
+			if (!inserted)
+				pair->second = {contact, m_update_count};
+			m_contact_event_batch.push_back({inserted ? ContactEvent::Type::Begin : ContactEvent::Type::Persist, contact});
+		}
 
-			{ // Angular motion
-				// http://physics.bu.edu/~redner/211-sp06/class-rigid-body/angularmo.html
-				const auto change_in_angular_momentum = rigid_body.m_torque * p_delta_time.count(); // dL = T dt
-				rigid_body.m_angular_momentum += change_in_angular_momentum;
+		// Pairs the narrow phase didn't find this tick have ended, unless both bodies are asleep and the narrow phase skipped the pair.
+		// A pair with a deleted Entity always ends, is_resting would count the deleted Entity as resting and keep the pair forever.
+		auto& scene = m_scene.m_entities;
+		const auto first_end = m_contact_event_batch.size();
+		std::erase_if(m_contact_pairs, [&](const auto& p_pair)
+		{
+			const auto& [contact, last_update] = p_pair.second;
+			const bool removed = !is_collidable(scene, contact.m_entity_1) || !is_collidable(scene, contact.m_entity_2);
+			if (!removed && (last_update == m_update_count || (is_resting(scene, contact.m_entity_1) && is_resting(scene, contact.m_entity_2))))
+				return false;
 
-				// Convert angular momentum to angular velocity by dividing by inertia tensor: L = Iω
-				rigid_body.m_angular_velocity = rigid_body.m_angular_momentum / rigid_body.m_inertia_tensor; // ω = L / I
+			m_contact_event_batch.push_back({ContactEvent::Type::End, contact});
+			return true;
+		});
 
-				// To integrate the new quat orientation we convert the angular velocity into quaternion form - spin.
-				// Spin represents a time derivative of orientation. https://www.cs.cmu.edu/~baraff/sigcourse/notesd1.pdf
-				const glm::quat spin = 0.5f * glm::quat(0.f, (rigid_body.m_angular_velocity * p_delta_time.count())) * transform.m_orientation;
+		// The map order is arbitrary, sort the End events by pair so the events are the same every run.
+		std::sort(m_contact_event_batch.begin() + first_end, m_contact_event_batch.end(), [](const ContactEvent& p_a, const ContactEvent& p_b)
+		{
+			return get_pair_key(p_a.m_contact.m_entity_1, p_a.m_contact.m_entity_2) < get_pair_key(p_b.m_contact.m_entity_1, p_b.m_contact.m_entity_2);
+		});
+	}
+
+	void PhysicsSystem::resolve_contacts(const DeltaTime& p_delta_time)
+	{
+		// Gather every body in contact once, caching its inverse mass and inertia for all of its contacts.
+		// The contact data is entity_1-centric, the pair is keyed by both EntityIDs for warm starting the next tick.
+		auto& scene = m_scene.m_entities;
+		m_solver_bodies.clear();
+		m_solver_entities.clear();
+		auto get_solver_body = [&](const ECS::EntityID& p_entity)
+		{
+			if (p_entity >= m_solver_body_of.size())
+				m_solver_body_of.resize(p_entity + 1, std::numeric_limits<size_t>::max());
 
-				// Integrate spin to find the new orientation
-				transform.m_orientation += spin;
-				transform.m_orientation = glm::normalize(transform.m_orientation);
-				// Recalculate the direction and rotation mat
-				transform.m_direction = glm::normalize(transform.m_orientation * Component::Transform::Starting_Forward_Direction);
-				transform.m_roll_pitch_yaw = glm::degrees(Utility::to_roll_pitch_yaw(transform.m_orientation));
+			auto& index = m_solver_body_of[p_entity];
+			if (index == std::numeric_limits<size_t>::max())
+			{
+				index = m_solver_bodies.size();
+				if (is_dynamic(scene, p_entity))
+				{
+					const auto& rigid_body = scene.get_component<Component::RigidBody>(p_entity);
+					const auto& transform  = scene.get_component<Component::Transform>(p_entity);
+					m_solver_bodies.push_back({transform.m_position, rigid_body.m_velocity, rigid_body.m_angular_velocity, to_world_space(glm::inverse(rigid_body.m_inertia_tensor), transform), 1.f / rigid_body.m_mass});
+				}
+				else if (scene.has_components<Component::RigidBody>(p_entity) && scene.get_component<Component::RigidBody>(p_entity).m_type == Component::RigidBody::Type::Kinematic)
+				{ // Zero inverse mass and inertia like a static body, its velocity still pushes the other body.
+					const auto& rigid_body = scene.get_component<Component::RigidBody>(p_entity);
+					const auto& transform  = scene.get_component<Component::Transform>(p_entity);
+					m_solver_bodies.push_back({transform.m_position, rigid_body.m_velocity, rigid_body.m_angular_velocity, glm::mat3(0.f), 0.f});
+				}
+				else // Static (Terrain or a static RigidBody), zero inverse mass and inertia so the impulses only move the other body.
+					m_solver_bodies.push_back({glm::vec3(0.f), glm::vec3(0.f), glm::vec3(0.f), glm::mat3(0.f), 0.f});
+				m_solver_entities.push_back(p_entity);
 			}
+			return index;
+		};
+		for (const auto& [entity_1, entity_2, manifold] : m_contacts)
+			m_contact_solver.add_contact(get_pair_key(entity_1, entity_2), get_solver_body(entity_1), get_solver_body(entity_2), manifold);
 
-			const auto rotationMatrix = glm::mat4_cast(transform.m_orientation);
+		m_contact_solver.solve(m_solver_bodies, p_delta_time.count());
 
-			transform.m_model = glm::translate(glm::identity<glm::mat4>(), transform.m_position);
-			transform.m_model *= rotationMatrix;
-			transform.m_model = glm::scale(transform.m_model, transform.m_scale);
+		// The integrator steps from momentum so the solved velocities are scattered back as momentum too.
+		for (size_t i = 0; i < m_solver_bodies.size(); i++)
+		{
+			m_solver_body_of[m_solver_entities[i]] = std::numeric_limits<size_t>::max();
+			if (!is_dynamic(scene, m_solver_entities[i]))
+				continue;
 
-			// After moving and updating the Collider, check for collisions and respond
+			auto& rigid_body      = scene.get_component<Component::RigidBody>(m_solver_entities[i]);
+			const auto& transform = scene.get_component<Component::Transform>(m_solver_entities[i]);
+			rigid_body.m_velocity         = m_solver_bodies[i].m_velocity;
+			rigid_body.m_angular_velocity = m_solver_bodies[i].m_angular_velocity;
+			rigid_body.m_momentum         = rigid_body.m_velocity * rigid_body.m_mass;
+			rigid_body.m_angular_momentum = to_world_space(rigid_body.m_inertia_tensor, transform) * rigid_body.m_angular_velocity; // L = R I Rᵀ ω
+		}
+	}
 
-			ECS::Entity collided_entity = ECS::Entity(0);
-			if (auto collision = m_collision_system.get_collision(entity, &collided_entity))
+	void PhysicsSystem::update_sleeping(const DeltaTime& p_delta_time)
+	{
+		auto& scene = m_scene.m_entities;
+		if (!m_allow_sleeping)
+		{
+			if (!m_sleeping_island_of.empty())
 			{
-				if (m_apply_collision_response)
+				scene.foreach([this](ECS::Entity& entity, Component::RigidBody& rigid_body, Component::Sleeping&)
 				{
-					// A collision has occurred at the new position, the response depends on the collided entity having a rigibBody to apply a response to.
-					// We already know the collided Entity has a Transform component from CollisionSystem::getCollision so we dont have to check it here.
-					// The collision data returned is original-Entity-centric this convention is carried over in the response here when calling angular_impulse.
-					if (scene.has_components<Component::RigidBody>(collided_entity))
-					{
-						auto& rigid_body_2 = m_scene_system.get_current_scene().get_component<Component::RigidBody>(collided_entity);
-						auto& transform_2  = m_scene_system.get_current_scene().get_component<Component::Transform>(collided_entity);
-
-						auto impulse = Geometry::angular_impulse(collision->position, collision->normal, m_restitution,
-																transform.m_position, rigid_body.m_velocity, rigid_body.m_angular_velocity, rigid_body.m_mass, rigid_body.m_inertia_tensor,
-																transform_2.m_position, rigid_body_2.m_velocity, rigid_body_2.m_angular_velocity, rigid_body_2.m_mass, rigid_body_2.m_inertia_tensor);
-
-						const auto r             = collision->position - transform.m_position;
-						const auto inverseTensor = glm::inverse(rigid_body.m_inertia_tensor);
-
-						rigid_body.m_velocity        = rigid_body.m_velocity + (impulse / rigid_body.m_mass);
-						rigid_body.m_angular_velocity = rigid_body.m_angular_velocity + (glm::cross(r, impulse) * inverseTensor);
-
-						// #TODO: Apply a response to collision.mEntity
-					}
+					rigid_body.wake();
+					m_woken_bodies.push_back(entity);
+				});
+				remove_sleeping_tags();
+				m_sleeping_islands.clear();
+				m_sleeping_island_of.clear();
+			}
+			return;
+		}
+
+		const float linear_threshold_squared  = m_sleep_linear_velocity * m_sleep_linear_velocity;
+		const float angular_threshold_squared = m_sleep_angular_velocity * m_sleep_angular_velocity;
+
+		// Every per body array below is indexed by body slot, the index of the body in m_awake_bodies this tick. The arrays are reset in place
+		// so no memory is allocated once they have grown to the most bodies awake at once. m_body_slot_of is cleared for last tick's bodies only.
+		for (const auto& entity : m_awake_bodies)
+			m_body_slot_of[entity] = std::numeric_limits<size_t>::max();
+		m_awake_bodies.clear();
+		m_awake_rigid_bodies.clear();
+
+		// Bodies in islands that are already asleep are skipped an archetype at a time, they only rejoin when their island wakes.
+		scene.foreach_archetype<Component::RigidBody>([&](const ECS::Storage::ArchetypeView& p_archetype)
+		{
+			if (p_archetype.has_components<Component::Sleeping>())
+				return;
+
+			const auto rigid_bodies = p_archetype.get_components<Component::RigidBody>();
+			for (size_t i = 0; i < p_archetype.size(); i++)
+			{
+				auto& rigid_body   = rigid_bodies[i];
+				const auto& entity = p_archetype.get_entity(i);
+				if (rigid_body.m_asleep)
+				{ // Put to sleep outside the PhysicsSystem e.g. from the editor, it sleeps as an island of its own.
+					m_sleeping_island_of[entity] = m_sleeping_islands.size();
+					m_sleeping_islands.push_back({entity});
+					m_fallen_asleep_bodies.push_back(entity);
+					continue;
 				}
+				if (rigid_body.m_type != Component::RigidBody::Type::Dynamic)
+					continue;
+
+				if (glm::dot(rigid_body.m_velocity, rigid_body.m_velocity) <= linear_threshold_squared
+				 && glm::dot(rigid_body.m_angular_velocity, rigid_body.m_angular_velocity) <= angular_threshold_squared)
+					rigid_body.m_sleep_timer += p_delta_time.count();
+				else
+					rigid_body.m_sleep_timer = 0.f;
+
+				if (entity.ID >= m_body_slot_of.size())
+					m_body_slot_of.resize(entity.ID + 1, std::numeric_limits<size_t>::max());
+				m_body_slot_of[entity.ID] = m_awake_bodies.size();
+				m_awake_bodies.push_back(entity);
+				m_awake_rigid_bodies.push_back(&rigid_body);
 			}
 		});
+		if (m_awake_bodies.empty())
+		{
+			add_sleeping_tags();
+			return;
+		}
+
+		// Join the bodies in contact into islands with a union-find over the body slots.
+		const size_t body_count = m_awake_bodies.size();
+		m_island_parent.resize(body_count);
+		for (size_t slot = 0; slot < body_count; slot++)
+			m_island_parent[slot] = slot;
+
+		auto find_root = [this](size_t p_slot)
+		{
+			while (m_island_parent[p_slot] != p_slot)
+			{
+				m_island_parent[p_slot] = m_island_parent[m_island_parent[p_slot]]; // Path halving
+				p_slot                  = m_island_parent[p_slot];
+			}
+			return p_slot;
+		};
+		auto get_slot = [this](const ECS::EntityID& p_entity)
+		{
+			return p_entity < m_body_slot_of.size() ? m_body_slot_of[p_entity] : std::numeric_limits<size_t>::max();
+		};
+		// Only awake dynamic bodies have a slot. Static and kinematic bodies and Terrain don't join islands, bodies resting on the same floor
+		// sleep independently.
+		for (const auto& contact : m_contacts)
+		{
+			const auto slot_1 = get_slot(contact.m_entity_1);
+			const auto slot_2 = get_slot(contact.m_entity_2);
+			if (slot_1 != std::numeric_limits<size_t>::max() && slot_2 != std::numeric_limits<size_t>::max())
+				m_island_parent[find_root(slot_1)] = find_root(slot_2);
+		}
+
+		// An island can sleep if every one of its bodies has been slow for m_time_to_sleep, track the shortest sleep timer per root.
+		m_island_sleep_timer.assign(body_count, std::numeric_limits<float>::max());
+		for (size_t slot = 0; slot < body_count; slot++)
+		{
+			auto& timer = m_island_sleep_timer[find_root(slot)];
+			timer       = std::min(timer, m_awake_rigid_bodies[slot]->m_sleep_timer);
+		}
+
+		m_island_index.assign(body_count, std::numeric_limits<size_t>::max()); // Index into m_sleeping_islands per root.
+		for (size_t slot = 0; slot < body_count; slot++)
+		{
+			const auto root = find_root(slot);
+			if (m_island_sleep_timer[root] < m_time_to_sleep.count())
+				continue;
+
+			auto& island = m_island_index[root];
+			if (island == std::numeric_limits<size_t>::max())
+			{
+				island = m_sleeping_islands.size();
+				m_sleeping_islands.emplace_back();
+			}
+			const auto& entity = m_awake_bodies[slot];
+			m_sleeping_islands[island].push_back(entity);
+			m_sleeping_island_of[entity] = island;
+			m_fallen_asleep_bodies.push_back(entity);
+
+			auto& rigid_body              = *m_awake_rigid_bodies[slot];
+			rigid_body.m_asleep           = true;
+			rigid_body.m_momentum         = glm::vec3(0.f);
+			rigid_body.m_velocity         = glm::vec3(0.f);
+			rigid_body.m_angular_momentum = glm::vec3(0.f);
+			rigid_body.m_angular_velocity = glm::vec3(0.f);
+		}
+		add_sleeping_tags();
+	}
+
+	void PhysicsSystem::wake_island(const ECS::EntityID& p_entity)
+	{
+		auto& scene = m_scene.m_entities;
+		const auto island = m_sleeping_island_of.find(p_entity);
+		if (island == m_sleeping_island_of.end())
+		{ // Put to sleep outside the PhysicsSystem e.g. from the editor, update_sleeping hasn't made it an island yet.
+			scene.get_component<Component::RigidBody>(p_entity).wake();
+			return;
+		}
+
+		auto& bodies = m_sleeping_islands[island->second];
+		for (const auto& entity : bodies)
+		{
+			if (scene.has_components<Component::RigidBody>(entity)) // Bodies can be deleted while asleep.
+				scene.get_component<Component::RigidBody>(entity).wake();
+			m_sleeping_island_of.erase(entity);
+			m_woken_bodies.push_back(entity);
+		}
+		bodies.clear();
+
+		if (m_sleeping_island_of.empty())
+			m_sleeping_islands.clear();
+	}
+
+	void PhysicsSystem::add_sleeping_tags()
+	{
+		auto& scene = m_scene.m_entities;
+		for (const auto& entity : m_fallen_asleep_bodies)
+		{
+			if (scene.has_components<Component::Transform>(entity))
+				scene.get_component<Component::Transform>(entity).store_previous_state(); // Not stored again until the body wakes.
+			scene.add_component(entity, Component::Sleeping{});
+		}
+		m_fallen_asleep_bodies.clear();
+	}
+	void PhysicsSystem::remove_sleeping_tags()
+	{
+		for (const auto& entity : m_woken_bodies)
+			m_scene.m_entities.delete_component<Component::Sleeping>(entity);
+		m_woken_bodies.clear();
 	}
-} // namespace System
\ No newline at end of file
+} // namespace System
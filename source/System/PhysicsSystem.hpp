@@ -1,30 +1,183 @@
 #pragma once
 
+#include "ECS/Storage.hpp"
+#include "Geometry/ContactSolver.hpp"
+#include "Geometry/GJK.hpp"
+#include "Geometry/Intersect.hpp"
+#include "Geometry/RigidBodyIntegrator.hpp"
+#include "System/PhysicsRecording.hpp"
+#include "Utility/Config.hpp"
+#include "Utility/EventDispatcher.hpp"
+#include "Utility/ThreadPool.hpp"
+
 #include "glm/vec3.hpp"
 
-#include "Utility/Config.hpp"
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+namespace Component
+{
+	class RigidBody;
+}
 namespace System
 {
-	class SceneSystem;
+	class Scene;
 	class CollisionSystem;
 
+	// A contact between two Entities found by the narrow phase. m_manifold is from the perspective of m_entity_1.
+	// Contacts with a Component::Terrain have the body as m_entity_1 and the Terrain as m_entity_2.
+	struct Contact
+	{
+		ECS::EntityID m_entity_1;
+		ECS::EntityID m_entity_2;
+		Geometry::ContactManifold m_manifold;
+	};
+	// A change in the contact between two Entities. PhysicsSystem::m_contact_events delivers the events of a tick together.
+	struct ContactEvent
+	{
+		enum class Type : uint8_t
+		{
+			Begin,   // The Entities started touching this tick.
+			Persist, // The Entities touched last tick and still do.
+			End      // The Entities stopped touching this tick, m_contact is the last contact found between them.
+		};
+
+		Type m_type;
+		Contact m_contact;
+	};
+
 	// A numerical integrator, PhysicsSystem take Transform and RigidBody components and applies kinematic equations.
 	// The system is force based and numerically integrates
+	// Each tick runs in stages: integration, continuous collision, world AABB update, broadphase, narrow phase then collision response.
+	// The narrow phase finds contact manifolds between the Data::CollisionMesh::collision_shapes of each candidate pair using GJK/EPA.
+	// A mesh without collision shapes collides using the triangles of its Data::CollisionMesh::triangle_BVH near the other body, meshes with neither
+	// collide using their world AABB. Bodies collide with the triangles of the Component::Terrain::m_heightfield under them, the Terrain is static.
+	// The contacts are resolved together by m_contact_solver.
+	// Only dynamic RigidBodies respond to forces and contacts. Static bodies never move and kinematic bodies move with their momentum,
+	// both push dynamic bodies like infinite mass. Collider layers and masks and body types filter the candidate pairs in the broadphase.
+	// Integration gathers the bodies into m_bodies and integrates them in SIMD batches before scattering the results back to the components.
+	// Bodies faster than m_CCD_velocity are swept from their position at the start of the tick against the colliders in their path and
+	// stopped at the first time of impact, the narrow phase then finds the contact the same tick. This lets thin colliders stop fast bodies
+	// at low m_physics_ticks_per_second. The sweep is linear, rotation over the tick is ignored.
+	// The integration, world AABB and narrow phase stages run in parallel on m_thread_pool. Every stage outputs in a fixed order
+	// so the simulation is the same regardless of the number of threads.
+	// Bodies in contact form islands. When every body in an island has moved slower than the sleep velocities for m_time_to_sleep,
+	// the island is put to sleep and skipped by integration and the narrow phase until a force or a contact with an awake body wakes it.
+	// Sleeping bodies are tagged with Component::Sleeping so the per tick loops and the broadphase skip them by archetype.
+	// The ticks can be recorded to a PhysicsRecording and replayed later to re-simulate the same workload with per-stage timings.
 	class PhysicsSystem
 	{
 	public:
-		PhysicsSystem(SceneSystem& scene_system, CollisionSystem& collision_system);
+		// Time spent in each stage of an integrate.
+		struct StageTimings
+		{
+			using Duration = std::chrono::duration<float, std::milli>;
+
+			Duration m_integration;
+			Duration m_continuous_collision;
+			Duration m_broadphase; // World AABB update and broadphase.
+			Duration m_narrow_phase;
+			Duration m_collision_response;
+			Duration m_sleeping;   // Waking bodies and putting islands to sleep.
+		};
+		struct ReplayReport
+		{
+			std::vector<StageTimings> m_tick_timings; // Per tick of the recording.
+			std::vector<uint64_t> m_checksums;        // PhysicsRecording::get_checksum after each tick.
+			std::optional<size_t> m_first_mismatch;   // The first tick whose checksum differs from the recording.
+		};
+
+		PhysicsSystem(Scene& scene, CollisionSystem& collision_system);
 		void integrate(const DeltaTime& delta_time);
+		// The contacts found in the last integrate in candidate pair order.
+		const std::vector<Contact>& get_contacts() const { return m_contacts; }
+		// The contact between p_entity_1 and p_entity_2 as of the last integrate or nullptr if they aren't touching.
+		// The manifold is from the perspective of the lower EntityID or the body for contacts with a Terrain.
+		// Sleeping bodies keep the contacts they fell asleep with.
+		const Contact* find_contact(const ECS::EntityID& p_entity_1, const ECS::EntityID& p_entity_2) const;
+		const StageTimings& get_stage_timings() const { return m_stage_timings; }
+
+		// Forget the state carried between ticks (warm starting impulses, sleeping islands, broadphase structures) and wake every body.
+		// The next tick depends on the components alone, two runs from the same components after a reset are identical.
+		void reset();
+		// Reset and record the state of every body and the forces applied before each tick from now until stop_recording.
+		void start_recording();
+		//@return The ticks recorded since start_recording.
+		PhysicsRecording stop_recording();
+		bool is_recording() const { return m_recording.has_value(); }
+		// Restore the bodies to the start of p_recording then re-simulate every tick with its recorded forces.
+		// Runs the ticks back to back without rendering, the scene must be the one p_recording was recorded in.
+		ReplayReport replay(const PhysicsRecording& p_recording);
 
 		size_t m_update_count;
-		float m_restitution;             // Coefficient of restitution applied in collision response.
-		bool m_apply_collision_response; // Whether to apply collision response or not.
+		bool m_apply_collision_response;     // Whether to apply collision response or not.
+		Geometry::ContactSolver m_contact_solver; // Collision response settings: iterations, restitution, friction and warm starting.
+		Geometry::IntegrationMode m_integration_mode; // SIMD by default, Scalar is the bit-for-bit identical reference.
+		// Dispatched at the end of every integrate with a contact changing, Begin and Persist events in candidate pair order then End events.
+		Utility::EventDispatcher<const std::vector<ContactEvent>&> m_contact_events;
+
+		bool m_allow_sleeping;
+		float m_sleep_linear_velocity;  // Bodies slower than this can sleep (m/s)
+		float m_sleep_angular_velocity; // Bodies rotating slower than this can sleep (rad/s)
+		DeltaTime m_time_to_sleep;      // Time every body in an island must stay below the sleep velocities before the island sleeps.
+
+		bool m_continuous_collision; // Sweep bodies faster than m_CCD_velocity so they can't pass through thin colliders between ticks.
+		float m_CCD_velocity;        // Bodies faster than this are swept (m/s)
 	private:
-		SceneSystem& m_scene_system;
+		Scene& m_scene;
 		CollisionSystem& m_collision_system;
 
 		DeltaTime m_total_simulation_time; // Total time simulated using the integrate function.
 		glm::vec3 m_gravity;               // The acceleration due to gravity.
+
+		Utility::ThreadPool m_thread_pool;
+		Geometry::RigidBodyBatch m_bodies; // Every RigidBody gathered for the integration stage.
+		std::vector<std::optional<Geometry::ContactManifold>> m_pair_contacts; // Narrow phase output per candidate pair then terrain pair, written in parallel.
+		std::vector<std::pair<ECS::EntityID, ECS::EntityID>> m_terrain_pairs; // Awake bodies overlapping the world AABB of a Terrain (body, Terrain).
+		std::vector<Contact> m_contacts;
+		// Every pair of Entities in contact keyed by get_pair_key with the last tick (m_update_count) the narrow phase found the contact.
+		// Tracks the pairs across ticks to find the Begin and End events.
+		std::unordered_map<uint64_t, std::pair<Contact, size_t>> m_contact_pairs;
+		std::vector<ContactEvent> m_contact_event_batch; // The events of the current tick.
+		std::vector<Geometry::SolverBody> m_solver_bodies; // The bodies in contact gathered for m_contact_solver.
+		std::vector<ECS::EntityID> m_solver_entities;      // The Entity of each m_solver_bodies element.
+		std::vector<size_t> m_solver_body_of;              // Index into m_solver_bodies per EntityID while resolving contacts.
+
+		// Islands put to sleep together, woken as a whole when any of their bodies wakes. Woken islands are left empty until all are awake.
+		std::vector<std::vector<ECS::EntityID>> m_sleeping_islands;
+		std::unordered_map<ECS::EntityID, size_t> m_sleeping_island_of; // Index into m_sleeping_islands per sleeping body.
+		// The awake dynamic bodies of the last update_sleeping, a body's index in these is its body slot. The island arrays are indexed by slot.
+		std::vector<ECS::EntityID> m_awake_bodies;
+		std::vector<Component::RigidBody*> m_awake_rigid_bodies; // Only valid during update_sleeping.
+		std::vector<size_t> m_body_slot_of;                      // Body slot per EntityID, size_t max for bodies not awake.
+		std::vector<size_t> m_island_parent;                     // Union-find forest over the body slots.
+		std::vector<float> m_island_sleep_timer;                 // The shortest sleep timer of the bodies in each island, per root slot.
+		std::vector<size_t> m_island_index;                      // Index into m_sleeping_islands per root slot of an island put to sleep.
+		std::vector<std::pair<ECS::EntityID, glm::vec3>> m_fast_bodies; // Bodies faster than m_CCD_velocity and their position before integration.
+		// Bodies put to sleep or woken since their Component::Sleeping tag was last added or removed. Tagging moves an Entity between
+		// archetypes so is deferred until no foreach or component pointers are in use.
+		std::vector<ECS::EntityID> m_fallen_asleep_bodies;
+		std::vector<ECS::EntityID> m_woken_bodies;
+
+		StageTimings m_stage_timings;
+		std::optional<PhysicsRecording> m_recording; // Set between start_recording and stop_recording.
+
+		void wake_bodies();
+		void integrate_bodies(const DeltaTime& p_delta_time);
+		// Move each of m_fast_bodies back along its motion this tick to where it first touches another collider or a Terrain.
+		void sweep_fast_bodies();
+		void narrow_phase();
+		// Update m_contact_pairs from m_contacts and fill m_contact_event_batch.
+		void update_contact_pairs();
+		void resolve_contacts(const DeltaTime& p_delta_time);
+		void update_sleeping(const DeltaTime& p_delta_time);
+		// Wake p_entity and every other body in its sleeping island. Their Component::Sleeping tags are removed by remove_sleeping_tags.
+		void wake_island(const ECS::EntityID& p_entity);
+		void add_sleeping_tags();
+		void remove_sleeping_tags();
 	};
 } // namespace System
\ No newline at end of file
@@ -46,23 +46,25 @@ namespace System
 		return primary_camera;
 	}
 
+	ECS::EntityID SceneSystem::merge_into_scene(ECS::Storage&& p_storage)
+	{
+		const auto entity_ID_offset = get_current_scene().merge(std::move(p_storage));
+		update_scene_bounds();
+		return entity_ID_offset;
+	}
+
 	void SceneSystem::update_scene_bounds()
 	{
 		m_scene.m_bound.m_min = glm::vec3(0.f);
 		m_scene.m_bound.m_max = glm::vec3(0.f);
 
-		get_current_scene().foreach([&scene = m_scene.m_entities, &scene_bounds = m_scene.m_bound](ECS::Entity p_entity, Component::Transform& p_transform, Component::Mesh& p_mesh)
+		// Merged Entities haven't been through a CollisionSystem::update yet so their Collider world AABBs are stale, the bound is taken from
+		// the models instead. The Transforms are left dirty for the next update to build their world AABBs.
+		get_current_scene().foreach([&scene_bounds = m_scene.m_bound](Component::Transform& p_transform, Component::Mesh& p_mesh)
 		{
-			if (scene.has_components<Component::Collider>(p_entity))
-			{
-				auto& collider = scene.get_component<Component::Collider>(p_entity);
-				scene_bounds.unite(collider.m_world_AABB);
-			}
-			else
-			{
-				const auto world_AABB = Geometry::AABB::transform(p_mesh.m_mesh->AABB, p_transform.m_position, glm::mat4_cast(p_transform.m_orientation), p_transform.m_scale);
-				scene_bounds.unite(world_AABB);
-			}
+			if (p_transform.m_dirty)
+				p_transform.update_model();
+			scene_bounds.unite(Geometry::AABB::transform(p_mesh.m_mesh->AABB, p_transform.m_model));
 		});
 	}
 
@@ -87,10 +89,12 @@ namespace System
 		{ // Plane/quad
 			auto transform    = Component::Transform{glm::vec3(0.f, 0.f, 0.f)};
 			transform.m_scale  = glm::vec3(10.f, 1.f, 10.f);
+			Component::RigidBody rigid_body;
+			rigid_body.m_type = Component::RigidBody::Type::Static;
 
 			m_scene.m_entities.add_entity(
 				Component::Label{"Floor"},
-				Component::RigidBody{},
+				rigid_body,
 				Component::Texture{m_texture_system.getTexture(Config::Texture_Directory / "wood_floor.png")},
 				transform,
 				Component::Mesh{m_mesh_system.m_quad},
@@ -199,13 +203,15 @@ namespace System
 				Component::Texture texture;
 				texture.m_diffuse = m_texture_system.getTexture(containerDiffuse);
 				texture.m_specular = m_texture_system.getTexture(containerSpecular);
+				Component::RigidBody rigid_body;
+				rigid_body.m_type = Component::RigidBody::Type::Static;
 
 				m_scene.m_entities.add_entity(
 					Component::Label("Cube " + std::to_string((i / 2) + 1)),
 					Component::Mesh(m_mesh_system.m_cube),
 					Component::Transform{glm::vec3(i, 0.f, 0.f)},
 					Component::Collider{},
-					Component::RigidBody{},
+					rigid_body,
 					texture);
 			}
 		}
@@ -245,6 +251,7 @@ namespace System
 	}
 	void SceneSystem::constructBouncingBallScene()
 	{
+		m_scene.m_broadphase = Scene::Broadphase::SpatialHashGrid;
 		const auto containerDiffuse  = Config::Texture_Directory / "metalContainerDiffuse.png";
 		const auto containerSpecular = Config::Texture_Directory / "metalContainerSpecular.png";
 
@@ -268,7 +275,7 @@ namespace System
 			transform.rotateEulerDegrees(glm::vec3(-90.f, 0.f, 0.f));
 			transform.m_scale = glm::vec3(50.f);
 			Component::RigidBody rigidBody;
-			rigidBody.m_mass = 1.f;
+			rigidBody.m_type = Component::RigidBody::Type::Static;
 			m_scene.m_entities.add_entity(
 				Component::Label("Floor"),
 				Component::Mesh{m_mesh_system.m_plane},
@@ -15,8 +15,17 @@ namespace System
 	class Scene
 	{
 	public:
+		// The broadphase CollisionSystem uses to find the pairs of overlapping Colliders.
+		enum class Broadphase
+		{
+			SweepAndPrune,  // General purpose, suits scenes with bodies of very different sizes.
+			SpatialHashGrid // Suits many bodies of a similar size e.g. particles. Cell size set by m_grid_cell_size.
+		};
+
 		ECS::Storage m_entities;
 		Geometry::AABB m_bound;
+		Broadphase m_broadphase = Broadphase::SweepAndPrune;
+		float m_grid_cell_size  = 2.f; // Ideally a little larger than the typical Collider.
 
 		Component::Camera* get_primary_camera();
 	};
@@ -31,7 +40,11 @@ namespace System
 
 		SceneSystem(TextureSystem& p_texture_system, MeshSystem& p_mesh_system);
 		ECS::Storage& get_current_scene() { return m_scene.m_entities; }
+		// Recompute m_scene.m_bound by visiting every Entity with a Mesh. Each physics tick CollisionSystem::update sets the bound from its AABBTree instead.
 		void update_scene_bounds();
+		// Move all the Entities in p_storage into the current scene. p_storage can be built on a background thread to load a level without stalling the frame.
+		//@return The offset applied to the EntityIDs of p_storage, see ECS::Storage::merge.
+		ECS::EntityID merge_into_scene(ECS::Storage&& p_storage);
 
 	private:
 		void add_default_camera();
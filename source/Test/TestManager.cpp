@@ -1,6 +1,7 @@
 #include "TestManager.hpp"
 #include "ECSTester.hpp"
 #include "GeometryTester.hpp"
+#include "PhysicsTester.hpp"
 #include "ResourceManagerTester.hpp"
 
 #include "Utility/Logger.hpp"
@@ -31,14 +32,19 @@ namespace Test
 		ResourceManagerTester resource_manager_tester;
 		resource_manager_tester.run(pRunPerformanceTests);
 
+		PhysicsTester physics_tester;
+		physics_tester.run(pRunPerformanceTests);
+
 		LOG("All Unit tests complete - Time taken: {}ms\n{}", stopwatch.duration_since_start<float, std::milli>().count(), seperator);
 
 		auto total_passes = ecs_tester.get_test_pass_count() +
 		                    geometry_tester.get_test_pass_count() +
-		                    resource_manager_tester.get_test_pass_count();
+		                    resource_manager_tester.get_test_pass_count() +
+		                    physics_tester.get_test_pass_count();
 		auto total_fails = ecs_tester.get_test_fail_count() +
 		                   geometry_tester.get_test_fail_count() +
-		                   resource_manager_tester.get_test_fail_count();
+		                   resource_manager_tester.get_test_fail_count() +
+		                   physics_tester.get_test_fail_count();
 		return { total_passes, total_fails };
 	}
 
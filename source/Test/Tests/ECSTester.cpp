@@ -3,6 +3,7 @@
 
 #include "ECS/Storage.hpp"
 #include "Utility/Logger.hpp"
+#include "Utility/ThreadPool.hpp"
 
 #include <set>
 #include <algorithm>
@@ -752,6 +753,217 @@ namespace Test
 				}
 			}
 		}
+
+		{SCOPE_SECTION("instantiate");
+			{SCOPE_SECTION("Trivially copyable components");
+				ECS::Storage storage;
+				auto template_entity = storage.add_entity(1.5, 2.f);
+				auto prefab          = storage.make_prefab(template_entity);
+				storage.delete_entity(template_entity);
+
+				CHECK_EQUAL(prefab.get_component<double>(), 1.5, "Prefab double");
+				CHECK_EQUAL(prefab.get_component<float>(), 2.f, "Prefab float");
+
+				auto entities = storage.instantiate(prefab, 100);
+				CHECK_EQUAL(entities.size(), 100, "Returned entity count");
+				CHECK_EQUAL(storage.count_entities(), 100, "Storage entity count");
+
+				double sum_double = 0.0;
+				float sum_float   = 0.0f;
+				storage.foreach([&](double& p_double, float& p_float)
+				{
+					sum_double += p_double;
+					sum_float  += p_float;
+				});
+				CHECK_EQUAL(sum_double, 150.0, "Sum of doubles");
+				CHECK_EQUAL(sum_float, 200.f, "Sum of floats");
+
+				{SCOPE_SECTION("Instances are independent");
+					storage.get_component<double>(entities.front()) = 10.0;
+					CHECK_EQUAL(storage.get_component<double>(entities.back()), 1.5, "Other instance unchanged");
+					CHECK_EQUAL(prefab.get_component<double>(), 1.5, "Prefab unchanged");
+				}
+				{SCOPE_SECTION("Add entity after instantiate");
+					auto entity = storage.add_entity(3.0, 4.f);
+					CHECK_EQUAL(storage.count_entities(), 101, "Storage entity count");
+					CHECK_EQUAL(storage.get_component<double>(entity), 3.0, "New entity double");
+				}
+			}
+			{SCOPE_SECTION("Memory correctness");
+				{
+					MemoryCorrectnessItem::reset();
+					ECS::Storage storage;
+					auto template_entity = storage.add_entity(MemoryCorrectnessItem(), 1.f);
+					auto prefab          = storage.make_prefab(template_entity);
+					run_memory_test(2); // The template entity and the prefab copy
+
+					storage.instantiate(prefab, 50);
+					run_memory_test(52);
+
+					storage.delete_entity(template_entity);
+					run_memory_test(51);
+				}
+				run_memory_test(0); // Storage and prefab destroyed
+			}
+		}
+
+		{SCOPE_SECTION("merge");
+			{SCOPE_SECTION("Trivially copyable components");
+				ECS::Storage storage;
+				auto existing_entity = storage.add_entity(1.0, 2.f);
+
+				ECS::Storage other;
+				std::vector<ECS::Entity> other_entities;
+				for (int i = 0; i < 40; i++)
+					other_entities.push_back(other.add_entity(3.0, 4.f)); // Matches an existing archetype
+				other.delete_entity(other_entities[5]);
+				auto int_entity = other.add_entity(7); // New archetype
+
+				const auto offset = storage.merge(std::move(other));
+				CHECK_EQUAL(offset, 1, "EntityID offset");
+				CHECK_EQUAL(other.count_entities(), 0, "Other empty after merge");
+				CHECK_EQUAL(storage.count_entities(), 41, "Storage entity count");
+				CHECK_EQUAL(storage.get_component<double>(existing_entity), 1.0, "Existing entity unchanged");
+				CHECK_EQUAL(storage.get_component<double>(ECS::Entity(other_entities[0].ID + offset)), 3.0, "Merged entity double");
+				CHECK_EQUAL(storage.get_component<float>(ECS::Entity(other_entities.back().ID + offset)), 4.f, "Merged entity float");
+				CHECK_EQUAL(storage.get_component<int>(ECS::Entity(int_entity.ID + offset)), 7, "Merged entity new archetype");
+				CHECK_TRUE(!storage.has_components<double>(ECS::Entity(other_entities[5].ID + offset)), "Deleted entity stays deleted");
+
+				double sum_double = 0.0;
+				storage.foreach([&](double& p_double) { sum_double += p_double; });
+				CHECK_EQUAL(sum_double, 118.0, "Sum of doubles"); // 1.0 + 39 * 3.0
+
+				{SCOPE_SECTION("Delete after merge");
+					storage.delete_entity(ECS::Entity(other_entities[0].ID + offset));
+					CHECK_EQUAL(storage.count_entities(), 40, "Storage entity count");
+					CHECK_EQUAL(storage.get_component<double>(ECS::Entity(other_entities.back().ID + offset)), 3.0, "Swapped entity double");
+				}
+				{SCOPE_SECTION("Add after merge");
+					auto entity = storage.add_entity(5.0, 6.f);
+					CHECK_EQUAL(entity.ID, 42, "New EntityID continues after merged IDs");
+					CHECK_EQUAL(storage.get_component<double>(entity), 5.0, "New entity double");
+				}
+			}
+			{SCOPE_SECTION("Memory correctness");
+				{
+					MemoryCorrectnessItem::reset();
+					ECS::Storage storage;
+					storage.add_entity(MemoryCorrectnessItem());
+
+					ECS::Storage other;
+					for (int i = 0; i < 50; i++)
+						other.add_entity(MemoryCorrectnessItem());
+					other.add_entity(MemoryCorrectnessItem(), 1.f);
+					run_memory_test(52);
+
+					storage.merge(std::move(other));
+					CHECK_EQUAL(storage.count_entities(), 52, "Storage entity count");
+					run_memory_test(52);
+
+					ECS::Storage empty_storage;
+					empty_storage.merge(std::move(storage));
+					CHECK_EQUAL(empty_storage.count_entities(), 52, "Merge into empty storage");
+					run_memory_test(52);
+				}
+				run_memory_test(0);
+			}
+		}
+
+		{SCOPE_SECTION("foreach_parallel");
+			Utility::ThreadPool thread_pool(4);
+			ECS::Storage storage;
+			std::vector<ECS::Entity> entities;
+			for (int i = 0; i < 1000; i++)
+				entities.push_back(storage.add_entity(double(i), float(i)));
+			for (int i = 0; i < 500; i++)
+				storage.add_entity(double(i), float(i), i);
+
+			{SCOPE_SECTION("Every matching component visited once");
+				storage.foreach_parallel([](double& p_double, float& p_float)
+				{
+					p_double += 1.0;
+					p_float  *= 2.f;
+				}, thread_pool);
+
+				double sum_double = 0.0;
+				float sum_float   = 0.f;
+				storage.foreach([&](double& p_double, float& p_float)
+				{
+					sum_double += p_double;
+					sum_float  += p_float;
+				});
+				// Sum of 0..999 + 0..499 = 624250, each double incremented once and each float doubled once.
+				CHECK_EQUAL(sum_double, 624250.0 + 1500.0, "Sum of doubles");
+				CHECK_EQUAL(sum_float, 624250.f * 2.f, "Sum of floats");
+			}
+			{SCOPE_SECTION("Subset match");
+				std::vector<int> visited(500, 0);
+				storage.foreach_parallel([&visited](int& p_int) { visited[p_int]++; }, thread_pool);
+				CHECK_TRUE(std::all_of(visited.begin(), visited.end(), [](const int& p_count) { return p_count == 1; }), "Each int visited once");
+			}
+			{SCOPE_SECTION("Entity argument");
+				std::vector<int> visited(entities.size(), 0);
+				storage.foreach_parallel([&](ECS::Entity& p_entity, float& p_float)
+				{
+					if (!storage.has_components<int>(p_entity))
+						visited[static_cast<size_t>(p_float / 2.f)]++;
+				}, thread_pool);
+				CHECK_TRUE(std::all_of(visited.begin(), visited.end(), [](const int& p_count) { return p_count == 1; }), "Each entity visited once");
+			}
+		}
+		{SCOPE_SECTION("foreach_archetype");
+			ECS::Storage storage;
+
+			{SCOPE_SECTION("Iterate empty");
+				size_t archetype_count = 0;
+				storage.foreach_archetype<double>([&](const ECS::Storage::ArchetypeView&) { archetype_count++; });
+				CHECK_EQUAL(archetype_count, 0, "Archetype count");
+			}
+
+			std::vector<ECS::Entity> entities;
+			for (int i = 0; i < 10; i++)
+				entities.push_back(storage.add_entity(double(i), float(i)));
+			for (int i = 10; i < 15; i++)
+				entities.push_back(storage.add_entity(double(i), float(i), i));
+			storage.add_entity(1.5f); // No double, not visited.
+
+			{SCOPE_SECTION("Subset match");
+				size_t archetype_count = 0;
+				size_t instance_count  = 0;
+				size_t int_count       = 0;
+				storage.foreach_archetype<double, float>([&](const ECS::Storage::ArchetypeView& p_archetype)
+				{
+					archetype_count++;
+					const bool has_int = p_archetype.has_components<int>();
+					const auto doubles = p_archetype.get_components<double>();
+					const auto floats  = p_archetype.get_components<float>();
+					for (size_t i = 0; i < p_archetype.size(); i++)
+					{
+						CHECK_EQUAL(storage.get_component<double>(p_archetype.get_entity(i)), doubles[i], "Column matches get_component");
+						CHECK_EQUAL(float(doubles[i]), floats[i], "Components of the same instance");
+						if (has_int)
+						{
+							CHECK_EQUAL(double(p_archetype.get_components<int>()[i]), doubles[i], "Owned component of the same instance");
+							int_count++;
+						}
+						instance_count++;
+					}
+				});
+				CHECK_EQUAL(archetype_count, 2, "Archetype count");
+				CHECK_EQUAL(instance_count, 15, "Instance count");
+				CHECK_EQUAL(int_count, 5, "Instances owning an int");
+			}
+			{SCOPE_SECTION("Write through column");
+				storage.foreach_archetype<double>([](const ECS::Storage::ArchetypeView& p_archetype)
+				{
+					const auto doubles = p_archetype.get_components<double>();
+					for (size_t i = 0; i < p_archetype.size(); i++)
+						doubles[i] += 100.0;
+				});
+				for (size_t i = 0; i < entities.size(); i++)
+					CHECK_EQUAL(storage.get_component<double>(entities[i]), double(i) + 100.0, "Written component");
+			}
+		}
 	}
 } // namespace Test
 DISABLE_WARNING_POP
\ No newline at end of file
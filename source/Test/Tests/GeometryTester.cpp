@@ -1,16 +1,32 @@
 #include "GeometryTester.hpp"
 
 #include "Geometry/AABB.hpp"
+#include "Geometry/AABBTree.hpp"
 #include "Geometry/Cone.hpp"
+#include "Geometry/ContactSolver.hpp"
+#include "Geometry/Cuboid.hpp"
 #include "Geometry/Cylinder.hpp"
 #include "Geometry/Frustrum.hpp"
+#include "Geometry/Geometry.hpp"
+#include "Geometry/GJK.hpp"
+#include "Geometry/Heightfield.hpp"
 #include "Geometry/Intersect.hpp"
 #include "Geometry/Line.hpp"
 #include "Geometry/LineSegment.hpp"
+#include "Geometry/Plane.hpp"
+#include "Geometry/Quad.hpp"
 #include "Geometry/Ray.hpp"
+#include "Geometry/RayPacket.hpp"
+#include "Geometry/RigidBodyIntegrator.hpp"
+#include "Geometry/Sphere.hpp"
+#include "Geometry/SpatialHashGrid.hpp"
+#include "Geometry/SweepAndPrune.hpp"
+#include "Geometry/TransformBatch.hpp"
 #include "Geometry/Triangle.hpp"
+#include "Geometry/TriangleBVH.hpp"
 
 #include "Utility/Stopwatch.hpp"
+#include "Utility/ThreadPool.hpp"
 #include "Utility/Utility.hpp"
 
 #include "glm/glm.hpp"
@@ -20,7 +36,11 @@
 #include "imgui.h"
 #include "OpenGL/DebugRenderer.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
 
 DISABLE_WARNING_PUSH
 DISABLE_WARNING_HIDES_PREVIOUS_DECLERATION // Required to allow shadowing for the SCOPE_SECTION macro
@@ -35,6 +55,18 @@ namespace Test
 		run_frustrum_tests();
 		run_sphere_tests();
 		run_point_tests();
+		run_intersecting_tests();
+		run_sweep_and_prune_tests();
+		run_spatial_hash_grid_tests();
+		run_AABB_tree_tests();
+		run_rigid_body_integrator_tests();
+		run_transform_batch_tests();
+		run_batch_intersecting_tests();
+		run_GJK_tests();
+		run_contact_solver_tests();
+		run_triangle_BVH_tests();
+		run_heightfield_tests();
+		run_ray_packet_tests();
 	}
 	void GeometryTester::run_performance_tests()
 	{
@@ -72,6 +104,307 @@ namespace Test
 		emplace_performance_test({"Triangle v Triangle 10,000", triangleTest10000});
 		emplace_performance_test({"Triangle v Triangle 100,000", triangleTest100000});
 		emplace_performance_test({"Triangle v Triangle 1,000,000", triangleTest1000000});
+
+		{ // Sweep and prune a tick of 10,000 boxes each moving a small step from the previous tick.
+			constexpr size_t box_count = 10000;
+			const auto positions = Utility::get_random_numbers(-100.f, 100.f, box_count * 3);
+			const auto steps     = Utility::get_random_numbers(-0.05f, 0.05f, box_count * 3);
+
+			Geometry::SweepAndPrune broadphase;
+			size_t tick = 0;
+			auto sweep_and_prune_tick = [&]()
+			{
+				for (size_t i = 0; i < box_count; i++)
+				{
+					const auto position = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]) + glm::vec3(steps[i * 3], steps[i * 3 + 1], steps[i * 3 + 2]) * static_cast<float>(tick);
+					broadphase.set(i, Geometry::AABB(position, position + glm::vec3(1.f)));
+				}
+				broadphase.find_pairs();
+				tick++;
+			};
+			sweep_and_prune_tick(); // Initial sort outside of the timed runs.
+			emplace_performance_test({"Sweep and prune tick 10,000", sweep_and_prune_tick});
+		}
+		{ // Spatial hash grid tick of the same 10,000 boxes as sweep and prune.
+			constexpr size_t box_count = 10000;
+			const auto positions = Utility::get_random_numbers(-100.f, 100.f, box_count * 3);
+			const auto steps     = Utility::get_random_numbers(-0.05f, 0.05f, box_count * 3);
+
+			Geometry::SpatialHashGrid grid(2.f);
+			size_t tick = 0;
+			auto spatial_hash_grid_tick = [&]()
+			{
+				for (size_t i = 0; i < box_count; i++)
+				{
+					const auto position = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]) + glm::vec3(steps[i * 3], steps[i * 3 + 1], steps[i * 3 + 2]) * static_cast<float>(tick);
+					grid.set(i, Geometry::AABB(position, position + glm::vec3(1.f)));
+				}
+				grid.find_pairs();
+				tick++;
+			};
+			emplace_performance_test({"Spatial hash grid tick 10,000", spatial_hash_grid_tick});
+		}
+		{ // Integrate 10,000 rigid bodies one at a time and in SIMD batches.
+			constexpr size_t body_count = 10000;
+			Geometry::RigidBodyBatch bodies;
+			bodies.resize(body_count);
+			for (size_t i = 0; i < body_count; i++)
+			{
+				bodies.m_force.set(i, glm::vec3(0.f, -9.81f, 0.f));
+				bodies.m_torque.set(i, glm::vec3(0.f));
+				bodies.m_mass[i] = 1.f;
+				for (size_t element = 0; element < 9; element++)
+					bodies.m_inverse_inertia_tensor[element][i] = element % 4 == 0 ? 1.f : 0.f;
+				bodies.m_position.set(i, glm::vec3(static_cast<float>(i)));
+				bodies.m_momentum.set(i, glm::vec3(0.f));
+				bodies.m_angular_momentum.set(i, glm::vec3(0.1f, 0.2f, 0.3f));
+				bodies.m_orientation.set(i, glm::identity<glm::quat>());
+			}
+
+			auto integrate_scalar = [&bodies]() { Geometry::integrate(bodies, 1.f / 60.f, Geometry::IntegrationMode::Scalar, 0, bodies.size()); };
+			auto integrate_SIMD   = [&bodies]() { Geometry::integrate(bodies, 1.f / 60.f, Geometry::IntegrationMode::SIMD, 0, bodies.size()); };
+			emplace_performance_test({"Rigid body integrate scalar 10,000", integrate_scalar});
+			emplace_performance_test({std::format("Rigid body integrate SIMD ({}) 10,000", Geometry::get_SIMD_instruction_set()), integrate_SIMD});
+		}
+		{ // Build the model matrices and world AABBs of 10,000 transforms one at a time and in SIMD batches.
+			constexpr size_t transform_count = 10000;
+			const auto values = Utility::get_random_numbers(-10.f, 10.f, transform_count * 10);
+			Geometry::TransformBatch transforms;
+			transforms.resize(transform_count);
+			for (size_t i = 0; i < transform_count; i++)
+			{
+				const float* v = &values[i * 10];
+				transforms.m_position.set(i, glm::vec3(v[0], v[1], v[2]));
+				transforms.m_orientation.set(i, glm::normalize(glm::quat(v[3], v[4], v[5], v[6])));
+				transforms.m_scale.set(i, glm::abs(glm::vec3(v[7], v[8], v[9])) + glm::vec3(0.1f));
+				transforms.m_local_AABB_min.set(i, glm::vec3(-0.5f));
+				transforms.m_local_AABB_max.set(i, glm::vec3(0.5f));
+			}
+
+			auto build_scalar = [&transforms]() { Geometry::build_transforms(transforms, Geometry::TransformMode::Scalar, 0, transforms.size()); };
+			auto build_SIMD   = [&transforms]() { Geometry::build_transforms(transforms, Geometry::TransformMode::SIMD, 0, transforms.size()); };
+			auto build_glm    = [&transforms]()
+			{
+				for (size_t i = 0; i < transforms.size(); i++)
+				{
+					transforms.m_model[i] = glm::scale(glm::translate(glm::identity<glm::mat4>(), transforms.m_position.get(i)) * glm::mat4_cast(transforms.m_orientation.get(i)), transforms.m_scale.get(i));
+					const auto world_AABB = Geometry::AABB::transform(Geometry::AABB(transforms.m_local_AABB_min.get(i), transforms.m_local_AABB_max.get(i)), transforms.m_model[i]);
+					transforms.m_world_AABB_min.set(i, world_AABB.m_min);
+					transforms.m_world_AABB_max.set(i, world_AABB.m_max);
+				}
+			};
+			emplace_performance_test({"Transform build glm 10,000", build_glm});
+			emplace_performance_test({"Transform build scalar 10,000", build_scalar});
+			emplace_performance_test({std::format("Transform build SIMD ({}) 10,000", Geometry::get_SIMD_instruction_set()), build_SIMD});
+		}
+		{ // Frustrum cull 10,000 boxes one at a time and in SIMD batches.
+			constexpr size_t box_count = 10000;
+			const auto positions = Utility::get_random_numbers(-100.f, 100.f, box_count * 3);
+			const auto frustrum  = Geometry::Frustrum(glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 100.f));
+
+			std::vector<Geometry::AABB> AABBs;
+			std::array<std::vector<float>, 6> components; // min x, y, z then max x, y, z.
+			for (size_t i = 0; i < box_count; i++)
+			{
+				const auto& AABB = AABBs.emplace_back(glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]), glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]) + glm::vec3(1.f));
+				for (int axis = 0; axis < 3; axis++)
+				{
+					components[axis].push_back(AABB.m_min[axis]);
+					components[axis + 3].push_back(AABB.m_max[axis]);
+				}
+			}
+			const Geometry::AABBArray AABB_array = {components[0], components[1], components[2], components[3], components[4], components[5]};
+			std::vector<uint64_t> hits(Geometry::hit_mask_size(box_count));
+
+			size_t visible = 0;
+			auto frustrum_cull_scalar = [&]()
+			{
+				for (const auto& AABB : AABBs)
+					if (Geometry::intersecting(AABB, frustrum))
+						visible++;
+			};
+			auto frustrum_cull_batch = [&]() { visible += Geometry::intersecting(frustrum, AABB_array, hits); };
+			emplace_performance_test({"Frustrum cull scalar 10,000", frustrum_cull_scalar});
+			emplace_performance_test({"Frustrum cull batch 10,000", frustrum_cull_batch});
+		}
+		{ // One triangle against 10,000 triangles one at a time and as a batch.
+			constexpr size_t triangle_count = 10000;
+			const auto values   = Utility::get_random_numbers(-10.f, 10.f, triangle_count * 3);
+			const auto offsets  = Utility::get_random_numbers(-1.f, 1.f, triangle_count * 6);
+			const auto triangle = Geometry::Triangle(glm::vec3(-5.f, -5.f, 0.f), glm::vec3(5.f, -5.f, 0.f), glm::vec3(0.f, 5.f, 0.f));
+
+			std::vector<Geometry::Triangle> triangles;
+			triangles.reserve(triangle_count);
+			for (size_t i = 0; i < triangle_count; i++)
+			{
+				const auto point = glm::vec3(values[i * 3], values[i * 3 + 1], values[i * 3 + 2]);
+				triangles.emplace_back(point, point + glm::vec3(offsets[i * 6], offsets[i * 6 + 1], offsets[i * 6 + 2]), point + glm::vec3(offsets[i * 6 + 3], offsets[i * 6 + 4], offsets[i * 6 + 5]));
+			}
+			std::vector<uint64_t> hits(Geometry::hit_mask_size(triangle_count));
+
+			size_t intersections = 0;
+			auto triangles_scalar = [&]()
+			{
+				for (const auto& other : triangles)
+					if (Geometry::intersecting(triangle, other))
+						intersections++;
+			};
+			auto triangles_batch = [&]() { intersections += Geometry::intersecting(triangle, triangles, hits); };
+			emplace_performance_test({"Triangle v Triangle scalar 10,000", triangles_scalar});
+			emplace_performance_test({"Triangle v Triangle batch 10,000", triangles_batch});
+		}
+		{ // Contact manifolds between 1,000 pairs of randomly rotated overlapping cuboids.
+			constexpr size_t pair_count = 1000;
+			const auto values = Utility::get_random_numbers(-1.f, 1.f, pair_count * 8);
+			const auto cuboid = Geometry::Shape(Geometry::Cuboid(glm::vec3(0.f), glm::vec3(2.f)));
+
+			std::vector<std::pair<Geometry::ConvexShape, Geometry::ConvexShape>> pairs;
+			pairs.reserve(pair_count);
+			for (size_t i = 0; i < pair_count; i++)
+			{
+				const float* v = &values[i * 8];
+				const auto rotation_1 = glm::mat3_cast(glm::normalize(glm::quat(v[0], v[1], v[2], v[3]) + glm::quat(0.01f, 0.f, 0.f, 0.f)));
+				const auto rotation_2 = glm::mat3_cast(glm::normalize(glm::quat(v[4], v[5], v[6], v[7]) + glm::quat(0.01f, 0.f, 0.f, 0.f)));
+				pairs.emplace_back(Geometry::ConvexShape{cuboid, rotation_1, glm::vec3(0.f)}, Geometry::ConvexShape{cuboid, rotation_2, glm::vec3(v[0], 1.5f + v[1] * 0.5f, v[2])});
+			}
+
+			size_t contact_points = 0;
+			auto GJK_manifolds = [&]()
+			{
+				for (const auto& [shape_1, shape_2] : pairs)
+					if (const auto manifold = Geometry::get_contact_manifold(shape_1, shape_2))
+						contact_points += manifold->m_count;
+			};
+			emplace_performance_test({"GJK EPA cuboid manifolds 1,000", GJK_manifolds});
+		}
+		{ // 100 ray queries against a tree of 10,000 boxes.
+			constexpr size_t box_count = 10000;
+			const auto positions = Utility::get_random_numbers(-100.f, 100.f, box_count * 3);
+			const auto rays      = Utility::get_random_numbers(-100.f, 100.f, 100 * 6);
+
+			Geometry::AABBTree tree;
+			for (size_t i = 0; i < box_count; i++)
+			{
+				const auto position = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+				tree.set(i, Geometry::AABB(position, position + glm::vec3(1.f)));
+			}
+
+			size_t hits = 0;
+			auto AABB_tree_ray_queries = [&]()
+			{
+				for (size_t i = 0; i < 100; i++)
+				{
+					const auto start = glm::vec3(rays[i * 6], rays[i * 6 + 1], rays[i * 6 + 2]);
+					const auto end   = glm::vec3(rays[i * 6 + 3], rays[i * 6 + 4], rays[i * 6 + 5]);
+					tree.query(Geometry::Ray(start, end - start), [&hits](const size_t&) { hits++; });
+				}
+			};
+			emplace_performance_test({"AABB tree 100 ray queries 10,000", AABB_tree_ray_queries});
+		}
+		{ // Closest hit of 1,000 rays fanning out from one point against a tree of 10,000 boxes, one ray at a time and in packets.
+			constexpr size_t box_count = 10000;
+			constexpr size_t ray_count = 1000;
+			const auto positions  = Utility::get_random_numbers(-100.f, 100.f, box_count * 3);
+			const auto directions = Utility::get_random_numbers(-1.f, 1.f, ray_count * 3);
+
+			Geometry::AABBTree tree;
+			std::vector<Geometry::AABB> AABBs;
+			for (size_t i = 0; i < box_count; i++)
+			{
+				const auto position = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+				tree.set(i, AABBs.emplace_back(position, position + glm::vec3(1.f)));
+			}
+			std::vector<Geometry::Ray> rays;
+			for (size_t i = 0; i < ray_count; i++)
+				rays.emplace_back(glm::vec3(0.f), glm::vec3(directions[i * 3], directions[i * 3 + 1], directions[i * 3 + 2]));
+
+			float total_distance = 0.f;
+			auto single_ray_casts = [&]()
+			{
+				for (const auto& ray : rays)
+				{
+					float closest = std::numeric_limits<float>::max();
+					tree.query(ray, [&](const size_t& p_index)
+					{
+						float distance = 0.f;
+						if (Geometry::get_intersection(AABBs[p_index], ray, &distance) && distance < closest)
+							closest = distance;
+					});
+					total_distance += closest;
+				}
+			};
+			auto packet_ray_casts = [&]()
+			{
+				std::array<float, Geometry::RayPacket::Size> distances;
+				for (size_t first = 0; first < ray_count; first += Geometry::RayPacket::Size)
+				{
+					auto packet = Geometry::RayPacket(&rays[first], std::min(Geometry::RayPacket::Size, ray_count - first));
+					tree.query(packet, [&](const size_t& p_index)
+					{
+						const uint32_t lanes_hit = Geometry::get_intersection(AABBs[p_index], packet, distances);
+						for (size_t lane = 0; lane < packet.m_count; lane++)
+							if (lanes_hit & (1u << lane))
+								packet.set_max_distance(lane, distances[lane]);
+					});
+					for (size_t lane = 0; lane < packet.m_count; lane++)
+						total_distance += packet.m_max_distance[lane];
+				}
+			};
+			emplace_performance_test({"AABB tree 1,000 closest ray casts 10,000", single_ray_casts});
+			emplace_performance_test({"AABB tree 1,000 closest ray casts 10,000 packets", packet_ray_casts});
+		}
+		{ // 1,000 ray casts and sphere queries against a 100x100 terrain of 20,000 triangles.
+			constexpr size_t grid_size = 100;
+			const auto heights = Utility::get_random_numbers(-1.f, 1.f, (grid_size + 1) * (grid_size + 1));
+			const auto queries = Utility::get_random_numbers(0.f, static_cast<float>(grid_size), 1000 * 2);
+
+			std::vector<Geometry::Triangle> triangles;
+			triangles.reserve(grid_size * grid_size * 2);
+			auto point = [&heights](const size_t& p_x, const size_t& p_z) { return glm::vec3(static_cast<float>(p_x), heights[p_x * (grid_size + 1) + p_z], static_cast<float>(p_z)); };
+			for (size_t x = 0; x < grid_size; x++)
+				for (size_t z = 0; z < grid_size; z++)
+				{
+					triangles.emplace_back(point(x, z), point(x + 1, z), point(x, z + 1));
+					triangles.emplace_back(point(x + 1, z), point(x + 1, z + 1), point(x, z + 1));
+				}
+			const Geometry::TriangleBVH BVH(std::move(triangles));
+
+			size_t hits = 0;
+			auto triangle_BVH_ray_casts = [&]()
+			{
+				for (size_t i = 0; i < 1000; i++)
+					if (BVH.raycast(Geometry::Ray(glm::vec3(queries[i * 2], 10.f, queries[i * 2 + 1]), glm::vec3(0.3f, -1.f, 0.2f))))
+						hits++;
+			};
+			auto triangle_BVH_sphere_queries = [&]()
+			{
+				for (size_t i = 0; i < 1000; i++)
+					BVH.query(Geometry::Sphere(glm::vec3(queries[i * 2], 0.f, queries[i * 2 + 1]), 1.f), [&hits](const Geometry::Triangle&) { hits++; });
+			};
+			emplace_performance_test({"Triangle BVH 1,000 ray casts 20,000", triangle_BVH_ray_casts});
+			emplace_performance_test({"Triangle BVH 1,000 sphere queries 20,000", triangle_BVH_sphere_queries});
+		}
+		{ // 1,000 shallow ray casts and sphere queries against a 1000x1000 heightfield of 2,000,000 triangles.
+			constexpr size_t grid_size = 1000;
+			auto heights       = Utility::get_random_numbers(-1.f, 1.f, (grid_size + 1) * (grid_size + 1));
+			const auto queries = Utility::get_random_numbers(0.f, static_cast<float>(grid_size), 1000 * 2);
+			const Geometry::Heightfield heightfield(grid_size, grid_size, 1.f, std::move(heights));
+
+			size_t hits = 0;
+			auto heightfield_ray_casts = [&]()
+			{
+				for (size_t i = 0; i < 1000; i++)
+					if (heightfield.raycast(Geometry::Ray(glm::vec3(queries[i * 2], 10.f, queries[i * 2 + 1]), glm::vec3(3.f, -0.1f, 2.f))))
+						hits++;
+			};
+			auto heightfield_sphere_queries = [&]()
+			{
+				for (size_t i = 0; i < 1000; i++)
+					heightfield.query(Geometry::Sphere(glm::vec3(queries[i * 2], 0.f, queries[i * 2 + 1]), 1.f), [&hits](const Geometry::Triangle&) { hits++; });
+			};
+			emplace_performance_test({"Heightfield 1,000 ray casts 2,000,000", heightfield_ray_casts});
+			emplace_performance_test({"Heightfield 1,000 sphere queries 2,000,000", heightfield_sphere_queries});
+		}
 	}
 
 	void GeometryTester::runAABBTests()
@@ -279,6 +612,84 @@ namespace Test
 				CHECK_TRUE(Geometry::intersecting(control, control), "Equal triangles");
 			}
 		}
+		{SCOPE_SECTION("Triangle v Triangle contact")
+			const auto floor = Geometry::Triangle(glm::vec3(-2.f, -2.f, 0.f), glm::vec3(2.f, -2.f, 0.f), glm::vec3(0.f, 2.f, 0.f));
+			{SCOPE_SECTION("Piercing");
+				// A vertical triangle dipping 0.25 below the floor. Lowering the floor 0.25 along -Z separates them with the least movement.
+				const auto wall    = Geometry::Triangle(glm::vec3(0.f, -1.f, -0.25f), glm::vec3(0.f, 1.f, -0.25f), glm::vec3(0.f, 0.f, 1.f));
+				const auto contact = Geometry::get_intersection(floor, wall);
+				CHECK_TRUE(contact.has_value(), "Intersecting");
+				if (contact)
+				{
+					CHECK_TRUE(glm::distance(contact->position, glm::vec3(0.f)) < 1e-5f, "Position at middle of intersection segment");
+					CHECK_EQUAL(contact->normal, glm::vec3(0.f, 0.f, -1.f), "Normal");
+					CHECK_EQUAL(contact->penetration_depth, 0.25f, "Penetration depth");
+				}
+				const auto reverse = Geometry::get_intersection(wall, floor);
+				CHECK_TRUE(reverse.has_value() && reverse->normal == glm::vec3(0.f, 0.f, 1.f), "Reversed normal");
+			}
+			{SCOPE_SECTION("Separated");
+				const auto above = Geometry::Triangle(glm::vec3(0.f, -1.f, 0.25f), glm::vec3(0.f, 1.f, 0.25f), glm::vec3(0.f, 0.f, 1.f));
+				const auto beside = Geometry::Triangle(glm::vec3(3.f, -1.f, -1.f), glm::vec3(3.f, 1.f, -1.f), glm::vec3(3.f, 0.f, 1.f));
+				CHECK_TRUE(!Geometry::get_intersection(floor, above).has_value(), "Above plane");
+				CHECK_TRUE(!Geometry::get_intersection(floor, beside).has_value(), "Crossing plane outside triangle");
+			}
+			{SCOPE_SECTION("Coplanar");
+				const auto inside  = Geometry::Triangle(glm::vec3(-1.f, -1.f, 0.f), glm::vec3(1.f, -1.f, 0.f), glm::vec3(0.f, 2.f, 0.f));
+				const auto contact = Geometry::get_intersection(floor, inside);
+				CHECK_TRUE(contact.has_value(), "Intersecting");
+				if (contact)
+				{
+					CHECK_TRUE(glm::distance(contact->position, glm::vec3(0.f)) < 1e-5f, "Position at centre of overlap");
+					CHECK_EQUAL(contact->normal, glm::vec3(0.f, 0.f, 1.f), "Normal");
+					CHECK_EQUAL(contact->penetration_depth, 0.f, "Penetration depth");
+				}
+				CHECK_TRUE(!Geometry::get_intersection(floor, inside, false).has_value(), "Coplanar test disabled");
+			}
+			{SCOPE_SECTION("Matches intersecting");
+				// Random triangles in a small volume so roughly half of the pairs intersect.
+				constexpr size_t pair_count = 1000;
+				const auto values = Utility::get_random_numbers(-1.f, 1.f, pair_count * 18);
+				size_t mismatches = 0;
+				for (size_t i = 0; i < pair_count; i++)
+				{
+					const float* v = &values[i * 18];
+					const auto triangle_1 = Geometry::Triangle(glm::vec3(v[0], v[1], v[2]), glm::vec3(v[3], v[4], v[5]), glm::vec3(v[6], v[7], v[8]));
+					const auto triangle_2 = Geometry::Triangle(glm::vec3(v[9], v[10], v[11]), glm::vec3(v[12], v[13], v[14]), glm::vec3(v[15], v[16], v[17]));
+					if (Geometry::get_intersection(triangle_1, triangle_2).has_value() != Geometry::intersecting(triangle_1, triangle_2))
+						mismatches++;
+				}
+				CHECK_EQUAL(mismatches, size_t(0), "get_intersection and intersecting agree");
+			}
+		}
+		{SCOPE_SECTION("Triangle v Triangle batch")
+			// A triangle count not divisible by 64 to cover a partial last hit mask word.
+			constexpr size_t triangle_count = 203;
+			const auto values = Utility::get_random_numbers(-2.f, 2.f, triangle_count * 9);
+			std::vector<Geometry::Triangle> triangles;
+			for (size_t i = 0; i < triangle_count; i++)
+			{
+				const float* v = &values[i * 9];
+				triangles.emplace_back(glm::vec3(v[0], v[1], v[2]), glm::vec3(v[3], v[4], v[5]), glm::vec3(v[6], v[7], v[8]));
+			}
+			triangles[7] = control;
+
+			std::vector<uint64_t> hits(Geometry::hit_mask_size(triangle_count), ~uint64_t(0));
+			const size_t count = Geometry::intersecting(control, triangles, hits);
+
+			size_t expected_count = 0;
+			bool match = true;
+			for (size_t i = 0; i < triangle_count; i++)
+			{
+				const bool expected = Geometry::intersecting(control, triangles[i]);
+				expected_count += expected ? 1 : 0;
+				match &= ((hits[i / 64] >> (i % 64)) & 1) == (expected ? 1u : 0u);
+			}
+			CHECK_TRUE(match, "Hits match intersecting");
+			CHECK_EQUAL(count, expected_count, "Hit count");
+			CHECK_EQUAL(hits.back() >> (triangle_count % 64), uint64_t(0), "Bits past the last triangle cleared");
+			CHECK_TRUE(count > 0 && count < triangle_count, "Mix of hits and misses");
+		}
 	}
 
 	void GeometryTester::run_frustrum_tests()
@@ -295,16 +706,16 @@ namespace Test
 				CHECK_EQUAL(frustrum.m_right.m_distance,  ortho_size, "Right");
 				CHECK_EQUAL(frustrum.m_bottom.m_distance, ortho_size, "Bottom");
 				CHECK_EQUAL(frustrum.m_top.m_distance,    ortho_size, "Top");
-				CHECK_EQUAL(frustrum.m_near.m_distance,   -1.f,       "Near");
-				CHECK_EQUAL(frustrum.m_far.m_distance,    -1.f,       "Far");
+				CHECK_EQUAL(frustrum.m_near.m_distance,   1.f,        "Near");
+				CHECK_EQUAL(frustrum.m_far.m_distance,    1.f,        "Far");
 			}
 			{SCOPE_SECTION("Normal");
 				CHECK_EQUAL(frustrum.m_left.m_normal,   glm::vec3(1.f, 0.f, 0.f),  "Left");
 				CHECK_EQUAL(frustrum.m_right.m_normal,  glm::vec3(-1.f, 0.f, 0.f), "Right");
 				CHECK_EQUAL(frustrum.m_bottom.m_normal, glm::vec3(0.f, 1.f, 0.f),  "Bottom");
 				CHECK_EQUAL(frustrum.m_top.m_normal,    glm::vec3(0.f, -1.f, 0.f), "Top");
-				CHECK_EQUAL(frustrum.m_near.m_normal,   glm::vec3(0.f, 0.f, 1.f),  "Near");
-				CHECK_EQUAL(frustrum.m_far.m_normal,    glm::vec3(0.f, 0.f, -1.f), "Far");
+				CHECK_EQUAL(frustrum.m_near.m_normal,   glm::vec3(0.f, 0.f, -1.f), "Near");
+				CHECK_EQUAL(frustrum.m_far.m_normal,    glm::vec3(0.f, 0.f, 1.f),  "Far");
 			}
 		}
 		{SCOPE_SECTION("Frustrum from 'non-identity' ortho projection");
@@ -328,17 +739,29 @@ namespace Test
 				CHECK_TRUE(error_threshold_equality(frustrum.m_bottom.m_distance, ortho_size, std::numeric_limits<float>::epsilon(), 1.f), "Bottom");
 				CHECK_TRUE(error_threshold_equality(frustrum.m_top.m_distance,    ortho_size, std::numeric_limits<float>::epsilon(), 1.f), "Top");
 				CHECK_EQUAL(frustrum.m_near.m_distance, 0.f, "Near");
-				CHECK_EQUAL(frustrum.m_far.m_distance, -10.f, "Far");
+				CHECK_EQUAL(frustrum.m_far.m_distance, 10.f, "Far");
 			}
 			{SCOPE_SECTION("Normal");
 				CHECK_EQUAL(frustrum.m_left.m_normal,   glm::vec3(1.f, 0.f, 0.f), "Left");
 				CHECK_EQUAL(frustrum.m_right.m_normal,  glm::vec3(-1.f, 0.f, 0.f), "Right");
 				CHECK_EQUAL(frustrum.m_bottom.m_normal, glm::vec3(0.f, 1.f, 0.f), "Bottom");
 				CHECK_EQUAL(frustrum.m_top.m_normal,    glm::vec3(0.f, -1.f, 0.f), "Top");
-				CHECK_EQUAL(frustrum.m_near.m_normal,   glm::vec3(0.f, 0.f, 1.f), "Near");
-				CHECK_EQUAL(frustrum.m_far.m_normal,    glm::vec3(0.f, 0.f, -1.f), "Far");
+				CHECK_EQUAL(frustrum.m_near.m_normal,   glm::vec3(0.f, 0.f, -1.f), "Near");
+				CHECK_EQUAL(frustrum.m_far.m_normal,    glm::vec3(0.f, 0.f, 1.f), "Far");
 			}
 		}
+		{SCOPE_SECTION("Frustrum v AABB");
+			// Camera at the origin looking down -z, the frustrum covers z in [-10, 0].
+			auto frustrum = Geometry::Frustrum(glm::ortho(-15.f, 15.f, -15.f, 15.f, 0.f, 10.f));
+
+			CHECK_TRUE(Geometry::intersecting(Geometry::AABB(glm::vec3(-1.f, -1.f, -6.f), glm::vec3(1.f, 1.f, -4.f)), frustrum), "Inside");
+			CHECK_TRUE(Geometry::intersecting(Geometry::AABB(glm::vec3(14.f, -1.f, -6.f), glm::vec3(16.f, 1.f, -4.f)), frustrum), "Straddling right");
+			CHECK_TRUE(Geometry::intersecting(Geometry::AABB(glm::vec3(-100.f), glm::vec3(100.f)), frustrum), "Enclosing frustrum");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::AABB(glm::vec3(-1.f, -1.f, 1.f), glm::vec3(1.f, 1.f, 2.f)), frustrum), "Behind near");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::AABB(glm::vec3(-1.f, -1.f, -12.f), glm::vec3(1.f, 1.f, -11.f)), frustrum), "Beyond far");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::AABB(glm::vec3(16.f, -1.f, -6.f), glm::vec3(17.f, 1.f, -4.f)), frustrum), "Right of right");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::AABB(glm::vec3(-1.f, 16.f, -6.f), glm::vec3(1.f, 17.f, -4.f)), frustrum), "Above top");
+		}
 	}
 
 	void GeometryTester::run_sphere_tests()
@@ -584,10 +1007,1134 @@ namespace Test
 		}
 	}
 
+	// Brute force the overlapping pairs of p_AABBs, ordered lower index first then sorted, to compare against the broadphase output.
+	static std::vector<std::pair<size_t, size_t>> get_overlapping_pairs(const std::vector<Geometry::AABB>& p_AABBs)
+	{
+		std::vector<std::pair<size_t, size_t>> pairs;
+		for (size_t i = 0; i < p_AABBs.size(); i++)
+			for (size_t j = i + 1; j < p_AABBs.size(); j++)
+				if (Geometry::intersecting(p_AABBs[i], p_AABBs[j]))
+					pairs.push_back({i, j});
+		return pairs;
+	}
+
+	// Set two static floors, a body in layer 2 masking out layer 1 and a body in the default layer all overlapping in p_broadphase.
+	// Returns the pairs found sorted, the filters leave only Filtered_Pairs.
+	template <typename Broadphase>
+	static std::vector<std::pair<size_t, size_t>> find_filtered_pairs(Broadphase& p_broadphase)
+	{
+		p_broadphase.set(0, Geometry::AABB(glm::vec3(-5.f, 0.f, -5.f), glm::vec3(5.f, 1.f, 5.f)), {Geometry::CollisionFilter::Default_Layer, Geometry::CollisionFilter::All_Layers, true});
+		p_broadphase.set(1, Geometry::AABB(glm::vec3(-5.f, 0.f, -5.f), glm::vec3(5.f, 1.f, 5.f)), {Geometry::CollisionFilter::Default_Layer, Geometry::CollisionFilter::All_Layers, true});
+		p_broadphase.set(2, Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f)), {2u, ~Geometry::CollisionFilter::Default_Layer, false});
+		p_broadphase.set(3, Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f)));
+
+		auto pairs = p_broadphase.find_pairs();
+		std::sort(pairs.begin(), pairs.end());
+		return pairs;
+	}
+	static const std::vector<std::pair<size_t, size_t>> Filtered_Pairs = {{0, 3}, {1, 3}};
+
+	void GeometryTester::run_intersecting_tests()
+	{SCOPE_SECTION("Intersecting")
+		// A 2x2x2 cube rotated 45 degrees about z, its corners reach sqrt(2) along x and y.
+		const auto rotated_cube = Geometry::Cuboid(glm::vec3(0.f), glm::vec3(2.f), glm::angleAxis(glm::radians(45.f), glm::vec3(0.f, 0.f, 1.f)));
+		const auto cylinder     = Geometry::Cylinder(glm::vec3(0.f), glm::vec3(0.f, 2.f, 0.f), 1.f);
+		const auto cone         = Geometry::Cone(glm::vec3(0.f), glm::vec3(0.f, 2.f, 0.f), 1.f);
+		const auto up           = glm::vec3(0.f, 1.f, 0.f);
+		const auto right        = glm::vec3(1.f, 0.f, 0.f);
+
+		{SCOPE_SECTION("Plane");
+			const auto AABB = Geometry::AABB(glm::vec3(-1.f), glm::vec3(1.f));
+			CHECK_TRUE(Geometry::intersecting(AABB, Geometry::Plane(glm::vec3(0.f, 0.5f, 0.f), up)), "AABB crossing");
+			CHECK_TRUE(!Geometry::intersecting(AABB, Geometry::Plane(glm::vec3(0.f, 1.5f, 0.f), up)), "AABB above");
+			CHECK_TRUE(Geometry::intersecting(rotated_cube, Geometry::Plane(glm::vec3(0.f, 1.3f, 0.f), up)), "Cuboid corner crossing");
+			CHECK_TRUE(!Geometry::intersecting(rotated_cube, Geometry::Plane(glm::vec3(0.f, 1.5f, 0.f), up)), "Cuboid below");
+			CHECK_TRUE(Geometry::intersecting(cylinder, Geometry::Plane(glm::vec3(0.9f, 0.f, 0.f), right)), "Cylinder side crossing");
+			CHECK_TRUE(!Geometry::intersecting(cylinder, Geometry::Plane(glm::vec3(1.1f, 0.f, 0.f), right)), "Cylinder beside");
+			CHECK_TRUE(Geometry::intersecting(cone, Geometry::Plane(glm::vec3(0.f, 1.9f, 0.f), up)), "Cone apex crossing");
+			CHECK_TRUE(!Geometry::intersecting(cone, Geometry::Plane(glm::vec3(0.f, 2.1f, 0.f), up)), "Cone below");
+			CHECK_TRUE(!Geometry::intersecting(cone, Geometry::Plane(glm::vec3(1.1f, 0.f, 0.f), right)), "Cone beside");
+			CHECK_TRUE(Geometry::intersecting(Geometry::LineSegment(glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 1.f, 0.f)), Geometry::Plane(glm::vec3(0.f), up)), "LineSegment crossing");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::LineSegment(glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 2.f, 0.f)), Geometry::Plane(glm::vec3(0.f), up)), "LineSegment above");
+			CHECK_TRUE(Geometry::intersecting(Geometry::Ray(glm::vec3(0.f, 1.f, 0.f), -up), Geometry::Plane(glm::vec3(0.f), up)), "Ray towards");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Ray(glm::vec3(0.f, 1.f, 0.f), up), Geometry::Plane(glm::vec3(0.f), up)), "Ray away");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Line(glm::vec3(0.f, 1.f, 0.f), glm::vec3(1.f, 1.f, 0.f)), Geometry::Plane(glm::vec3(0.f), up)), "Line parallel");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Line(glm::vec3(0.f, 0.5f, 0.f), glm::vec3(1.f, std::nextafter(0.5f, 1.f), 0.f)), Geometry::Plane(glm::vec3(0.f), up)), "Line parallel within rounding");
+			CHECK_TRUE(Geometry::intersecting(Geometry::Plane(glm::vec3(0.f), right), Geometry::Plane(glm::vec3(0.f), up), Geometry::Plane(glm::vec3(0.f), glm::vec3(0.f, 0.f, 1.f))), "3 planes meet");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Plane(glm::vec3(0.f), right), Geometry::Plane(glm::vec3(0.f), up), Geometry::Plane(glm::vec3(0.f), glm::vec3(1.f, 1.f, 0.f))), "3 planes share a line");
+		}
+		{SCOPE_SECTION("Lines");
+			CHECK_TRUE(Geometry::intersecting(Geometry::Line(glm::vec3(-1.f, 0.f, 0.f), glm::vec3(1.f, 0.f, 0.f)), Geometry::Line(glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 1.f, 0.f))), "Lines crossing");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Line(glm::vec3(-1.f, 0.f, 0.f), glm::vec3(1.f, 0.f, 0.f)), Geometry::Line(glm::vec3(0.f, -1.f, 1.f), glm::vec3(0.f, 1.f, 1.f))), "Lines skew");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Line(glm::vec3(0.f), right), Geometry::Line(up, up + right)), "Lines parallel");
+			CHECK_TRUE(Geometry::intersecting(Geometry::Ray(glm::vec3(0.f), right), Geometry::Ray(glm::vec3(1.f, -1.f, 0.f), up)), "Rays crossing");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Ray(glm::vec3(0.f), right), Geometry::Ray(glm::vec3(1.f, -1.f, 0.f), -up)), "Rays crossing behind");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::LineSegment(glm::vec3(0.f), glm::vec3(0.9f, 0.f, 0.f)), Geometry::LineSegment(glm::vec3(1.f, -1.f, 0.f), glm::vec3(1.f, 1.f, 0.f))), "LineSegments short");
+			CHECK_TRUE(Geometry::intersecting(Geometry::LineSegment(glm::vec3(0.f), glm::vec3(1.f, 0.f, 0.f)), Geometry::LineSegment(glm::vec3(1.f, -1.f, 0.f), glm::vec3(1.f, 1.f, 0.f))), "LineSegments touching");
+			CHECK_TRUE(Geometry::intersecting(Geometry::Line(glm::vec3(0.f, 0.5f, 0.f), glm::vec3(1.f, 0.5f, 0.f)), Geometry::Sphere(glm::vec3(0.f), 1.f)), "Line v Sphere");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Ray(glm::vec3(2.f, 0.f, 0.f), right), Geometry::Sphere(glm::vec3(0.f), 1.f)), "Ray v Sphere behind");
+		}
+		{SCOPE_SECTION("Triangle and Quad");
+			const auto triangle = Geometry::Triangle(glm::vec3(-1.f, 0.f, -1.f), glm::vec3(1.f, 0.f, -1.f), glm::vec3(0.f, 0.f, 1.f));
+			const auto quad     = Geometry::Quad(glm::vec3(-1.f, 0.f, -1.f), glm::vec3(-1.f, 0.f, 1.f), glm::vec3(1.f, 0.f, 1.f), glm::vec3(1.f, 0.f, -1.f));
+			CHECK_TRUE(Geometry::intersecting(Geometry::LineSegment(glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, -1.f, 0.f)), triangle), "LineSegment piercing");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::LineSegment(glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 0.1f, 0.f)), triangle), "LineSegment short");
+			CHECK_TRUE(Geometry::intersecting(Geometry::LineSegment(glm::vec3(-2.f, 0.f, 0.f), glm::vec3(2.f, 0.f, 0.f)), triangle), "LineSegment coplanar crossing");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::LineSegment(glm::vec3(-2.f, 0.f, 2.f), glm::vec3(2.f, 0.f, 2.f)), triangle), "LineSegment coplanar outside");
+			CHECK_TRUE(Geometry::intersecting(quad, Geometry::Ray(glm::vec3(0.9f, 1.f, 0.9f), -up)), "Quad v Ray");
+			CHECK_TRUE(!Geometry::intersecting(quad, Geometry::Ray(glm::vec3(1.1f, 1.f, 0.9f), -up)), "Quad v Ray outside");
+			CHECK_TRUE(Geometry::intersecting(quad, Geometry::Quad(glm::vec3(0.f), right)), "Quad v Quad perpendicular");
+			CHECK_TRUE(!Geometry::intersecting(quad, Geometry::Quad(glm::vec3(0.f, 1.f, 0.f), up)), "Quad v Quad parallel");
+			CHECK_TRUE(Geometry::intersecting(Geometry::AABB(glm::vec3(0.5f, -0.5f, 0.5f), glm::vec3(2.f)), quad), "AABB v Quad");
+			CHECK_TRUE(!Geometry::intersecting(rotated_cube, Geometry::Quad(glm::vec3(0.f, 1.5f, 0.f), up)), "Cuboid v Quad above");
+		}
+		{SCOPE_SECTION("Cuboid");
+			CHECK_TRUE(Geometry::intersecting(rotated_cube, Geometry::Ray(glm::vec3(-5.f, 1.3f, 0.f), right)), "Ray through corner");
+			CHECK_TRUE(!Geometry::intersecting(rotated_cube, Geometry::Ray(glm::vec3(-5.f, 1.5f, 0.f), right)), "Ray past corner");
+			CHECK_TRUE(Geometry::intersecting(rotated_cube, Geometry::Sphere(glm::vec3(1.9f, 0.f, 0.f), 0.5f)), "Sphere at corner");
+			CHECK_TRUE(!Geometry::intersecting(rotated_cube, Geometry::Sphere(glm::vec3(2.f, 0.f, 0.f), 0.5f)), "Sphere past corner");
+			CHECK_TRUE(Geometry::intersecting(Geometry::AABB(glm::vec3(1.3f, -0.1f, -0.1f), glm::vec3(2.f, 0.1f, 0.1f)), rotated_cube), "AABB at corner");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::AABB(glm::vec3(1.5f, -0.1f, -0.1f), glm::vec3(2.f, 0.1f, 0.1f)), rotated_cube), "AABB past corner");
+
+			// Two cubes rotated about different axes with every face axis overlapping, only the cross product of an edge of each separates them.
+			const auto edge_cube_1 = Geometry::Cuboid(glm::vec3(0.f), glm::vec3(2.f), glm::angleAxis(glm::radians(45.f), glm::vec3(0.f, 0.f, 1.f)));
+			const auto edge_cube_2 = Geometry::Cuboid(glm::vec3(2.9f, 0.f, 0.f), glm::vec3(2.f), glm::angleAxis(glm::radians(45.f), glm::vec3(0.f, 1.f, 0.f)));
+			const auto edge_cube_3 = Geometry::Cuboid(glm::vec3(2.7f, 0.f, 0.f), glm::vec3(2.f), glm::angleAxis(glm::radians(45.f), glm::vec3(0.f, 1.f, 0.f)));
+			CHECK_TRUE(!Geometry::intersecting(edge_cube_1, edge_cube_2), "Cuboid v Cuboid edges separated");
+			CHECK_TRUE(Geometry::intersecting(edge_cube_1, edge_cube_3), "Cuboid v Cuboid edges crossing");
+		}
+		{SCOPE_SECTION("Cylinder and Cone");
+			CHECK_TRUE(Geometry::intersecting(cylinder, Geometry::Sphere(glm::vec3(1.4f, 2.4f, 0.f), 0.6f)), "Cylinder v Sphere at rim");
+			CHECK_TRUE(!Geometry::intersecting(cylinder, Geometry::Sphere(glm::vec3(1.5f, 2.5f, 0.f), 0.6f)), "Cylinder v Sphere past rim");
+			CHECK_TRUE(Geometry::intersecting(cylinder, Geometry::Line(glm::vec3(0.9f, 1.f, -5.f), glm::vec3(0.9f, 1.f, 5.f))), "Cylinder v Line");
+			CHECK_TRUE(!Geometry::intersecting(cylinder, Geometry::Ray(glm::vec3(0.f, 3.f, 0.f), up)), "Cylinder v Ray away");
+			CHECK_TRUE(Geometry::intersecting(cone, Geometry::Ray(glm::vec3(0.f, 3.f, 0.f), -up)), "Cone v Ray through apex");
+			CHECK_TRUE(!Geometry::intersecting(cone, Geometry::Line(glm::vec3(0.7f, 1.f, -5.f), glm::vec3(0.7f, 1.f, 5.f))), "Cone v Line beside apex");
+			CHECK_TRUE(Geometry::intersecting(cone, cylinder), "Cone v Cylinder");
+			CHECK_TRUE(!Geometry::intersecting(cone, Geometry::Cylinder(glm::vec3(3.f, 0.f, 0.f), glm::vec3(3.f, 2.f, 0.f), 1.f)), "Cone v Cylinder apart");
+			CHECK_TRUE(Geometry::intersecting(cylinder, Geometry::Triangle(glm::vec3(0.5f, 1.f, 0.f), glm::vec3(3.f, 1.f, 0.f), glm::vec3(3.f, 1.f, 1.f))), "Cylinder v Triangle");
+		}
+		{SCOPE_SECTION("Cuboid v Cuboid matches GJK");
+			// Random cuboid pairs. Within a small margin of touching SAT and GJK may disagree, so SAT on the shrunk pair overlapping must
+			// imply GJK overlapping and GJK overlapping must imply SAT on the grown pair overlapping.
+			constexpr size_t pair_count = 200;
+			const auto values = Utility::get_random_numbers(-1.f, 1.f, pair_count * 14);
+			bool match = true;
+			for (size_t i = 0; i < pair_count; i++)
+			{
+				const float* v = &values[i * 14];
+				const auto rotation_1 = glm::normalize(glm::quat(v[0], v[1], v[2], v[3]) + glm::quat(0.01f, 0.f, 0.f, 0.f));
+				const auto rotation_2 = glm::normalize(glm::quat(v[4], v[5], v[6], v[7]) + glm::quat(0.01f, 0.f, 0.f, 0.f));
+				const auto scale_1    = glm::abs(glm::vec3(v[8], v[9], v[10])) + glm::vec3(0.2f);
+				const auto position_2 = glm::vec3(v[11], v[12], v[13]) * 2.f;
+				auto cuboids = [&](const float& p_scale)
+				{
+					return std::make_pair(Geometry::Cuboid(glm::vec3(0.f), scale_1 * p_scale, rotation_1), Geometry::Cuboid(position_2, glm::vec3(1.f, 0.5f, 1.5f) * p_scale, rotation_2));
+				};
+				const auto [cuboid_1, cuboid_2] = cuboids(1.f);
+				const auto shape_1 = Geometry::Shape(cuboid_1);
+				const auto shape_2 = Geometry::Shape(cuboid_2);
+				const bool GJK     = Geometry::intersecting(Geometry::ConvexShape{shape_1, glm::mat3(1.f), glm::vec3(0.f)}, Geometry::ConvexShape{shape_2, glm::mat3(1.f), glm::vec3(0.f)});
+
+				const auto [shrunk_1, shrunk_2] = cuboids(0.99f);
+				const auto [grown_1, grown_2]   = cuboids(1.01f);
+				match &= (!Geometry::intersecting(shrunk_1, shrunk_2) || GJK) && (!GJK || Geometry::intersecting(grown_1, grown_2));
+			}
+			CHECK_TRUE(match, "SAT matches GJK");
+		}
+	}
+
+	void GeometryTester::run_sweep_and_prune_tests()
+	{SCOPE_SECTION("Sweep and prune")
+		{SCOPE_SECTION("AABB v AABB contact");
+			auto floor = Geometry::AABB(glm::vec3(-10.f, -1.f, -10.f), glm::vec3(10.f, 0.f, 10.f));
+			auto box   = Geometry::AABB(glm::vec3(-1.f, -0.25f, -1.f), glm::vec3(1.f, 1.75f, 1.f));
+
+			auto contact = Geometry::get_intersection(box, floor);
+			CHECK_TRUE(contact.has_value(), "Box resting in floor");
+			CHECK_EQUAL(contact->normal, glm::vec3(0.f, 1.f, 0.f), "Normal points out of the floor towards the box");
+			CHECK_EQUAL(contact->penetration_depth, 0.25f, "Penetration depth");
+			CHECK_EQUAL(contact->position, glm::vec3(0.f, -0.25f, 0.f), "Contact on the bottom face of the box");
+			CHECK_TRUE(!Geometry::get_intersection(box, Geometry::AABB(glm::vec3(2.f), glm::vec3(3.f))).has_value(), "Separated boxes");
+		}
+		{SCOPE_SECTION("Pairs");
+			Geometry::SweepAndPrune broadphase;
+			broadphase.set(0, Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f)));
+			broadphase.set(1, Geometry::AABB(glm::vec3(0.5f), glm::vec3(1.5f)));
+			broadphase.set(2, Geometry::AABB(glm::vec3(5.f), glm::vec3(6.f)));
+
+			auto pairs = broadphase.find_pairs();
+			CHECK_EQUAL(pairs.size(), 1, "One overlapping pair");
+			CHECK_TRUE(pairs.front() == std::make_pair(size_t(0), size_t(1)), "Pair lower ID first");
+
+			{SCOPE_SECTION("Proxies not set are removed");
+				broadphase.set(1, Geometry::AABB(glm::vec3(5.5f), glm::vec3(6.5f)));
+				broadphase.set(2, Geometry::AABB(glm::vec3(5.f), glm::vec3(6.f)));
+				pairs = broadphase.find_pairs();
+				CHECK_EQUAL(broadphase.size(), 2, "Proxy 0 removed");
+				CHECK_EQUAL(pairs.size(), 1, "One overlapping pair");
+				CHECK_TRUE(pairs.front() == std::make_pair(size_t(1), size_t(2)), "Moved proxy overlaps");
+			}
+			{SCOPE_SECTION("Keep");
+				// Proxy 2 keeps the AABB it was last set with, e.g. a sleeping body.
+				broadphase.set(1, Geometry::AABB(glm::vec3(5.5f), glm::vec3(6.5f)));
+				broadphase.keep(2);
+				pairs = broadphase.find_pairs();
+				CHECK_TRUE(broadphase.contains(2) && !broadphase.contains(0), "Kept proxy not removed");
+				CHECK_EQUAL(pairs.size(), 1, "Kept proxy still pairs");
+			}
+			{SCOPE_SECTION("Remove");
+				broadphase.set(1, Geometry::AABB(glm::vec3(5.5f), glm::vec3(6.5f)));
+				broadphase.set(2, Geometry::AABB(glm::vec3(5.f), glm::vec3(6.f)));
+				broadphase.remove(2);
+				CHECK_EQUAL(broadphase.size(), 1, "Removed before find_pairs");
+				CHECK_TRUE(broadphase.find_pairs().empty(), "No pairs after remove");
+
+				// Proxies left over from the last find_pairs are removed straight away too.
+				broadphase.remove(1);
+				CHECK_EQUAL(broadphase.size(), 0, "Removed after find_pairs");
+				broadphase.remove(1);
+				CHECK_EQUAL(broadphase.size(), 0, "Removing twice is ignored");
+			}
+			{SCOPE_SECTION("Removed never paired");
+				// Three overlapping proxies, the middle one removed between ticks while the others are set every tick.
+				for (size_t ID = 0; ID < 3; ID++)
+					broadphase.set(ID, Geometry::AABB(glm::vec3(static_cast<float>(ID) * 0.5f), glm::vec3(static_cast<float>(ID) * 0.5f + 1.f)));
+				CHECK_EQUAL(broadphase.find_pairs().size(), 3, "Every proxy overlaps before remove");
+
+				broadphase.remove(1);
+				CHECK_TRUE(!broadphase.contains(1), "Erased by remove");
+				bool paired = false;
+				for (size_t tick = 0; tick < 3; tick++)
+				{
+					broadphase.set(0, Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f)));
+					broadphase.set(2, Geometry::AABB(glm::vec3(static_cast<float>(tick) * 0.1f), glm::vec3(1.f + static_cast<float>(tick) * 0.1f)));
+					for (const auto& [ID_1, ID_2] : broadphase.find_pairs())
+						paired |= ID_1 == 1 || ID_2 == 1;
+				}
+				CHECK_TRUE(!paired, "Removed proxy in no later pairs");
+				CHECK_EQUAL(broadphase.get_pairs().size(), 1, "The remaining proxies still pair");
+
+				for (size_t ID = 0; ID < 3; ID++)
+					broadphase.set(ID, Geometry::AABB(glm::vec3(static_cast<float>(ID) * 0.5f), glm::vec3(static_cast<float>(ID) * 0.5f + 1.f)));
+				CHECK_EQUAL(broadphase.find_pairs().size(), 3, "Paired again once set");
+			}
+		}
+		{SCOPE_SECTION("Filter");
+			Geometry::SweepAndPrune broadphase;
+			const auto pairs = find_filtered_pairs(broadphase);
+			CHECK_EQUAL(pairs.size(), 2, "Static pair and masked out pairs skipped");
+			CHECK_TRUE(pairs == Filtered_Pairs, "Only the default layer body pairs with the floors");
+		}
+		{SCOPE_SECTION("Match brute force");
+			// Random boxes moving in small steps every tick, exercising the insertion sort and the sweep axis changing as the spread shifts.
+			constexpr size_t box_count = 500;
+			const auto positions  = Utility::get_random_numbers(-20.f, 20.f, box_count * 3);
+			const auto velocities = Utility::get_random_numbers(-0.5f, 0.5f, box_count * 3);
+			const auto sizes      = Utility::get_random_numbers(0.1f, 2.f, box_count);
+
+			Geometry::SweepAndPrune broadphase;
+			std::vector<Geometry::AABB> AABBs(box_count);
+			bool all_match = true;
+
+			for (size_t tick = 0; tick < 20; tick++)
+			{
+				for (size_t i = 0; i < box_count; i++)
+				{
+					// Stretch the boxes along y over time to force a change in sweep axis.
+					const auto position = glm::vec3(positions[i * 3], positions[i * 3 + 1] * (1.f + tick), positions[i * 3 + 2]) + glm::vec3(velocities[i * 3], velocities[i * 3 + 1], velocities[i * 3 + 2]) * static_cast<float>(tick);
+					AABBs[i] = Geometry::AABB(position, position + glm::vec3(sizes[i]));
+					broadphase.set(i, AABBs[i]);
+				}
+
+				auto pairs = broadphase.find_pairs();
+				std::sort(pairs.begin(), pairs.end());
+				all_match &= pairs == get_overlapping_pairs(AABBs);
+			}
+
+			CHECK_TRUE(all_match, "Pairs match brute force every tick");
+			CHECK_EQUAL(broadphase.get_sweep_axis(), 1, "Sweep axis moved to the axis of greatest spread");
+		}
+	}
+
+	void GeometryTester::run_spatial_hash_grid_tests()
+	{SCOPE_SECTION("Spatial hash grid")
+		{SCOPE_SECTION("Pairs");
+			Geometry::SpatialHashGrid grid(1.f);
+			grid.set(0, Geometry::AABB(glm::vec3(0.f), glm::vec3(1.5f)));
+			grid.set(1, Geometry::AABB(glm::vec3(0.5f), glm::vec3(2.5f))); // Shares 8 cells with 0, output once.
+			grid.set(2, Geometry::AABB(glm::vec3(5.f), glm::vec3(6.f)));
+
+			auto pairs = grid.find_pairs();
+			CHECK_EQUAL(pairs.size(), 1, "One overlapping pair");
+			CHECK_TRUE(pairs.front() == std::make_pair(size_t(0), size_t(1)), "Pair lower ID first");
+
+			{SCOPE_SECTION("Proxies not set are removed");
+				grid.set(1, Geometry::AABB(glm::vec3(5.5f), glm::vec3(6.5f)));
+				grid.set(2, Geometry::AABB(glm::vec3(5.f), glm::vec3(6.f)));
+				pairs = grid.find_pairs();
+				CHECK_EQUAL(grid.size(), 2, "Proxy 0 removed");
+				CHECK_EQUAL(pairs.size(), 1, "One overlapping pair");
+				CHECK_TRUE(pairs.front() == std::make_pair(size_t(1), size_t(2)), "Moved proxy overlaps");
+			}
+			{SCOPE_SECTION("Keep");
+				// Proxy 2 keeps the AABB it was last set with, e.g. a sleeping body.
+				grid.set(1, Geometry::AABB(glm::vec3(5.5f), glm::vec3(6.5f)));
+				grid.keep(2);
+				pairs = grid.find_pairs();
+				CHECK_TRUE(grid.contains(2) && !grid.contains(0), "Kept proxy not removed");
+				CHECK_EQUAL(pairs.size(), 1, "Kept proxy still pairs");
+			}
+			{SCOPE_SECTION("Remove");
+				grid.set(1, Geometry::AABB(glm::vec3(5.5f), glm::vec3(6.5f)));
+				grid.set(2, Geometry::AABB(glm::vec3(5.f), glm::vec3(6.f)));
+				grid.remove(2);
+				CHECK_TRUE(grid.find_pairs().empty(), "No pairs after remove");
+			}
+		}
+		{SCOPE_SECTION("Filter");
+			Geometry::SpatialHashGrid grid(1.f);
+			const auto pairs = find_filtered_pairs(grid);
+			CHECK_EQUAL(pairs.size(), 2, "Static pair and masked out pairs skipped");
+			CHECK_TRUE(pairs == Filtered_Pairs, "Only the default layer body pairs with the floors");
+		}
+		{SCOPE_SECTION("Match brute force");
+			// Many equal sized boxes plus a floor spanning many cells, serial and on a ThreadPool and across a cell size change.
+			constexpr size_t box_count = 3000;
+			const auto positions = Utility::get_random_numbers(-15.f, 15.f, box_count * 3);
+
+			std::vector<Geometry::AABB> AABBs(box_count);
+			for (size_t i = 0; i < box_count - 1; i++)
+			{
+				const auto position = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+				AABBs[i] = Geometry::AABB(position, position + glm::vec3(1.f));
+			}
+			AABBs.back() = Geometry::AABB(glm::vec3(-20.f, -16.f, -20.f), glm::vec3(20.f, -14.f, 20.f));
+			const auto expected = get_overlapping_pairs(AABBs);
+
+			Utility::ThreadPool thread_pool(4);
+			for (Utility::ThreadPool* pool : {static_cast<Utility::ThreadPool*>(nullptr), &thread_pool})
+			{
+				const std::string threading = pool ? "on a ThreadPool" : "serial";
+				Geometry::SpatialHashGrid grid(1.5f);
+				for (size_t i = 0; i < box_count; i++)
+					grid.set(i, AABBs[i]);
+				CHECK_TRUE(grid.find_pairs(pool) == expected, std::format("Pairs match brute force {}", threading));
+
+				grid.set_cell_size(4.f);
+				for (size_t i = 0; i < box_count; i++)
+					grid.set(i, AABBs[i]);
+				CHECK_TRUE(grid.find_pairs(pool) == expected, std::format("Pairs match brute force {} after cell size change", threading));
+			}
+		}
+	}
+
+	// Query p_tree with p_shape and filter the conservative results with an exact test against p_AABBs, sorted to compare against brute force.
+	template <typename Shape>
+	static std::vector<size_t> query_exact(const Geometry::AABBTree& p_tree, const std::vector<Geometry::AABB>& p_AABBs, const Shape& p_shape)
+	{
+		std::vector<size_t> hits;
+		p_tree.query(p_shape, [&](const size_t& p_ID)
+		{
+			if (Geometry::intersecting(p_AABBs[p_ID], p_shape))
+				hits.push_back(p_ID);
+		});
+		std::sort(hits.begin(), hits.end());
+		return hits;
+	}
+	template <typename Shape>
+	static std::vector<size_t> brute_force_exact(const std::vector<Geometry::AABB>& p_AABBs, const Shape& p_shape)
+	{
+		std::vector<size_t> hits;
+		for (size_t i = 0; i < p_AABBs.size(); i++)
+			if (Geometry::intersecting(p_AABBs[i], p_shape))
+				hits.push_back(i);
+		return hits;
+	}
+
+	// The squared distances from p_point to its p_count nearest AABBs found with a k nearest query_nearest search, nearest first.
+	// Distances are compared against brute force rather than IDs as equally distant AABBs can be found in either order.
+	static std::vector<float> query_nearest(const Geometry::AABBTree& p_tree, const std::vector<Geometry::AABB>& p_AABBs, const glm::vec3& p_point, const size_t& p_count)
+	{
+		std::vector<float> nearest;
+		p_tree.query_nearest(p_point, std::numeric_limits<float>::max(), [&](const size_t& p_ID)
+		{
+			const float distance_squared = Geometry::distance_squared(p_AABBs[p_ID], p_point);
+			nearest.insert(std::upper_bound(nearest.begin(), nearest.end(), distance_squared), distance_squared);
+			if (nearest.size() > p_count)
+				nearest.pop_back();
+			return nearest.size() == p_count ? nearest.back() : std::numeric_limits<float>::max();
+		});
+		return nearest;
+	}
+	static std::vector<float> brute_force_nearest(const std::vector<Geometry::AABB>& p_AABBs, const glm::vec3& p_point, const size_t& p_count)
+	{
+		std::vector<float> nearest;
+		for (const auto& AABB : p_AABBs)
+			nearest.push_back(Geometry::distance_squared(AABB, p_point));
+		std::sort(nearest.begin(), nearest.end());
+		nearest.resize(p_count);
+		return nearest;
+	}
+
+	void GeometryTester::run_AABB_tree_tests()
+	{SCOPE_SECTION("AABB tree")
+		{SCOPE_SECTION("Fat AABB");
+			Geometry::AABBTree tree(0.5f);
+			CHECK_TRUE(tree.set(0, Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f))), "Insert changes the tree");
+			CHECK_EQUAL(tree.get_fat_AABB(0).m_min, glm::vec3(-0.5f), "Fat min");
+			CHECK_EQUAL(tree.get_fat_AABB(0).m_max, glm::vec3(1.5f), "Fat max");
+			CHECK_TRUE(!tree.set(0, Geometry::AABB(glm::vec3(0.25f), glm::vec3(1.25f))), "Small move stays inside the fat AABB");
+			CHECK_TRUE(tree.set(0, Geometry::AABB(glm::vec3(2.f), glm::vec3(3.f))), "Large move reinserts");
+			CHECK_EQUAL(tree.get_fat_AABB(0).m_min, glm::vec3(1.5f), "Fat min after reinsert");
+			CHECK_EQUAL(tree.get_bound().m_max, glm::vec3(3.5f), "Bound is the root");
+		}
+		{SCOPE_SECTION("Remove");
+			Geometry::AABBTree tree;
+			tree.set(0, Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f)));
+			tree.set(1, Geometry::AABB(glm::vec3(2.f), glm::vec3(3.f)));
+			tree.set(2, Geometry::AABB(glm::vec3(4.f), glm::vec3(5.f)));
+			tree.remove(1);
+			CHECK_EQUAL(tree.size(), 2, "Removed");
+			CHECK_TRUE(!tree.contains(1), "Does not contain removed");
+
+			tree.remove_unset(); // Clears the set flags of the insert.
+			tree.set(2, Geometry::AABB(glm::vec3(4.f), glm::vec3(5.f)));
+			tree.remove_unset();
+			CHECK_EQUAL(tree.size(), 1, "Unset proxy removed");
+			CHECK_TRUE(tree.contains(2), "Set proxy kept");
+			tree.keep(2);
+			tree.remove_unset();
+			CHECK_TRUE(tree.contains(2), "Kept proxy not removed");
+
+			tree.remove(2);
+			CHECK_EQUAL(tree.size(), 0, "Empty");
+			CHECK_EQUAL(tree.get_height(), 0, "Empty height");
+		}
+		{SCOPE_SECTION("Match brute force");
+			// Random boxes moving every tick, a quarter jump far enough to be reinserted. Queries are compared after each tick.
+			constexpr size_t box_count = 1000;
+			const auto positions  = Utility::get_random_numbers(-50.f, 50.f, box_count * 3);
+			const auto velocities = Utility::get_random_numbers(-0.5f, 0.5f, box_count * 3);
+			const auto sizes      = Utility::get_random_numbers(0.1f, 3.f, box_count);
+			const auto queries    = Utility::get_random_numbers(-50.f, 50.f, 20 * 6);
+
+			Geometry::AABBTree tree;
+			std::vector<Geometry::AABB> AABBs(box_count);
+			bool AABB_match     = true;
+			bool ray_match      = true;
+			bool frustrum_match = true;
+			bool sphere_match   = true;
+			bool nearest_match  = true;
+			bool bound_encloses = true;
+			int max_height      = 0;
+
+			for (size_t tick = 0; tick < 20; tick++)
+			{
+				for (size_t i = 0; i < box_count; i++)
+				{
+					const float speed   = i % 4 == 0 ? 10.f : 1.f;
+					const auto position = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]) + glm::vec3(velocities[i * 3], velocities[i * 3 + 1], velocities[i * 3 + 2]) * speed * static_cast<float>(tick);
+					AABBs[i] = Geometry::AABB(position, position + glm::vec3(sizes[i]));
+					tree.set(i, AABBs[i]);
+				}
+				max_height = std::max(max_height, tree.get_height());
+
+				const auto bound = tree.get_bound();
+				for (const auto& AABB : AABBs)
+					bound_encloses &= glm::all(glm::lessThanEqual(bound.m_min, AABB.m_min)) && glm::all(glm::greaterThanEqual(bound.m_max, AABB.m_max));
+
+				const auto point = glm::vec3(queries[tick * 6], queries[tick * 6 + 1], queries[tick * 6 + 2]);
+				const auto other = glm::vec3(queries[tick * 6 + 3], queries[tick * 6 + 4], queries[tick * 6 + 5]);
+
+				const auto query_AABB = Geometry::AABB(glm::min(point, other) * 0.25f, glm::max(point, other) * 0.25f);
+				AABB_match &= query_exact(tree, AABBs, query_AABB) == brute_force_exact(AABBs, query_AABB);
+
+				const auto ray = Geometry::Ray(point, other - point);
+				ray_match &= query_exact(tree, AABBs, ray) == brute_force_exact(AABBs, ray);
+
+				const auto frustrum = Geometry::Frustrum(glm::perspective(glm::radians(60.f), 1.f, 0.1f, 40.f) * glm::lookAt(point, other, glm::vec3(0.f, 1.f, 0.f)));
+				frustrum_match &= query_exact(tree, AABBs, frustrum) == brute_force_exact(AABBs, frustrum);
+
+				const auto sphere = Geometry::Sphere(point * 0.25f, 8.f);
+				sphere_match &= query_exact(tree, AABBs, sphere) == brute_force_exact(AABBs, sphere);
+
+				nearest_match &= query_nearest(tree, AABBs, point, 8) == brute_force_nearest(AABBs, point, 8);
+			}
+
+			CHECK_TRUE(AABB_match, "AABB queries match brute force");
+			CHECK_TRUE(ray_match, "Ray queries match brute force");
+			CHECK_TRUE(frustrum_match, "Frustrum queries match brute force");
+			CHECK_TRUE(sphere_match, "Sphere queries match brute force");
+			CHECK_TRUE(nearest_match, "Nearest queries match brute force");
+			CHECK_TRUE(bound_encloses, "Bound encloses every AABB");
+			CHECK_TRUE(max_height <= 20, "Tree stays balanced"); // log2(1000) ~ 10, AVL balancing keeps the height within a small factor.
+		}
+	}
+
+	void GeometryTester::run_rigid_body_integrator_tests()
+	{SCOPE_SECTION("Rigid body integrator")
+		{SCOPE_SECTION("Single body");
+			Geometry::RigidBodyBatch bodies;
+			bodies.resize(1);
+			bodies.m_force.set(0, glm::vec3(0.f, -19.62f, 0.f));
+			bodies.m_torque.set(0, glm::vec3(0.f));
+			bodies.m_mass[0] = 2.f;
+			for (size_t element = 0; element < 9; element++)
+				bodies.m_inverse_inertia_tensor[element][0] = element % 4 == 0 ? 1.f : 0.f; // Identity
+			bodies.m_position.set(0, glm::vec3(1.f, 2.f, 3.f));
+			bodies.m_momentum.set(0, glm::vec3(0.f));
+			bodies.m_angular_momentum.set(0, glm::vec3(0.f));
+			bodies.m_orientation.set(0, glm::identity<glm::quat>());
+
+			Geometry::integrate(bodies, 0.5f, Geometry::IntegrationMode::Scalar, 0, 1);
+			CHECK_TRUE(bodies.m_momentum.get(0) == glm::vec3(0.f, -9.81f, 0.f), "Momentum dp = F dt");
+			CHECK_TRUE(bodies.m_velocity.get(0) == glm::vec3(0.f, -4.905f, 0.f), "Velocity v = p / m");
+			CHECK_TRUE(bodies.m_position.get(0) == glm::vec3(1.f, 2.f - 4.905f * 0.5f, 3.f), "Position dx = v dt");
+			CHECK_TRUE(bodies.m_orientation.get(0) == glm::identity<glm::quat>(), "No angular momentum keeps orientation");
+			CHECK_TRUE(bodies.m_direction.get(0) == glm::vec3(0.f, 0.f, -1.f), "Direction");
+
+			{SCOPE_SECTION("Spin");
+				// Spinning about Y at 1 rad/s for 0.01s rotates the forward direction towards -X.
+				bodies.m_angular_momentum.set(0, glm::vec3(0.f, 1.f, 0.f));
+				Geometry::integrate(bodies, 0.01f, Geometry::IntegrationMode::Scalar, 0, 1);
+				const auto orientation = bodies.m_orientation.get(0);
+				const auto direction   = bodies.m_direction.get(0);
+				CHECK_TRUE(std::abs(glm::length(orientation) - 1.f) < 1e-6f, "Orientation normalized");
+				CHECK_TRUE(std::abs(direction.x + std::sin(0.01f)) < 1e-6f && std::abs(direction.z + std::cos(0.01f)) < 1e-6f, "Direction rotated about Y");
+				CHECK_TRUE(glm::length(direction - orientation * glm::vec3(0.f, 0.f, -1.f)) < 1e-6f, "Direction is the rotated forward");
+			}
+			{SCOPE_SECTION("Angular velocity");
+				// ω = I⁻¹ L with I⁻¹ column major, an asymmetric matrix catches the transposed product L I⁻¹.
+				const auto inverse_inertia = glm::mat3(glm::vec3(1.f, 2.f, 3.f), glm::vec3(4.f, 5.f, 6.f), glm::vec3(7.f, 8.f, 9.f));
+				for (int column = 0; column < 3; column++)
+					for (int row = 0; row < 3; row++)
+						bodies.m_inverse_inertia_tensor[column * 3 + row][0] = inverse_inertia[column][row];
+				bodies.m_angular_momentum.set(0, glm::vec3(1.f, 0.f, 0.f));
+				Geometry::integrate(bodies, 0.f, Geometry::IntegrationMode::Scalar, 0, 1);
+				CHECK_TRUE(bodies.m_angular_velocity.get(0) == glm::vec3(1.f, 2.f, 3.f), "ω = I⁻¹ L");
+			}
+		}
+		{SCOPE_SECTION("SIMD matches scalar");
+			// Random bodies integrated over many steps in both modes, a count not divisible by the SIMD width to cover the scalar remainder.
+			constexpr size_t body_count = 1003;
+			constexpr size_t step_count = 100;
+			const auto values = Utility::get_random_numbers(-10.f, 10.f, body_count * 19);
+
+			Geometry::RigidBodyBatch scalar_bodies;
+			scalar_bodies.resize(body_count);
+			for (size_t i = 0; i < body_count; i++)
+			{
+				const float* v = &values[i * 19];
+				scalar_bodies.m_force.set(i, glm::vec3(v[0], v[1], v[2]));
+				scalar_bodies.m_torque.set(i, glm::vec3(v[3], v[4], v[5]) * 0.1f);
+				scalar_bodies.m_mass[i] = std::abs(v[9]) + 0.1f;
+				const auto inverse_inertia = glm::inverse(Geometry::cuboid_inertia_tensor(scalar_bodies.m_mass[i], std::abs(v[10]) + 0.1f, std::abs(v[11]) + 0.1f, std::abs(v[12]) + 0.1f));
+				for (int column = 0; column < 3; column++)
+					for (int row = 0; row < 3; row++)
+						scalar_bodies.m_inverse_inertia_tensor[column * 3 + row][i] = inverse_inertia[column][row];
+				scalar_bodies.m_position.set(i, glm::vec3(v[13], v[14], v[15]));
+				scalar_bodies.m_momentum.set(i, glm::vec3(0.f));
+				scalar_bodies.m_angular_momentum.set(i, glm::vec3(v[16], v[17], v[18]));
+				scalar_bodies.m_orientation.set(i, glm::normalize(glm::quat(v[0], v[16], v[17], v[18])));
+			}
+			auto SIMD_bodies = scalar_bodies;
+
+			for (size_t step = 0; step < step_count; step++)
+			{
+				Geometry::integrate(scalar_bodies, 1.f / 60.f, Geometry::IntegrationMode::Scalar, 0, body_count);
+				// Uneven ranges as a ThreadPool would split the bodies.
+				Geometry::integrate(SIMD_bodies, 1.f / 60.f, Geometry::IntegrationMode::SIMD, 0, 333);
+				Geometry::integrate(SIMD_bodies, 1.f / 60.f, Geometry::IntegrationMode::SIMD, 333, body_count);
+			}
+
+			auto bitwise_equal = [](const auto& p_lhs, const auto& p_rhs)
+			{
+				return p_lhs.size() == p_rhs.size() && std::memcmp(p_lhs.data(), p_rhs.data(), p_lhs.size() * sizeof(p_lhs[0])) == 0;
+			};
+			CHECK_TRUE(bitwise_equal(scalar_bodies.m_position.x, SIMD_bodies.m_position.x) && bitwise_equal(scalar_bodies.m_position.y, SIMD_bodies.m_position.y) && bitwise_equal(scalar_bodies.m_position.z, SIMD_bodies.m_position.z), "Position");
+			CHECK_TRUE(bitwise_equal(scalar_bodies.m_velocity.x, SIMD_bodies.m_velocity.x) && bitwise_equal(scalar_bodies.m_velocity.y, SIMD_bodies.m_velocity.y) && bitwise_equal(scalar_bodies.m_velocity.z, SIMD_bodies.m_velocity.z), "Velocity");
+			CHECK_TRUE(bitwise_equal(scalar_bodies.m_angular_velocity.x, SIMD_bodies.m_angular_velocity.x) && bitwise_equal(scalar_bodies.m_angular_velocity.y, SIMD_bodies.m_angular_velocity.y) && bitwise_equal(scalar_bodies.m_angular_velocity.z, SIMD_bodies.m_angular_velocity.z), "Angular velocity");
+			CHECK_TRUE(bitwise_equal(scalar_bodies.m_orientation.w, SIMD_bodies.m_orientation.w) && bitwise_equal(scalar_bodies.m_orientation.x, SIMD_bodies.m_orientation.x) && bitwise_equal(scalar_bodies.m_orientation.y, SIMD_bodies.m_orientation.y) && bitwise_equal(scalar_bodies.m_orientation.z, SIMD_bodies.m_orientation.z), "Orientation");
+			CHECK_TRUE(bitwise_equal(scalar_bodies.m_direction.x, SIMD_bodies.m_direction.x) && bitwise_equal(scalar_bodies.m_direction.y, SIMD_bodies.m_direction.y) && bitwise_equal(scalar_bodies.m_direction.z, SIMD_bodies.m_direction.z), "Direction");
+		}
+	}
+
+	void GeometryTester::run_transform_batch_tests()
+	{SCOPE_SECTION("Transform batch")
+		// Random transforms, a count not divisible by the SIMD width to cover the scalar remainder.
+		constexpr size_t transform_count = 1003;
+		const auto values = Utility::get_random_numbers(-10.f, 10.f, transform_count * 16);
+
+		Geometry::TransformBatch scalar_transforms;
+		scalar_transforms.resize(transform_count);
+		for (size_t i = 0; i < transform_count; i++)
+		{
+			const float* v = &values[i * 16];
+			scalar_transforms.m_position.set(i, glm::vec3(v[0], v[1], v[2]));
+			scalar_transforms.m_orientation.set(i, glm::normalize(glm::quat(v[3], v[4], v[5], v[6])));
+			scalar_transforms.m_scale.set(i, glm::abs(glm::vec3(v[7], v[8], v[9])) + glm::vec3(0.1f));
+			const auto corner_1 = glm::vec3(v[10], v[11], v[12]);
+			const auto corner_2 = glm::vec3(v[13], v[14], v[15]);
+			scalar_transforms.m_local_AABB_min.set(i, glm::min(corner_1, corner_2));
+			scalar_transforms.m_local_AABB_max.set(i, glm::max(corner_1, corner_2));
+		}
+		auto SIMD_transforms = scalar_transforms;
+
+		Geometry::build_transforms(scalar_transforms, Geometry::TransformMode::Scalar, 0, transform_count);
+		// Uneven ranges as a ThreadPool would split the transforms.
+		Geometry::build_transforms(SIMD_transforms, Geometry::TransformMode::SIMD, 0, 333);
+		Geometry::build_transforms(SIMD_transforms, Geometry::TransformMode::SIMD, 333, transform_count);
+
+		{SCOPE_SECTION("Matches AABB transform");
+			// The scalar path is the reference, it matches glm and AABB::transform to within rounding.
+			bool model_match = true;
+			bool AABB_match  = true;
+			for (size_t i = 0; i < transform_count; i++)
+			{
+				const auto model = glm::scale(glm::translate(glm::identity<glm::mat4>(), scalar_transforms.m_position.get(i)) * glm::mat4_cast(scalar_transforms.m_orientation.get(i)), scalar_transforms.m_scale.get(i));
+				for (int column = 0; column < 4; column++)
+					model_match &= glm::length(model[column] - scalar_transforms.m_model[i][column]) < 1e-4f;
+
+				const auto world_AABB = Geometry::AABB::transform(Geometry::AABB(scalar_transforms.m_local_AABB_min.get(i), scalar_transforms.m_local_AABB_max.get(i)), model);
+				AABB_match &= glm::length(world_AABB.m_min - scalar_transforms.m_world_AABB_min.get(i)) < 1e-3f
+				           && glm::length(world_AABB.m_max - scalar_transforms.m_world_AABB_max.get(i)) < 1e-3f;
+			}
+			CHECK_TRUE(model_match, "Model");
+			CHECK_TRUE(AABB_match, "World AABB");
+		}
+		{SCOPE_SECTION("SIMD matches scalar");
+			auto bitwise_equal = [](const auto& p_lhs, const auto& p_rhs)
+			{
+				return p_lhs.size() == p_rhs.size() && std::memcmp(p_lhs.data(), p_rhs.data(), p_lhs.size() * sizeof(p_lhs[0])) == 0;
+			};
+			CHECK_TRUE(bitwise_equal(scalar_transforms.m_model, SIMD_transforms.m_model), "Model");
+			CHECK_TRUE(bitwise_equal(scalar_transforms.m_world_AABB_min.x, SIMD_transforms.m_world_AABB_min.x) && bitwise_equal(scalar_transforms.m_world_AABB_min.y, SIMD_transforms.m_world_AABB_min.y) && bitwise_equal(scalar_transforms.m_world_AABB_min.z, SIMD_transforms.m_world_AABB_min.z), "World AABB min");
+			CHECK_TRUE(bitwise_equal(scalar_transforms.m_world_AABB_max.x, SIMD_transforms.m_world_AABB_max.x) && bitwise_equal(scalar_transforms.m_world_AABB_max.y, SIMD_transforms.m_world_AABB_max.y) && bitwise_equal(scalar_transforms.m_world_AABB_max.z, SIMD_transforms.m_world_AABB_max.z), "World AABB max");
+		}
+	}
+
+	void GeometryTester::run_batch_intersecting_tests()
+	{SCOPE_SECTION("Batch intersecting")
+		// Random AABBs, a count not divisible by the SIMD width or 64 to cover the scalar remainder and a partial last hit mask word.
+		constexpr size_t AABB_count = 1003;
+		const auto values = Utility::get_random_numbers(-20.f, 20.f, AABB_count * 6);
+
+		std::vector<Geometry::AABB> AABBs;
+		std::array<std::vector<float>, 6> components; // min x, y, z then max x, y, z.
+		for (size_t i = 0; i < AABB_count; i++)
+		{
+			const auto corner_1 = glm::vec3(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]);
+			const auto corner_2 = corner_1 + glm::abs(glm::vec3(values[i * 6 + 3], values[i * 6 + 4], values[i * 6 + 5])) * 0.1f;
+			const auto& AABB    = AABBs.emplace_back(corner_1, corner_2);
+			for (int axis = 0; axis < 3; axis++)
+			{
+				components[axis].push_back(AABB.m_min[axis]);
+				components[axis + 3].push_back(AABB.m_max[axis]);
+			}
+		}
+		const Geometry::AABBArray AABB_array = {components[0], components[1], components[2], components[3], components[4], components[5]};
+		std::vector<uint64_t> hits(Geometry::hit_mask_size(AABB_count), ~uint64_t(0)); // Set to check every bit is written.
+
+		// Check the hit mask and count against the scalar intersecting function for every AABB.
+		auto matches_scalar = [&](const auto& p_shape, const size_t& p_count)
+		{
+			size_t count = 0;
+			bool match   = true;
+			for (size_t i = 0; i < AABB_count; i++)
+			{
+				const bool intersecting = Geometry::intersecting(AABBs[i], p_shape);
+				count += intersecting ? 1 : 0;
+				match &= intersecting == ((hits[i / 64] >> (i % 64)) & 1u);
+			}
+			match &= (hits.back() >> (AABB_count % 64)) == 0; // Bits past the last AABB are cleared.
+			return match && count == p_count;
+		};
+
+		{SCOPE_SECTION("AABB");
+			const auto AABB  = Geometry::AABB(glm::vec3(-5.f), glm::vec3(5.f));
+			const auto count = Geometry::intersecting(AABB, AABB_array, hits);
+			CHECK_TRUE(count > 0 && count < AABB_count, "Hits some");
+			CHECK_TRUE(matches_scalar(AABB, count), "Matches scalar");
+		}
+		{SCOPE_SECTION("Frustrum");
+			const auto frustrum = Geometry::Frustrum(glm::perspective(glm::radians(60.f), 1.f, 0.1f, 15.f) * glm::lookAt(glm::vec3(0.f, 0.f, 10.f), glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f)));
+			const auto count    = Geometry::intersecting(frustrum, AABB_array, hits);
+			CHECK_TRUE(count > 0 && count < AABB_count, "Hits some");
+			CHECK_TRUE(matches_scalar(frustrum, count), "Matches scalar");
+		}
+		{SCOPE_SECTION("Sphere");
+			const auto sphere = Geometry::Sphere(glm::vec3(2.f, -3.f, 1.f), 8.f);
+			const auto count  = Geometry::intersecting(sphere, AABB_array, hits);
+			CHECK_TRUE(count > 0 && count < AABB_count, "Hits some");
+			CHECK_TRUE(matches_scalar(sphere, count), "Matches scalar");
+
+			{SCOPE_SECTION("Hit indices");
+				std::vector<uint32_t> expected;
+				for (uint32_t i = 0; i < AABB_count; i++)
+					if (Geometry::intersecting(AABBs[i], sphere))
+						expected.push_back(i);
+
+				std::vector<uint32_t> indices(AABB_count);
+				indices.resize(Geometry::hit_indices(hits, indices));
+				CHECK_TRUE(indices == expected, "Ascending hit indices");
+
+				std::array<uint32_t, 4> first_indices;
+				CHECK_EQUAL(Geometry::hit_indices(hits, first_indices), expected.size(), "Count past the end of indices");
+				const bool first_match = std::equal(first_indices.begin(), first_indices.end(), expected.begin());
+				CHECK_TRUE(first_match, "Indices truncated");
+			}
+		}
+		{SCOPE_SECTION("Empty");
+			const Geometry::AABBArray empty;
+			CHECK_EQUAL(Geometry::intersecting(Geometry::AABB(glm::vec3(-5.f), glm::vec3(5.f)), empty, std::span<uint64_t>()), size_t(0), "No hits");
+		}
+	}
+
+	void GeometryTester::run_GJK_tests()
+	{SCOPE_SECTION("GJK");
+		const auto identity = glm::identity<glm::mat3>();
+		auto near = [](const glm::vec3& p_a, const glm::vec3& p_b) { return glm::length(p_a - p_b) < 1e-3f; };
+
+		{SCOPE_SECTION("Sphere v Sphere");
+			// Matches the analytic Sphere v Sphere get_intersection to within the precision EPA approximates curved surfaces.
+			const auto sphere_1 = Geometry::Shape(Geometry::Sphere(glm::vec3(0.f), 1.25f));
+			const auto sphere_2 = Geometry::Shape(Geometry::Sphere(glm::vec3(2.f, 0.f, 0.f), 1.25f));
+			const auto manifold = Geometry::get_contact_manifold({sphere_1, identity, glm::vec3(0.f)}, {sphere_2, identity, glm::vec3(0.f)});
+			CHECK_TRUE(manifold.has_value(), "get_contact_manifold");
+			if (manifold)
+			{
+				CHECK_EQUAL(manifold->m_count, size_t(1), "Curved surfaces touch at one point");
+				CHECK_TRUE(glm::length(manifold->m_points[0].position - glm::vec3(1.25f, 0.f, 0.f)) < 1e-2f, "Position");
+				CHECK_TRUE(glm::length(manifold->m_points[0].normal - glm::vec3(-1.f, 0.f, 0.f)) < 1e-2f, "Normal");
+				CHECK_TRUE(std::abs(manifold->m_points[0].penetration_depth - 0.5f) < 1e-3f, "Penetration depth");
+			}
+		}
+		{SCOPE_SECTION("Separated");
+			const auto cuboid = Geometry::Shape(Geometry::Cuboid(glm::vec3(0.f), glm::vec3(2.f)));
+			const auto sphere = Geometry::Shape(Geometry::Sphere(glm::vec3(0.f), 1.f));
+			CHECK_TRUE(!Geometry::intersecting({cuboid, identity, glm::vec3(0.f)}, {sphere, identity, glm::vec3(2.1f, 0.f, 0.f)}), "intersecting");
+			CHECK_TRUE(!Geometry::get_contact_manifold({cuboid, identity, glm::vec3(0.f)}, {sphere, identity, glm::vec3(1.7f, 1.7f, 1.7f)}).has_value(), "Sphere beyond the corner");
+			CHECK_TRUE(Geometry::intersecting({cuboid, identity, glm::vec3(0.f)}, {sphere, identity, glm::vec3(1.9f, 0.f, 0.f)}), "Overlapping");
+		}
+		{SCOPE_SECTION("Cuboid resting on cuboid");
+			// Unit mesh cuboids transformed the same way PhysicsSystem transforms Data::Mesh::collision_shapes.
+			// The top cuboid sinks 0.1 into a wider bottom cuboid, the whole bottom face of the top cuboid is in contact.
+			const auto cuboid = Geometry::Shape(Geometry::Cuboid(glm::vec3(0.f), glm::vec3(2.f)));
+			const auto top    = Geometry::ConvexShape{cuboid, identity * 0.5f, glm::vec3(0.2f, 1.9f - 0.5f, -0.1f)};
+			const auto bottom = Geometry::ConvexShape{cuboid, glm::mat3(glm::vec3(4.f, 0.f, 0.f), glm::vec3(0.f, 1.f, 0.f), glm::vec3(0.f, 0.f, 4.f)), glm::vec3(0.f)};
+
+			const auto manifold = Geometry::get_contact_manifold(top, bottom);
+			CHECK_TRUE(manifold.has_value(), "get_contact_manifold");
+			if (manifold)
+			{
+				CHECK_EQUAL(manifold->m_count, size_t(4), "Four corners");
+				bool all_correct = true;
+				for (const auto& point : *manifold)
+					all_correct &= near(point.normal, glm::vec3(0.f, 1.f, 0.f)) && std::abs(point.penetration_depth - 0.1f) < 1e-3f && std::abs(point.position.y - 0.9f) < 1e-3f
+						&& std::abs(std::abs(point.position.x - 0.2f) - 0.5f) < 1e-3f && std::abs(std::abs(point.position.z + 0.1f) - 0.5f) < 1e-3f;
+				CHECK_TRUE(all_correct, "Points on the bottom face of the top cuboid pushed up");
+			}
+
+			const auto swapped = Geometry::get_contact_manifold(bottom, top);
+			CHECK_TRUE(swapped.has_value() && swapped->m_count == 4 && near(swapped->m_points[0].normal, glm::vec3(0.f, -1.f, 0.f)) && std::abs(swapped->m_points[0].position.y - 1.f) < 1e-3f, "Swapped points on the top face of the bottom cuboid");
+		}
+		{SCOPE_SECTION("Cuboid corner on cuboid");
+			// Rotated about X and Z the lowest corner pokes into the ground alone.
+			const auto cuboid   = Geometry::Shape(Geometry::Cuboid(glm::vec3(0.f), glm::vec3(2.f)));
+			const auto rotation = glm::mat3_cast(glm::angleAxis(glm::radians(45.f), glm::vec3(1.f, 0.f, 0.f)) * glm::angleAxis(glm::radians(30.f), glm::vec3(0.f, 0.f, 1.f)));
+			auto lowest = rotation * glm::vec3(1.f);
+			for (int i = 0; i < 8; i++)
+			{
+				const auto corner = rotation * glm::vec3(i & 1 ? 1.f : -1.f, i & 2 ? 1.f : -1.f, i & 4 ? 1.f : -1.f);
+				if (corner.y < lowest.y)
+					lowest = corner;
+			}
+			const auto tilted   = Geometry::ConvexShape{cuboid, rotation, glm::vec3(0.f, -lowest.y + 1.f - 0.05f, 0.f)};
+			const auto ground   = Geometry::ConvexShape{cuboid, identity * 10.f, glm::vec3(0.f, -9.f, 0.f)};
+
+			const auto manifold = Geometry::get_contact_manifold(tilted, ground);
+			CHECK_TRUE(manifold.has_value() && manifold->m_count == 1, "One point");
+			if (manifold && manifold->m_count == 1)
+			{
+				CHECK_TRUE(near(manifold->m_points[0].normal, glm::vec3(0.f, 1.f, 0.f)), "Normal");
+				CHECK_TRUE(std::abs(manifold->m_points[0].penetration_depth - 0.05f) < 1e-3f, "Penetration depth");
+				CHECK_TRUE(near(manifold->m_points[0].position, lowest + tilted.m_translation), "Position at the corner");
+			}
+		}
+		{SCOPE_SECTION("Cylinder standing on quad");
+			const auto cylinder = Geometry::Shape(Geometry::Cylinder(glm::vec3(0.f, -1.f, 0.f), glm::vec3(0.f, 1.f, 0.f), 1.f));
+			const auto quad     = Geometry::Shape(Geometry::Quad(glm::vec3(-10.f, 0.f, -10.f), glm::vec3(10.f, 0.f, -10.f), glm::vec3(10.f, 0.f, 10.f), glm::vec3(-10.f, 0.f, 10.f)));
+			const auto manifold = Geometry::get_contact_manifold({cylinder, identity, glm::vec3(0.f, 0.98f, 0.f)}, {quad, identity, glm::vec3(0.f)});
+			CHECK_TRUE(manifold.has_value() && manifold->m_count == 4, "Four points on the cap rim");
+			if (manifold)
+			{
+				bool all_correct = true;
+				for (const auto& point : *manifold)
+					all_correct &= near(point.normal, glm::vec3(0.f, 1.f, 0.f)) && std::abs(point.penetration_depth - 0.02f) < 1e-3f && std::abs(glm::length(glm::vec3(point.position.x, 0.f, point.position.z)) - 1.f) < 1e-3f;
+				CHECK_TRUE(all_correct, "Contact info");
+			}
+		}
+		{SCOPE_SECTION("Time of impact");
+			// A unit cuboid moving 3m down in one step passes through the floor without ever overlapping it at either end.
+			const auto cuboid = Geometry::Shape(Geometry::Cuboid(glm::vec3(0.f), glm::vec3(1.f)));
+			const auto quad   = Geometry::Shape(Geometry::Quad(glm::vec3(-10.f, 0.f, -10.f), glm::vec3(10.f, 0.f, -10.f), glm::vec3(10.f, 0.f, 10.f), glm::vec3(-10.f, 0.f, 10.f)));
+			const auto floor  = Geometry::ConvexShape{quad, identity, glm::vec3(0.f)};
+			const auto moving = Geometry::ConvexShape{cuboid, identity, glm::vec3(0.f, 1.f, 0.f)};
+
+			const auto time = Geometry::time_of_impact(moving, glm::vec3(0.f, -3.f, 0.f), floor);
+			CHECK_TRUE(time.has_value(), "Hits the floor");
+			if (time)
+				CHECK_TRUE(std::abs(*time - 0.5f / 3.f) < 1e-3f && Geometry::intersecting({cuboid, identity, glm::vec3(0.f, 1.f - 3.f * *time, 0.f)}, floor), "Stopped touching the floor");
+
+			CHECK_TRUE(!Geometry::time_of_impact(moving, glm::vec3(0.f, 3.f, 0.f), floor).has_value(), "Moving away");
+			CHECK_TRUE(!Geometry::time_of_impact({cuboid, identity, glm::vec3(11.f, 1.f, 0.f)}, glm::vec3(0.f, -3.f, 0.f), floor).has_value(), "Passing beside");
+			CHECK_TRUE(!Geometry::time_of_impact({cuboid, identity, glm::vec3(0.f, 0.4f, 0.f)}, glm::vec3(3.f, 0.f, 0.f), floor).has_value(), "Already touching");
+
+			// A motion thousands of times the combined thickness still can't step over the floor.
+			const auto small_sphere = Geometry::Shape(Geometry::Sphere(glm::vec3(0.f), 0.01f));
+			const auto far_time     = Geometry::time_of_impact({small_sphere, identity, glm::vec3(0.f, 500.f, 0.f)}, glm::vec3(0.f, -1000.f, 0.f), floor);
+			CHECK_TRUE(far_time.has_value() && std::abs(*far_time - 499.99f / 1000.f) < 1e-5f, "Fast thin body hits the floor");
+		}
+	}
+
+	void GeometryTester::run_contact_solver_tests()
+	{SCOPE_SECTION("Contact solver");
+		{SCOPE_SECTION("Head on");
+			// Equal masses colliding head on with a restitution of 1 swap velocities.
+			Geometry::ContactSolver solver;
+			solver.m_restitution = 1.f;
+			std::vector<Geometry::SolverBody> bodies = {
+				{glm::vec3(-1.f, 0.f, 0.f), glm::vec3(2.f, 0.f, 0.f), glm::vec3(0.f), glm::identity<glm::mat3>(), 1.f},
+				{glm::vec3(1.f, 0.f, 0.f), glm::vec3(-2.f, 0.f, 0.f), glm::vec3(0.f), glm::identity<glm::mat3>(), 1.f}};
+
+			Geometry::ContactManifold manifold;
+			manifold.add({glm::vec3(0.f), glm::vec3(-1.f, 0.f, 0.f), 0.f});
+			solver.add_contact(0, 0, 1, manifold);
+			solver.solve(bodies, 1.f / 60.f);
+			CHECK_TRUE(glm::length(bodies[0].m_velocity - glm::vec3(-2.f, 0.f, 0.f)) < 1e-4f, "Body 1 velocity");
+			CHECK_TRUE(glm::length(bodies[1].m_velocity - glm::vec3(2.f, 0.f, 0.f)) < 1e-4f, "Body 2 velocity");
+			CHECK_TRUE(glm::length(bodies[0].m_angular_velocity) < 1e-4f && glm::length(bodies[1].m_angular_velocity) < 1e-4f, "No spin through the center of mass");
+		}
+		{SCOPE_SECTION("Stack settles");
+			// A stack of 4 unit cuboids dropped onto an immovable ground cuboid comes to rest with a low iteration budget.
+			constexpr size_t box_count  = 4;
+			constexpr float delta_time  = 1.f / 60.f;
+			const auto cuboid           = Geometry::Shape(Geometry::Cuboid(glm::vec3(0.f), glm::vec3(1.f)));
+			const auto ground_scale     = glm::vec3(20.f, 1.f, 20.f);
+			const auto inverse_inertia  = glm::inverse(Geometry::cuboid_inertia_tensor(1.f, 1.f, 1.f, 1.f));
+
+			Geometry::ContactSolver solver;
+			solver.m_iterations = 4;
+			std::vector<Geometry::SolverBody> bodies = {{glm::vec3(0.f, -0.5f, 0.f), glm::vec3(0.f), glm::vec3(0.f), glm::mat3(0.f), 0.f}};
+			std::vector<glm::quat> orientations = {glm::identity<glm::quat>()};
+			for (size_t i = 0; i < box_count; i++)
+			{
+				bodies.push_back({glm::vec3(0.02f * static_cast<float>(i), 0.55f + 1.05f * static_cast<float>(i), 0.f), glm::vec3(0.f), glm::vec3(0.f), inverse_inertia, 1.f});
+				orientations.push_back(glm::identity<glm::quat>());
+			}
+
+			auto world_shape = [&](const size_t& p_body)
+			{
+				auto linear = glm::mat3_cast(orientations[p_body]);
+				if (p_body == 0)
+				{
+					linear[0] *= ground_scale.x;
+					linear[1] *= ground_scale.y;
+					linear[2] *= ground_scale.z;
+				}
+				return Geometry::ConvexShape{cuboid, linear, bodies[p_body].m_position};
+			};
+
+			float max_speed = 0.f;
+			for (size_t step = 0; step < 600; step++)
+			{
+				for (size_t i = 1; i < bodies.size(); i++)
+					bodies[i].m_velocity += glm::vec3(0.f, -9.81f, 0.f) * delta_time;
+
+				for (size_t i = 0; i < bodies.size(); i++)
+					for (size_t j = i + 1; j < bodies.size(); j++)
+						if (const auto manifold = Geometry::get_contact_manifold(world_shape(j), world_shape(i)))
+							solver.add_contact((j << 32) | i, j, i, *manifold);
+				solver.solve(bodies, delta_time);
+
+				max_speed = 0.f;
+				for (size_t i = 1; i < bodies.size(); i++)
+				{
+					bodies[i].m_position += bodies[i].m_velocity * delta_time;
+					orientations[i] = glm::normalize(orientations[i] + (glm::quat(0.f, bodies[i].m_angular_velocity) * orientations[i]) * (0.5f * delta_time));
+					max_speed = std::max({max_speed, glm::length(bodies[i].m_velocity), glm::length(bodies[i].m_angular_velocity)});
+				}
+			}
+
+			CHECK_TRUE(max_speed < 0.05f, "At rest");
+			bool stacked = true;
+			for (size_t i = 1; i < bodies.size(); i++)
+				stacked &= std::abs(bodies[i].m_position.y - (static_cast<float>(i) - 0.5f)) < 0.05f * static_cast<float>(i);
+			CHECK_TRUE(stacked, "Boxes stacked on the ground");
+		}
+	}
+
+	void GeometryTester::run_triangle_BVH_tests()
+	{SCOPE_SECTION("Triangle BVH")
+		const auto triangle = Geometry::Triangle(glm::vec3(0.f, 0.f, 0.f), glm::vec3(2.f, 0.f, 0.f), glm::vec3(0.f, 0.f, 2.f));
+
+		{SCOPE_SECTION("Ray v Triangle");
+			float distance = 0.f;
+			const auto hit = Geometry::get_intersection(Geometry::Ray(glm::vec3(0.5f, 2.f, 0.5f), glm::vec3(0.f, -1.f, 0.f)), triangle, &distance);
+			CHECK_TRUE(hit.has_value(), "Hit from above");
+			CHECK_EQUAL(distance, 2.f, "Distance");
+			CHECK_EQUAL(hit->position, glm::vec3(0.5f, 0.f, 0.5f), "Position");
+			CHECK_EQUAL(hit->normal, glm::vec3(0.f, 1.f, 0.f), "Normal faces the ray");
+			CHECK_TRUE(Geometry::intersecting(Geometry::Ray(glm::vec3(0.5f, -2.f, 0.5f), glm::vec3(0.f, 1.f, 0.f)), triangle), "Hit from below");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Ray(glm::vec3(0.5f, -2.f, 0.5f), glm::vec3(0.f, -1.f, 0.f)), triangle), "Triangle behind the ray");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Ray(glm::vec3(1.5f, 2.f, 1.5f), glm::vec3(0.f, -1.f, 0.f)), triangle), "Miss past the hypotenuse");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Ray(glm::vec3(-1.f, 0.f, 0.5f), glm::vec3(1.f, 0.f, 0.f)), triangle), "Parallel");
+		}
+		{SCOPE_SECTION("Closest point");
+			CHECK_EQUAL(Geometry::closest_point(triangle, glm::vec3(0.5f, 3.f, 0.5f)), glm::vec3(0.5f, 0.f, 0.5f), "Face");
+			CHECK_EQUAL(Geometry::closest_point(triangle, glm::vec3(3.f, 1.f, 3.f)), glm::vec3(1.f, 0.f, 1.f), "Edge");
+			CHECK_EQUAL(Geometry::closest_point(triangle, glm::vec3(-1.f, 1.f, -1.f)), glm::vec3(0.f), "Vertex");
+		}
+		{SCOPE_SECTION("Sphere v Triangle");
+			const auto contact = Geometry::get_intersection(Geometry::Sphere(glm::vec3(0.5f, 0.5f, 0.5f), 1.f), triangle);
+			CHECK_TRUE(contact.has_value(), "Overlapping");
+			CHECK_EQUAL(contact->normal, glm::vec3(0.f, 1.f, 0.f), "Normal pushes the sphere off the triangle");
+			CHECK_EQUAL(contact->penetration_depth, 0.5f, "Depth");
+			CHECK_EQUAL(contact->position, glm::vec3(0.5f, -0.5f, 0.5f), "Position on the sphere");
+			CHECK_TRUE(Geometry::intersecting(Geometry::Sphere(glm::vec3(3.f, 0.f, 0.f), 1.f), triangle), "Touching a vertex");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::Sphere(glm::vec3(2.f, 0.f, 2.f), 1.f), triangle), "Past the hypotenuse");
+		}
+		{SCOPE_SECTION("AABB v Triangle");
+			const auto contact = Geometry::get_intersection(Geometry::AABB(glm::vec3(0.25f, -0.5f, 0.25f), glm::vec3(0.75f, 0.25f, 0.75f)), triangle);
+			CHECK_TRUE(contact.has_value(), "Overlapping");
+			CHECK_EQUAL(contact->normal, glm::vec3(0.f, -1.f, 0.f), "Normal along the least overlap");
+			CHECK_EQUAL(contact->penetration_depth, 0.25f, "Depth");
+			CHECK_EQUAL(contact->position, glm::vec3(0.5f, 0.25f, 0.5f), "Position on the AABB");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::AABB(glm::vec3(1.2f, -0.1f, 1.2f), glm::vec3(1.4f, 0.1f, 1.4f)), triangle), "Separated by an edge axis");
+			CHECK_TRUE(!Geometry::intersecting(Geometry::AABB(glm::vec3(0.25f, 0.1f, 0.25f), glm::vec3(0.75f, 0.5f, 0.75f)), triangle), "Separated by the triangle normal");
+		}
+		{SCOPE_SECTION("AABB v Sphere");
+			const auto AABB = Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f));
+			CHECK_TRUE(Geometry::intersecting(AABB, Geometry::Sphere(glm::vec3(2.f, 0.5f, 0.5f), 1.f)), "Touching a face");
+			CHECK_TRUE(!Geometry::intersecting(AABB, Geometry::Sphere(glm::vec3(2.f, 2.f, 0.5f), 1.f)), "Outside a corner");
+		}
+		{SCOPE_SECTION("Match brute force");
+			constexpr size_t triangle_count = 2000;
+			const auto points  = Utility::get_random_numbers(-50.f, 50.f, triangle_count * 3);
+			const auto offsets = Utility::get_random_numbers(-2.f, 2.f, triangle_count * 6);
+			const auto queries = Utility::get_random_numbers(-50.f, 50.f, 50 * 6);
+
+			std::vector<Geometry::Triangle> triangles;
+			for (size_t i = 0; i < triangle_count; i++)
+			{
+				const auto point = glm::vec3(points[i * 3], points[i * 3 + 1], points[i * 3 + 2]);
+				triangles.emplace_back(point, point + glm::vec3(offsets[i * 6], offsets[i * 6 + 1], offsets[i * 6 + 2]), point + glm::vec3(offsets[i * 6 + 3], offsets[i * 6 + 4], offsets[i * 6 + 5]));
+			}
+			const Geometry::TriangleBVH BVH{std::vector<Geometry::Triangle>(triangles)};
+			CHECK_EQUAL(BVH.size(), triangle_count, "Every triangle is in the BVH");
+
+			bool bound_encloses = true;
+			const auto bound = BVH.get_bound();
+			for (const auto& triangle : triangles)
+				for (const auto& point : {triangle.m_point_1, triangle.m_point_2, triangle.m_point_3})
+					bound_encloses &= glm::all(glm::lessThanEqual(bound.m_min, point)) && glm::all(glm::greaterThanEqual(bound.m_max, point));
+			CHECK_TRUE(bound_encloses, "Bound encloses every triangle");
+
+			bool ray_match    = true;
+			bool sphere_match = true;
+			bool AABB_match   = true;
+			size_t ray_hits   = 0;
+			for (size_t i = 0; i < 50; i++)
+			{
+				const auto point = glm::vec3(queries[i * 6], queries[i * 6 + 1], queries[i * 6 + 2]);
+				const auto other = glm::vec3(queries[i * 6 + 3], queries[i * 6 + 4], queries[i * 6 + 5]);
+
+				const auto ray = Geometry::Ray(point, other - point);
+				std::optional<float> closest;
+				for (const auto& triangle : triangles)
+				{
+					float distance = 0.f;
+					if (Geometry::get_intersection(ray, triangle, &distance) && (!closest || distance < *closest))
+						closest = distance;
+				}
+				const auto hit = BVH.raycast(ray);
+				ray_match &= hit.has_value() == closest.has_value() && (!hit || hit->m_distance == *closest);
+				ray_hits  += hit.has_value() ? 1 : 0;
+
+				auto count_matches = [&](const auto& p_shape)
+				{
+					size_t query_count = 0;
+					BVH.query(p_shape, [&query_count](const Geometry::Triangle&) { query_count++; });
+					const auto brute_force_count = std::count_if(triangles.begin(), triangles.end(), [&p_shape](const Geometry::Triangle& p_triangle) { return Geometry::intersecting(p_shape, p_triangle); });
+					return query_count == static_cast<size_t>(brute_force_count);
+				};
+				sphere_match &= count_matches(Geometry::Sphere(point, 5.f));
+				AABB_match   &= count_matches(Geometry::AABB(glm::min(point, other) * 0.2f, glm::max(point, other) * 0.2f));
+			}
+			CHECK_TRUE(ray_match, "Ray casts hit the closest triangle");
+			CHECK_TRUE(ray_hits > 0, "Some rays hit");
+			CHECK_TRUE(sphere_match, "Sphere queries match brute force");
+			CHECK_TRUE(AABB_match, "AABB queries match brute force");
+		}
+	}
+
+	void GeometryTester::run_heightfield_tests()
+	{SCOPE_SECTION("Heightfield")
+		{SCOPE_SECTION("Single cell");
+			const Geometry::Heightfield heightfield(1, 1, 2.f, {0.f, 2.f, 4.f, 2.f}); // (0,0) (0,1) (1,0) (1,1)
+			CHECK_EQUAL(heightfield.mip_levels(), size_t(1), "Mip levels");
+			CHECK_EQUAL(heightfield.get_bound().m_min, glm::vec3(0.f, 0.f, 0.f), "Bound min");
+			CHECK_EQUAL(heightfield.get_bound().m_max, glm::vec3(2.f, 4.f, 2.f), "Bound max");
+			CHECK_EQUAL(*heightfield.get_height(0.f, 0.f), 0.f, "Height at vertex");
+			CHECK_EQUAL(*heightfield.get_height(1.f, 0.f), 2.f, "Height along edge");
+			CHECK_EQUAL(*heightfield.get_height(1.5f, 1.5f), 2.5f, "Height in second triangle");
+			CHECK_TRUE(!heightfield.get_height(-0.1f, 1.f).has_value(), "Outside the grid");
+
+			const auto hit = heightfield.raycast(Geometry::Ray(glm::vec3(1.f, 10.f, 0.f), glm::vec3(0.f, -1.f, 0.f)));
+			CHECK_TRUE(hit.has_value(), "Vertical ray hits");
+			CHECK_EQUAL(hit->m_distance, 8.f, "Vertical ray distance");
+			CHECK_TRUE(!heightfield.raycast(Geometry::Ray(glm::vec3(1.f, 10.f, 0.f), glm::vec3(0.f, -1.f, 0.f)), 7.f).has_value(), "Max distance");
+			CHECK_TRUE(!heightfield.raycast(Geometry::Ray(glm::vec3(-1.f, 5.f, 1.f), glm::vec3(1.f, 0.f, 0.f))).has_value(), "Skimming over the top");
+			CHECK_TRUE(!heightfield.raycast(Geometry::Ray(glm::vec3(3.f, 10.f, 1.f), glm::vec3(0.f, -1.f, 0.f))).has_value(), "Outside the grid");
+		}
+		{SCOPE_SECTION("Match brute force");
+			constexpr size_t cells_x   = 37; // Odd sizes leave partial blocks at the edge of every mip level.
+			constexpr size_t cells_z   = 23;
+			constexpr float cell_size  = 0.5f;
+			auto heights               = Utility::get_random_numbers(-2.f, 2.f, (cells_x + 1) * (cells_z + 1));
+			const auto queries         = Utility::get_random_numbers(-5.f, 25.f, 200 * 6);
+			const Geometry::Heightfield heightfield(cells_x, cells_z, cell_size, std::move(heights));
+			CHECK_EQUAL(heightfield.mip_levels(), size_t(7), "Mip levels");
+
+			std::vector<Geometry::Triangle> triangles;
+			for (size_t x = 0; x < cells_x; x++)
+				for (size_t z = 0; z < cells_z; z++)
+					for (const auto& triangle : heightfield.get_cell_triangles(x, z))
+						triangles.push_back(triangle);
+
+			bool bound_encloses = true;
+			const auto bound = heightfield.get_bound();
+			for (const auto& triangle : triangles)
+				for (const auto& point : {triangle.m_point_1, triangle.m_point_2, triangle.m_point_3})
+					bound_encloses &= glm::all(glm::lessThanEqual(bound.m_min, point)) && glm::all(glm::greaterThanEqual(bound.m_max, point));
+			CHECK_TRUE(bound_encloses, "Bound encloses every triangle");
+
+			bool height_match = true;
+			bool ray_match    = true;
+			bool sphere_match = true;
+			bool AABB_match   = true;
+			size_t ray_hits   = 0;
+			for (size_t i = 0; i < 200; i++)
+			{
+				// Rays start above or beside the grid, every fourth is vertical and the rest skim across it at shallow angles.
+				const auto point     = glm::vec3(queries[i * 6], queries[i * 6 + 1] * 0.2f, queries[i * 6 + 2]);
+				const auto direction = i % 4 == 0 ? glm::vec3(0.f, -1.f, 0.f) : glm::vec3(queries[i * 6 + 3] - 10.f, -0.5f, queries[i * 6 + 4] - 10.f);
+
+				const auto ray = Geometry::Ray(point, direction);
+				std::optional<float> closest;
+				for (const auto& triangle : triangles)
+				{
+					float distance = 0.f;
+					if (Geometry::get_intersection(ray, triangle, &distance) && (!closest || distance < *closest))
+						closest = distance;
+				}
+				const auto hit = heightfield.raycast(ray);
+				ray_match &= hit.has_value() == closest.has_value() && (!hit || std::abs(hit->m_distance - *closest) < 0.0001f);
+				ray_hits  += hit.has_value() ? 1 : 0;
+
+				if (const auto height = heightfield.get_height(point.x, point.z))
+				{
+					const auto down = heightfield.raycast(Geometry::Ray(glm::vec3(point.x, bound.m_max.y + 1.f, point.z), glm::vec3(0.f, -1.f, 0.f)));
+					height_match &= down && std::abs(down->m_contact.position.y - *height) < 0.0001f;
+				}
+
+				auto count_matches = [&](const auto& p_shape)
+				{
+					size_t query_count = 0;
+					heightfield.query(p_shape, [&query_count](const Geometry::Triangle&) { query_count++; });
+					const auto brute_force_count = std::count_if(triangles.begin(), triangles.end(), [&p_shape](const Geometry::Triangle& p_triangle) { return Geometry::intersecting(p_shape, p_triangle); });
+					return query_count == static_cast<size_t>(brute_force_count);
+				};
+				sphere_match &= count_matches(Geometry::Sphere(point, 2.f));
+				AABB_match   &= count_matches(Geometry::AABB(point - glm::vec3(1.f, 0.5f, 1.5f), point + glm::vec3(1.f, 0.5f, 1.5f)));
+			}
+			CHECK_TRUE(height_match, "Height matches the surface");
+			CHECK_TRUE(ray_match, "Ray casts hit the closest triangle");
+			CHECK_TRUE(ray_hits > 0, "Some rays hit");
+			CHECK_TRUE(sphere_match, "Sphere queries match brute force");
+			CHECK_TRUE(AABB_match, "AABB queries match brute force");
+		}
+	}
+
+	void GeometryTester::run_ray_packet_tests()
+	{SCOPE_SECTION("Ray packet")
+		const auto AABB = Geometry::AABB(glm::vec3(0.f), glm::vec3(1.f));
+
+		{SCOPE_SECTION("Lanes");
+			const std::array<Geometry::Ray, 3> rays = {
+				Geometry::Ray(glm::vec3(-1.f, 0.5f, 0.5f), glm::vec3(1.f, 0.f, 0.f)),  // Parallel to y and z, enters at 1
+				Geometry::Ray(glm::vec3(0.5f, 0.5f, 0.5f), glm::vec3(0.f, 1.f, 0.f)),  // Starts inside
+				Geometry::Ray(glm::vec3(-1.f, 0.5f, 0.5f), glm::vec3(-1.f, 0.f, 0.f))}; // Pointing away
+			auto packet = Geometry::RayPacket(rays.data(), rays.size());
+			std::array<float, Geometry::RayPacket::Size> distances;
+
+			CHECK_EQUAL(Geometry::get_intersection(AABB, packet, distances), uint32_t(0b011), "Lanes hit");
+			CHECK_EQUAL(distances[0], 1.f, "Entry distance");
+			CHECK_EQUAL(distances[1], 0.f, "Starting inside enters at 0");
+			CHECK_EQUAL(packet.active_lanes(), uint32_t(0b111), "Unused lanes are inactive");
+
+			packet.set_max_distance(0, 0.5f);
+			packet.set_max_distance(1, -1.f);
+			CHECK_EQUAL(Geometry::intersecting(AABB, packet), uint32_t(0), "Max distance and retired lanes");
+			CHECK_EQUAL(packet.active_lanes(), uint32_t(0b101), "Retired lane is inactive");
+			CHECK_EQUAL(Geometry::intersecting(AABB, Geometry::RayPacket(rays.data(), 0)), uint32_t(0), "Empty packet");
+		}
+		{SCOPE_SECTION("Match scalar");
+			constexpr size_t ray_count = 400;
+			const auto values = Utility::get_random_numbers(-10.f, 10.f, ray_count * 6);
+			const auto boxes  = Utility::get_random_numbers(-5.f, 5.f, 50 * 4);
+
+			std::vector<Geometry::Ray> rays;
+			for (size_t i = 0; i < ray_count; i++)
+				rays.emplace_back(glm::vec3(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]), glm::vec3(values[i * 6 + 3], values[i * 6 + 4], values[i * 6 + 5]));
+
+			bool hits_match     = true;
+			bool distance_match = true;
+			size_t hit_count    = 0;
+			std::array<float, Geometry::RayPacket::Size> distances;
+			for (size_t box = 0; box < 50; box++)
+			{
+				const auto min         = glm::vec3(boxes[box * 4], boxes[box * 4 + 1], boxes[box * 4 + 2]);
+				const auto packet_AABB = Geometry::AABB(min, min + glm::vec3(std::abs(boxes[box * 4 + 3]) + 0.1f));
+				for (size_t first = 0; first < ray_count; first += Geometry::RayPacket::Size)
+				{
+					const auto packet        = Geometry::RayPacket(&rays[first], Geometry::RayPacket::Size);
+					const uint32_t lanes_hit = Geometry::get_intersection(packet_AABB, packet, distances);
+					for (size_t lane = 0; lane < Geometry::RayPacket::Size; lane++)
+					{
+						// The scalar test also hits boxes behind the ray at a negative distance.
+						const auto& ray = rays[first + lane];
+						float distance  = 0.f;
+						const bool hit  = Geometry::get_intersection(packet_AABB, ray, &distance) && (distance >= 0.f || Geometry::point_inside(packet_AABB, ray.m_start));
+						const bool packet_hit = lanes_hit & (1u << lane);
+
+						hits_match     &= hit == packet_hit;
+						distance_match &= !hit || !packet_hit || std::abs(distances[lane] - std::max(distance, 0.f)) < 0.0001f;
+						hit_count      += hit ? 1 : 0;
+					}
+				}
+			}
+			CHECK_TRUE(hits_match, "Hits match the scalar slab test");
+			CHECK_TRUE(distance_match, "Distances match the scalar slab test");
+			CHECK_TRUE(hit_count > 0, "Some rays hit");
+		}
+	}
+
 	void GeometryTester::draw_frustrum_debugger_UI(float aspect_ratio)
 	{
 		// Use this ImGui + OpenGL::DebugRenderer function to visualise Projection generated Geometry::Frustrums.
-		// A projection-only generated frustrum is positioned at [0, 0, 0] in the positive-z direction.
+		// A projection-only generated frustrum is positioned at [0, 0, 0] facing the negative-z direction.
 		// OpenGL clip coordinates are in the [-1 - 1] range thus the default generate ortho projection has a near = -1, far = 1.
 		if (ImGui::Begin("Frustrum visualiser"))
 		{
@@ -19,5 +19,17 @@ namespace Test
 		void run_frustrum_tests();
 		void run_sphere_tests();
 		void run_point_tests();
+		void run_intersecting_tests();
+		void run_sweep_and_prune_tests();
+		void run_spatial_hash_grid_tests();
+		void run_AABB_tree_tests();
+		void run_rigid_body_integrator_tests();
+		void run_transform_batch_tests();
+		void run_batch_intersecting_tests();
+		void run_GJK_tests();
+		void run_contact_solver_tests();
+		void run_triangle_BVH_tests();
+		void run_heightfield_tests();
+		void run_ray_packet_tests();
 	};
 } // namespace Test
\ No newline at end of file
@@ -0,0 +1,543 @@
+#include "PhysicsTester.hpp"
+
+#include "Component/Collider.hpp"
+#include "Component/CollisionMesh.hpp"
+#include "Component/RigidBody.hpp"
+#include "Component/Transform.hpp"
+#include "System/CollisionSystem.hpp"
+#include "System/PhysicsRecording.hpp"
+#include "System/PhysicsSystem.hpp"
+#include "System/SceneSystem.hpp"
+#include "Utility/ThreadPool.hpp"
+
+#include "glm/vec3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace Test
+{
+	namespace
+	{
+		const auto Tick = DeltaTime(1.f / 60.f);
+
+		// Unit cube scaled by the Transform, shared by every body of the tests.
+		const Data::CollisionMesh& get_cuboid()
+		{
+			static const Data::CollisionMesh cuboid{Geometry::AABB(glm::vec3(-0.5f), glm::vec3(0.5f)), {Geometry::Cuboid{glm::vec3(0.f)}}, Geometry::TriangleBVH{}};
+			return cuboid;
+		}
+		// A static 20x1x20 floor with its top face at y = 0.
+		ECS::EntityID add_floor(System::Scene& p_scene)
+		{
+			auto transform    = Component::Transform{glm::vec3(0.f, -0.5f, 0.f)};
+			transform.m_scale = glm::vec3(20.f, 1.f, 20.f);
+			Component::RigidBody rigid_body;
+			rigid_body.m_type = Component::RigidBody::Type::Static;
+			return p_scene.m_entities.add_entity(transform, rigid_body, Component::Collider{get_cuboid()});
+		}
+		ECS::EntityID add_box(System::Scene& p_scene, const glm::vec3& p_position, const bool& p_apply_gravity)
+		{
+			Component::RigidBody rigid_body;
+			rigid_body.m_apply_gravity = p_apply_gravity;
+			return p_scene.m_entities.add_entity(Component::Transform{p_position}, rigid_body, Component::Collider{get_cuboid()});
+		}
+
+		// Every recorded member of p_a and p_b is equal.
+		bool equal(const System::PhysicsRecording& p_a, const System::PhysicsRecording& p_b)
+		{
+			if (p_a.m_bodies.size() != p_b.m_bodies.size() || p_a.m_ticks.size() != p_b.m_ticks.size())
+				return false;
+
+			for (size_t i = 0; i < p_a.m_bodies.size(); i++)
+			{
+				const auto& a = p_a.m_bodies[i];
+				const auto& b = p_b.m_bodies[i];
+				if (a.m_entity != b.m_entity || a.m_position != b.m_position || a.m_orientation != b.m_orientation || a.m_scale != b.m_scale
+				 || a.m_momentum != b.m_momentum || a.m_velocity != b.m_velocity || a.m_angular_momentum != b.m_angular_momentum
+				 || a.m_angular_velocity != b.m_angular_velocity || a.m_inertia_tensor != b.m_inertia_tensor || a.m_mass != b.m_mass
+				 || a.m_apply_gravity != b.m_apply_gravity || a.m_type != b.m_type)
+					return false;
+			}
+			for (size_t i = 0; i < p_a.m_ticks.size(); i++)
+			{
+				const auto& a = p_a.m_ticks[i];
+				const auto& b = p_b.m_ticks[i];
+				if (a.m_delta_time != b.m_delta_time || a.m_checksum != b.m_checksum || a.m_forces.size() != b.m_forces.size())
+					return false;
+				for (size_t j = 0; j < a.m_forces.size(); j++)
+					if (a.m_forces[j].m_entity != b.m_forces[j].m_entity || a.m_forces[j].m_force != b.m_forces[j].m_force || a.m_forces[j].m_torque != b.m_forces[j].m_torque)
+						return false;
+			}
+			return true;
+		}
+		bool near(const glm::mat4& p_a, const glm::mat4& p_b)
+		{
+			for (glm::length_t column = 0; column < 4; column++)
+				for (glm::length_t row = 0; row < 4; row++)
+					if (std::abs(p_a[column][row] - p_b[column][row]) > 0.0001f)
+						return false;
+			return true;
+		}
+		std::vector<char> read_bytes(const std::filesystem::path& p_path)
+		{
+			std::ifstream file(p_path, std::ios::binary);
+			return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		}
+		void write_bytes(const std::filesystem::path& p_path, const std::vector<char>& p_bytes)
+		{
+			std::ofstream file(p_path, std::ios::binary);
+			file.write(p_bytes.data(), static_cast<std::streamsize>(p_bytes.size()));
+		}
+
+		// Keeps every event dispatched by a PhysicsSystem with the tick it was dispatched on.
+		struct ContactEventLog
+		{
+			struct Entry
+			{
+				size_t m_tick;
+				System::ContactEvent::Type m_type;
+			};
+			std::vector<Entry> m_entries;
+			size_t m_tick = 0;
+
+			void on_contact_events(const std::vector<System::ContactEvent>& p_events)
+			{
+				for (const auto& event : p_events)
+					m_entries.push_back({m_tick, event.m_type});
+			}
+			// Integrate p_physics_system one tick, logging the events under the tick.
+			void integrate(System::PhysicsSystem& p_physics_system)
+			{
+				m_tick++;
+				p_physics_system.integrate(Tick);
+			}
+			bool matches(const std::vector<Entry>& p_expected) const
+			{
+				if (p_expected.size() != m_entries.size())
+					return false;
+				for (size_t i = 0; i < p_expected.size(); i++)
+					if (p_expected[i].m_tick != m_entries[i].m_tick || p_expected[i].m_type != m_entries[i].m_type)
+						return false;
+				return true;
+			}
+		};
+	} // namespace
+
+	void PhysicsTester::run_unit_tests()
+	{
+		run_contact_event_tests();
+		run_mesh_collision_tests();
+		run_sleeping_tests();
+		run_recording_tests();
+		run_interpolation_tests();
+		run_dirty_transform_tests();
+	}
+	void PhysicsTester::run_performance_tests()
+	{}
+
+	void PhysicsTester::run_contact_event_tests()
+	{
+		using Type = System::ContactEvent::Type;
+		SCOPE_SECTION("Contact events");
+
+		{SCOPE_SECTION("Begin Persist End");
+			// The box overlaps the floor with no collision response to push it out, it touches until moved away.
+			System::Scene scene;
+			const auto floor = add_floor(scene);
+			const auto box   = add_box(scene, glm::vec3(0.f, 0.45f, 0.f), false);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			physics_system.m_apply_collision_response = false;
+			ContactEventLog log;
+			physics_system.m_contact_events.subscribe(&log, &ContactEventLog::on_contact_events);
+
+			log.integrate(physics_system);
+			CHECK_TRUE(log.matches({{1, Type::Begin}}), "Begin on the first tick touching");
+			CHECK_TRUE(physics_system.find_contact(floor, box) != nullptr, "find_contact after Begin");
+
+			log.integrate(physics_system);
+			log.integrate(physics_system);
+			CHECK_TRUE(log.matches({{1, Type::Begin}, {2, Type::Persist}, {3, Type::Persist}}), "Persist every following tick touching");
+
+			auto& transform = scene.m_entities.get_component<Component::Transform>(box);
+			transform.m_position = glm::vec3(0.f, 5.f, 0.f);
+			transform.mark_dirty();
+			log.integrate(physics_system);
+			CHECK_TRUE(log.matches({{1, Type::Begin}, {2, Type::Persist}, {3, Type::Persist}, {4, Type::End}}), "End on the tick the box separated");
+			CHECK_TRUE(physics_system.find_contact(floor, box) == nullptr, "No find_contact after End");
+
+			log.integrate(physics_system);
+			CHECK_EQUAL(log.m_entries.size(), 4, "No events while apart");
+		}
+		{SCOPE_SECTION("End on separation");
+			// The box falls onto the floor then is thrown back up off it.
+			System::Scene scene;
+			const auto floor = add_floor(scene);
+			const auto box   = add_box(scene, glm::vec3(0.f, 0.6f, 0.f), true);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			physics_system.m_allow_sleeping = false;
+			ContactEventLog log;
+			physics_system.m_contact_events.subscribe(&log, &ContactEventLog::on_contact_events);
+
+			for (size_t i = 0; i < 30 && !physics_system.find_contact(floor, box); i++)
+				log.integrate(physics_system);
+			CHECK_TRUE(physics_system.find_contact(floor, box) != nullptr, "The box landed");
+			CHECK_TRUE(!log.m_entries.empty() && log.m_entries.front().m_type == Type::Begin, "Begin on landing");
+
+			auto& rigid_body = scene.m_entities.get_component<Component::RigidBody>(box);
+			rigid_body.m_momentum = glm::vec3(0.f, 10.f * rigid_body.m_mass, 0.f);
+			for (size_t i = 0; i < 10 && physics_system.find_contact(floor, box); i++)
+				log.integrate(physics_system);
+			CHECK_TRUE(physics_system.find_contact(floor, box) == nullptr, "The box left the floor");
+			CHECK_TRUE(log.m_entries.back().m_type == Type::End, "End on leaving the floor");
+			CHECK_EQUAL(std::count_if(log.m_entries.begin(), log.m_entries.end(), [](const auto& p_entry) { return p_entry.m_type == Type::End; }), 1, "A single End");
+		}
+		{SCOPE_SECTION("End on delete");
+			// The floor is static so only the deleted box can end the pair, the pair of two resting bodies is otherwise kept.
+			System::Scene scene;
+			const auto floor = add_floor(scene);
+			const auto box   = add_box(scene, glm::vec3(0.f, 0.45f, 0.f), false);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			physics_system.m_apply_collision_response = false;
+			ContactEventLog log;
+			physics_system.m_contact_events.subscribe(&log, &ContactEventLog::on_contact_events);
+
+			log.integrate(physics_system);
+			log.integrate(physics_system);
+			scene.m_entities.delete_entity(box);
+			log.integrate(physics_system);
+			CHECK_TRUE(log.matches({{1, Type::Begin}, {2, Type::Persist}, {3, Type::End}}), "End on the tick the box was deleted");
+			CHECK_TRUE(physics_system.find_contact(floor, box) == nullptr, "No find_contact after delete");
+
+			// A box added in the deleted box's place touches the floor again, a new pair Begins.
+			const auto new_box = add_box(scene, glm::vec3(0.f, 0.45f, 0.f), false);
+			log.integrate(physics_system);
+			CHECK_TRUE(log.matches({{1, Type::Begin}, {2, Type::Persist}, {3, Type::End}, {4, Type::Begin}}), "Begin for a new box in the same place");
+			CHECK_TRUE(physics_system.find_contact(floor, new_box) != nullptr, "find_contact for the new box");
+		}
+	}
+
+	void PhysicsTester::run_mesh_collision_tests()
+	{
+		SCOPE_SECTION("Mesh collision");
+
+		// Meshes without collision shapes collide using the triangles of their triangle BVH.
+		// The floor is a single triangle covering the x + z < 0 half of its AABB, the body an open tetrahedron with its tip at y = -0.5.
+		const Data::CollisionMesh floor_mesh{Geometry::AABB(glm::vec3(-1.f, -0.01f, -1.f), glm::vec3(1.f, 0.01f, 1.f)), {},
+			Geometry::TriangleBVH({Geometry::Triangle(glm::vec3(-1.f, 0.f, -1.f), glm::vec3(1.f, 0.f, -1.f), glm::vec3(-1.f, 0.f, 1.f))})};
+		const Data::CollisionMesh tetrahedron_mesh{Geometry::AABB(glm::vec3(-0.5f), glm::vec3(0.5f)), {}, Geometry::TriangleBVH({
+			Geometry::Triangle(glm::vec3(0.f, -0.5f, 0.f), glm::vec3(0.5f, 0.5f, 0.f),   glm::vec3(-0.5f, 0.5f, 0.3f)),
+			Geometry::Triangle(glm::vec3(0.f, -0.5f, 0.f), glm::vec3(-0.5f, 0.5f, 0.3f), glm::vec3(0.f, 0.5f, -0.5f)),
+			Geometry::Triangle(glm::vec3(0.f, -0.5f, 0.f), glm::vec3(0.f, 0.5f, -0.5f),  glm::vec3(0.5f, 0.5f, 0.f))})};
+
+		auto make_scene = [&](System::Scene& p_scene, const glm::vec3& p_position, const bool& p_apply_gravity)
+		{
+			Component::RigidBody floor_body;
+			floor_body.m_type = Component::RigidBody::Type::Static;
+			const ECS::EntityID floor = p_scene.m_entities.add_entity(Component::Transform{glm::vec3(0.f)}, floor_body, Component::Collider{floor_mesh});
+
+			Component::RigidBody rigid_body;
+			rigid_body.m_apply_gravity = p_apply_gravity;
+			const ECS::EntityID body = p_scene.m_entities.add_entity(Component::Transform{p_position}, rigid_body, Component::Collider{tetrahedron_mesh});
+			return std::make_pair(floor, body);
+		};
+
+		{SCOPE_SECTION("Triangles not AABBs");
+			// The tip is 0.05 into the floor AABB in both scenes but only above the floor triangle in the first.
+			for (const auto& [position, touching] : {std::pair{glm::vec3(-0.5f, 0.45f, -0.5f), true}, std::pair{glm::vec3(0.6f, 0.45f, 0.6f), false}})
+			{
+				System::Scene scene;
+				const auto [floor, body] = make_scene(scene, position, false);
+				System::CollisionSystem collision_system{scene};
+				System::PhysicsSystem physics_system{scene, collision_system};
+				physics_system.m_apply_collision_response = false;
+				physics_system.integrate(Tick);
+
+				const auto* contact = physics_system.find_contact(floor, body);
+				const bool found    = contact != nullptr;
+				CHECK_EQUAL(found, touching, touching ? "Tip in the floor triangle touches" : "Tip in the floor AABB beside the triangle doesn't touch");
+				if (contact)
+				{
+					CHECK_TRUE(contact->m_manifold.m_count > 0 && contact->m_manifold.m_points[0].penetration_depth > 0.04f && contact->m_manifold.m_points[0].penetration_depth < 0.06f, "Penetration depth of the tip");
+					CHECK_TRUE(std::abs(std::abs(contact->m_manifold.m_points[0].normal.y) - 1.f) < 0.001f, "Contact normal is the floor normal");
+				}
+			}
+		}
+		{SCOPE_SECTION("Resting");
+			// Dropped onto the floor triangle the tetrahedron comes to rest on its tip.
+			System::Scene scene;
+			const auto [floor, body] = make_scene(scene, glm::vec3(-0.5f, 0.6f, -0.5f), true);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			physics_system.m_allow_sleeping = false;
+			for (size_t i = 0; i < 120; i++)
+				physics_system.integrate(Tick);
+
+			CHECK_TRUE(physics_system.find_contact(floor, body) != nullptr, "Resting contact");
+			const auto& position = scene.m_entities.get_component<Component::Transform>(body).m_position;
+			CHECK_TRUE(position.y > 0.45f && position.y < 0.55f, "Resting on the tip");
+		}
+	}
+
+	void PhysicsTester::run_sleeping_tests()
+	{
+		SCOPE_SECTION("Sleeping");
+
+		// A stack of two boxes is one island, the lone box another. Without gravity or collision response they stay where they are placed.
+		// Both broadphases keep the proxies of the sleeping bodies without setting them again.
+		for (const auto& broadphase : {System::Scene::Broadphase::SweepAndPrune, System::Scene::Broadphase::SpatialHashGrid})
+		{
+			System::Scene scene;
+			scene.m_broadphase = broadphase;
+			add_floor(scene);
+			const auto bottom = add_box(scene, glm::vec3(0.f, 0.45f, 0.f), false);
+			const auto top    = add_box(scene, glm::vec3(0.f, 1.4f, 0.f), false);
+			const auto lone   = add_box(scene, glm::vec3(5.f, 0.45f, 0.f), false);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			physics_system.m_apply_collision_response = false;
+
+			// Asleep and tagged so the per tick loops skip the body, or awake and untagged.
+			auto is_sleeping = [&](const ECS::EntityID& p_entity)
+			{
+				return scene.m_entities.get_component<Component::RigidBody>(p_entity).m_asleep && scene.m_entities.has_components<Component::Sleeping>(p_entity);
+			};
+			auto is_awake = [&](const ECS::EntityID& p_entity)
+			{
+				return !scene.m_entities.get_component<Component::RigidBody>(p_entity).m_asleep && !scene.m_entities.has_components<Component::Sleeping>(p_entity);
+			};
+			auto integrate = [&](const size_t& p_ticks)
+			{
+				for (size_t i = 0; i < p_ticks; i++)
+					physics_system.integrate(Tick);
+			};
+
+			{SCOPE_SECTION("Island falls asleep");
+				integrate(20);
+				CHECK_TRUE(is_awake(bottom) && is_awake(top) && is_awake(lone), "Awake before m_time_to_sleep");
+				integrate(20);
+				CHECK_TRUE(is_sleeping(bottom) && is_sleeping(top), "The stack sleeps");
+				CHECK_TRUE(is_sleeping(lone), "The lone box sleeps");
+
+				// Sleeping bodies aren't integrated, gravity doesn't move or wake them.
+				scene.m_entities.get_component<Component::RigidBody>(lone).m_apply_gravity = true;
+				integrate(1);
+				CHECK_TRUE(scene.m_entities.get_component<Component::Transform>(lone).m_position == glm::vec3(5.f, 0.45f, 0.f), "Sleeping body not integrated");
+				CHECK_TRUE(is_sleeping(lone), "Still asleep with gravity");
+				scene.m_entities.get_component<Component::RigidBody>(lone).m_apply_gravity = false;
+			}
+			{SCOPE_SECTION("Woken by force");
+				scene.m_entities.get_component<Component::RigidBody>(top).apply_linear_force(glm::vec3(1.f, 0.f, 0.f));
+				integrate(1);
+				CHECK_TRUE(is_awake(top), "The force wakes the body");
+				CHECK_TRUE(is_awake(bottom), "The rest of the island wakes with it");
+				CHECK_TRUE(is_sleeping(lone), "Other islands sleep on");
+				CHECK_TRUE(scene.m_entities.get_component<Component::Transform>(top).m_position.x > 0.f, "The woken body is moved by the force");
+
+				integrate(40);
+				CHECK_TRUE(is_sleeping(bottom) && is_sleeping(top), "The island falls back asleep");
+			}
+			{SCOPE_SECTION("Woken by contact");
+				// Slower than m_CCD_velocity so the box moves into the lone box instead of being stopped against it.
+				const auto thrown = add_box(scene, glm::vec3(6.2f, 0.45f, 0.f), false);
+				auto& rigid_body  = scene.m_entities.get_component<Component::RigidBody>(thrown);
+				rigid_body.m_momentum = glm::vec3(-2.f * rigid_body.m_mass, 0.f, 0.f);
+
+				for (size_t i = 0; i < 30 && !is_awake(lone); i++)
+					integrate(1);
+				CHECK_TRUE(is_awake(lone), "The thrown box wakes the lone box");
+				CHECK_TRUE(physics_system.find_contact(lone, thrown) != nullptr, "Woken by the contact");
+				CHECK_TRUE(is_sleeping(bottom) && is_sleeping(top), "The stack isn't touched and sleeps on");
+			}
+			{SCOPE_SECTION("Reset");
+				physics_system.reset();
+				CHECK_TRUE(is_awake(bottom) && is_awake(top) && is_awake(lone), "reset wakes and untags every body");
+			}
+		}
+	}
+
+	void PhysicsTester::run_recording_tests()
+	{
+		SCOPE_SECTION("Recording");
+
+		// Boxes dropped onto the floor, one pushed sideways part way through. Each scene is built the same way so has the same EntityIDs.
+		constexpr size_t tick_count = 60;
+		auto make_scene = [](System::Scene& p_scene)
+		{
+			add_floor(p_scene);
+			add_box(p_scene, glm::vec3(0.f, 0.6f, 0.f), true);
+			add_box(p_scene, glm::vec3(0.2f, 1.8f, 0.f), true);
+			return add_box(p_scene, glm::vec3(3.f, 1.f, 0.f), true);
+		};
+
+		System::PhysicsRecording recording;
+		{
+			System::Scene scene;
+			const auto pushed = make_scene(scene);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			physics_system.start_recording();
+			for (size_t i = 0; i < tick_count; i++)
+			{
+				if (i == 20)
+					scene.m_entities.get_component<Component::RigidBody>(pushed).apply_linear_force(glm::vec3(50.f, 0.f, 0.f));
+				physics_system.integrate(Tick);
+			}
+			recording = physics_system.stop_recording();
+		}
+		CHECK_EQUAL(recording.m_bodies.size(), 4, "Every body recorded");
+		CHECK_EQUAL(recording.m_ticks.size(), tick_count, "Every tick recorded");
+		CHECK_EQUAL(recording.m_ticks[20].m_forces.size(), 1, "The push recorded on its tick");
+
+		const auto path = std::filesystem::temp_directory_path() / "zephyr_physics_recording_test.zphy";
+		{SCOPE_SECTION("Save and load");
+			CHECK_TRUE(recording.save(path), "Saved");
+			const auto loaded = System::PhysicsRecording::load(path);
+			CHECK_TRUE(loaded.has_value(), "Loaded");
+			CHECK_TRUE(loaded && equal(*loaded, recording), "Loaded matches saved");
+		}
+		{SCOPE_SECTION("Rejected");
+			// Header: 4 byte magic then the uint32 version. The first Body follows the uint64 body count, its RigidBody::Type is its last byte.
+			const auto bytes           = read_bytes(path);
+			const auto corrupt_path    = std::filesystem::temp_directory_path() / "zephyr_physics_recording_test_corrupt.zphy";
+			constexpr size_t Body_Size = 8 + 12 * 6 + 16 + 36 + 4 + 1 + 1; // EntityID, 6 vec3s, quat, mat3, mass, apply gravity and type.
+			auto load_with = [&](const size_t& p_index, const char& p_value)
+			{
+				auto corrupt     = bytes;
+				corrupt[p_index] = p_value;
+				write_bytes(corrupt_path, corrupt);
+				return System::PhysicsRecording::load(corrupt_path);
+			};
+			CHECK_TRUE(!load_with(0, 'X'), "Bad magic");
+			CHECK_TRUE(!load_with(4, 99), "Bad version");
+			CHECK_TRUE(!load_with(16 + Body_Size - 1, 7), "Bad RigidBody type");
+			CHECK_TRUE(load_with(16 + Body_Size - 1, bytes[16 + Body_Size - 1]).has_value(), "Unchanged bytes load");
+
+			write_bytes(corrupt_path, std::vector<char>(bytes.begin(), bytes.end() - 5));
+			CHECK_TRUE(!System::PhysicsRecording::load(corrupt_path), "Truncated");
+			write_bytes(corrupt_path, std::vector<char>(bytes.begin(), bytes.begin() + 16 + Body_Size / 2));
+			CHECK_TRUE(!System::PhysicsRecording::load(corrupt_path), "Truncated in a Body");
+			CHECK_TRUE(!System::PhysicsRecording::load(std::filesystem::temp_directory_path() / "zephyr_physics_recording_test_missing.zphy"), "Missing file");
+			std::filesystem::remove(corrupt_path);
+		}
+		{SCOPE_SECTION("Replay");
+			// Replayed from the loaded recording in a new scene, every tick reproduces the recorded checksum.
+			const auto loaded = System::PhysicsRecording::load(path);
+			System::Scene scene;
+			const auto pushed = make_scene(scene);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			if (loaded)
+			{
+				const auto report = physics_system.replay(*loaded);
+				CHECK_EQUAL(report.m_checksums.size(), tick_count, "A checksum per tick");
+				CHECK_TRUE(!report.m_first_mismatch.has_value(), "No mismatch");
+				bool all_match = report.m_checksums.size() == tick_count;
+				for (size_t i = 0; all_match && i < tick_count; i++)
+					all_match = report.m_checksums[i] == recording.m_ticks[i].m_checksum;
+				CHECK_TRUE(all_match, "Checksums match the recording");
+
+				// A force not in the recording changes the simulation from its tick on.
+				auto changed = *loaded;
+				changed.m_ticks[40].m_forces.push_back({pushed, glm::vec3(0.f, 0.f, 50.f), glm::vec3(0.f)});
+				const auto changed_report = physics_system.replay(changed);
+				CHECK_TRUE(changed_report.m_first_mismatch == std::optional<size_t>(40), "Mismatch on the changed tick");
+			}
+		}
+		std::filesystem::remove(path);
+	}
+
+	void PhysicsTester::run_interpolation_tests()
+	{
+		SCOPE_SECTION("Interpolation");
+
+		{SCOPE_SECTION("Blend");
+			// Moved 2m along x and turned 90 degrees about y since the previous state.
+			Component::Transform transform{glm::vec3(0.f)};
+			transform.store_previous_state();
+			transform.m_position    = glm::vec3(2.f, 0.f, 0.f);
+			transform.m_orientation = glm::angleAxis(glm::radians(90.f), glm::vec3(0.f, 1.f, 0.f));
+			transform.mark_dirty();
+
+			auto current = transform;
+			current.update_model();
+			CHECK_TRUE(near(transform.get_interpolated_model(0.f), glm::mat4(1.f)), "Alpha 0 is the previous state");
+			CHECK_TRUE(near(transform.get_interpolated_model(1.f), current.m_model), "Alpha 1 is the current state");
+
+			const auto midpoint = transform.get_interpolated_model(0.5f);
+			CHECK_TRUE(glm::vec3(midpoint[3]) == glm::vec3(1.f, 0.f, 0.f), "Midpoint position");
+			auto expected_rotation = glm::mat4_cast(glm::angleAxis(glm::radians(45.f), glm::vec3(0.f, 1.f, 0.f)));
+			expected_rotation[3]   = midpoint[3];
+			CHECK_TRUE(near(midpoint, expected_rotation), "Midpoint rotation");
+
+			transform.m_scale = glm::vec3(2.f);
+			const auto scaled = transform.get_interpolated_model(0.5f);
+			CHECK_TRUE(std::abs(glm::length(glm::vec3(scaled[0])) - 2.f) < 0.0001f, "Scale applied to the blend");
+		}
+		{SCOPE_SECTION("Physics tick");
+			// A falling box interpolates from where it was at the start of the tick to where the tick moved it.
+			System::Scene scene;
+			const auto box = add_box(scene, glm::vec3(0.f, 5.f, 0.f), true);
+			System::CollisionSystem collision_system{scene};
+			System::PhysicsSystem physics_system{scene, collision_system};
+			physics_system.integrate(Tick);
+			physics_system.integrate(Tick);
+
+			const auto& transform = scene.m_entities.get_component<Component::Transform>(box);
+			CHECK_TRUE(transform.m_position.y < transform.m_previous_position.y, "The box fell during the tick");
+			CHECK_TRUE(glm::vec3(transform.get_interpolated_model(0.f)[3]) == transform.m_previous_position, "Alpha 0 at the start of the tick");
+			CHECK_TRUE(glm::vec3(transform.get_interpolated_model(1.f)[3]) == transform.m_position, "Alpha 1 at the end of the tick");
+			CHECK_TRUE(near(transform.get_interpolated_model(1.f), transform.m_model), "Alpha 1 matches the model built by the tick");
+		}
+	}
+
+	void PhysicsTester::run_dirty_transform_tests()
+	{
+		SCOPE_SECTION("Dirty Transforms");
+
+		// CollisionSystem::update only rebuilds the model and world AABB of Transforms marked dirty. Moving a Transform without marking it
+		// leaves the model and world AABB stale, showing it was skipped.
+		System::Scene scene;
+		const auto moved       = add_box(scene, glm::vec3(0.f), false);
+		const auto unchanged   = add_box(scene, glm::vec3(5.f, 0.f, 0.f), false);
+		const auto no_collider = scene.m_entities.add_entity(Component::Transform{glm::vec3(-5.f, 0.f, 0.f)});
+		System::CollisionSystem collision_system{scene};
+		Utility::ThreadPool thread_pool;
+		collision_system.update(thread_pool);
+
+		auto& entities = scene.m_entities;
+		CHECK_TRUE(!entities.get_component<Component::Transform>(moved).m_dirty && !entities.get_component<Component::Transform>(unchanged).m_dirty
+			&& !entities.get_component<Component::Transform>(no_collider).m_dirty, "Dirty flags cleared by the first update");
+		CHECK_TRUE(glm::vec3(entities.get_component<Component::Transform>(no_collider).m_model[3]) == glm::vec3(-5.f, 0.f, 0.f), "Transforms without a Collider get a model");
+
+		auto& moved_transform     = entities.get_component<Component::Transform>(moved);
+		auto& unchanged_transform = entities.get_component<Component::Transform>(unchanged);
+		const auto unchanged_model = unchanged_transform.m_model;
+		const auto unchanged_AABB  = entities.get_component<Component::Collider>(unchanged).m_world_AABB;
+		moved_transform.m_position     = glm::vec3(0.f, 2.f, 0.f);
+		moved_transform.mark_dirty();
+		unchanged_transform.m_position = glm::vec3(5.f, 2.f, 0.f); // Not marked dirty.
+		collision_system.update(thread_pool);
+
+		const auto& moved_AABB = entities.get_component<Component::Collider>(moved).m_world_AABB;
+		CHECK_TRUE(glm::vec3(moved_transform.m_model[3]) == glm::vec3(0.f, 2.f, 0.f), "Dirty model rebuilt");
+		CHECK_TRUE(moved_AABB.m_min == glm::vec3(-0.5f, 1.5f, -0.5f) && moved_AABB.m_max == glm::vec3(0.5f, 2.5f, 0.5f), "Dirty world AABB rebuilt");
+		CHECK_TRUE(!moved_transform.m_dirty, "Dirty flag cleared");
+
+		const auto& AABB = entities.get_component<Component::Collider>(unchanged).m_world_AABB;
+		CHECK_TRUE(unchanged_transform.m_model == unchanged_model, "Unmarked model skipped");
+		CHECK_TRUE(AABB.m_min == unchanged_AABB.m_min && AABB.m_max == unchanged_AABB.m_max, "Unmarked world AABB skipped");
+
+		unchanged_transform.mark_dirty();
+		collision_system.update(thread_pool);
+		CHECK_TRUE(glm::vec3(unchanged_transform.m_model[3]) == glm::vec3(5.f, 2.f, 0.f), "Rebuilt once marked");
+	}
+} // namespace Test
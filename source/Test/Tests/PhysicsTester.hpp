@@ -0,0 +1,24 @@
+#pragma once
+
+#include "TestManager.hpp"
+
+namespace Test
+{
+	class PhysicsTester : public TestManager
+	{
+	public:
+		PhysicsTester() : TestManager(std::string("PHYSICS")) {}
+
+	protected:
+		void run_unit_tests()        override;
+		void run_performance_tests() override;
+
+	private:
+		void run_contact_event_tests();
+		void run_mesh_collision_tests();
+		void run_sleeping_tests();
+		void run_recording_tests();
+		void run_interpolation_tests();
+		void run_dirty_transform_tests();
+	};
+} // namespace Test
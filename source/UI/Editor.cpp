@@ -181,6 +181,8 @@ namespace UI
 				if (m_scene_system.get_current_scene().has_components<Component::Transform>(selected_ent))
 				{
 					auto& transform = m_scene_system.get_current_scene().get_component<Component::Transform>(selected_ent);
+					if (transform.m_dirty) // Moved since the last physics tick.
+						transform.update_model();
 
 					ImGuizmo::Manipulate(
 						glm::value_ptr(m_openGL_renderer.m_view_information.m_view),
@@ -302,6 +304,16 @@ namespace UI
 					ImGui::Slider("Position offset units",             OpenGL::DebugRenderer::m_debug_options.m_position_offset_units, -10.f, 10.f);
 				}
 
+				{ImGui::SeparatorText("Broadphase");
+					static const std::vector<std::pair<System::Scene::Broadphase, const char*>> broadphase_options =
+						{{System::Scene::Broadphase::SweepAndPrune, "Sweep and prune"}, {System::Scene::Broadphase::SpatialHashGrid, "Spatial hash grid"}};
+					ImGui::ComboContainer("Broadphase", m_scene_system.m_scene.m_broadphase, broadphase_options);
+
+					if (m_scene_system.m_scene.m_broadphase != System::Scene::Broadphase::SpatialHashGrid) ImGui::BeginDisabled();
+					ImGui::Slider("Grid cell size", m_scene_system.m_scene.m_grid_cell_size, 0.1f, 20.f);
+					if (m_scene_system.m_scene.m_broadphase != System::Scene::Broadphase::SpatialHashGrid) ImGui::EndDisabled();
+				}
+
 				if (ImGui::Button("Reset"))
 					OpenGL::DebugRenderer::m_debug_options = OpenGL::DebugRenderer::DebugOptions();
 			}
@@ -47,9 +47,10 @@ namespace Utility
 			static_assert(Data::has_colour_member<VertexType>, "VertexType must have a colour member.");
 			current_colour = glm::vec4(colour, 1.f);
 		}
-		[[nodiscard]] Data::Mesh get_mesh()
+		//@param build_triangle_BVH Build the Data::Mesh::triangle_BVH for colliding with the triangles of the mesh.
+		[[nodiscard]] Data::Mesh get_mesh(bool build_triangle_BVH = false)
 		{
-			return Data::Mesh{data, primitive_mode, shapes};
+			return Data::Mesh{data, primitive_mode, shapes, build_triangle_BVH};
 		}
 
 	private:
@@ -0,0 +1,83 @@
+#include "ThreadPool.hpp"
+
+namespace Utility
+{
+	ThreadPool::ThreadPool(size_t p_thread_count)
+	{
+		if (p_thread_count == 0)
+			p_thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+
+		m_workers.reserve(p_thread_count - 1);
+		for (size_t i = 0; i < p_thread_count - 1; i++)
+			m_workers.emplace_back([this](std::stop_token p_stop_token) { worker_loop(p_stop_token); });
+	}
+	ThreadPool::~ThreadPool()
+	{
+		for (auto& worker : m_workers)
+			worker.request_stop(); // Wakes the workers through the stop_token passed to m_job_available.wait.
+		m_workers.clear();         // Join
+	}
+
+	void ThreadPool::run(const std::function<void(size_t)>& p_job, const size_t& p_range_count)
+	{
+		{
+			std::unique_lock lock(m_mutex);
+			m_job             = &p_job;
+			m_range_count     = p_range_count;
+			m_ranges_complete = 0;
+			m_next_range      = 0;
+			m_job_generation++;
+		}
+		m_job_available.notify_all();
+
+		execute_ranges(p_job, p_range_count);
+
+		// Wait for the ranges claimed by workers and for the workers to stop touching the job before it goes out of scope.
+		std::unique_lock lock(m_mutex);
+		m_job_complete.wait(lock, [this]() { return m_ranges_complete == m_range_count && m_active_workers == 0; });
+		m_job = nullptr;
+	}
+
+	void ThreadPool::execute_ranges(const std::function<void(size_t)>& p_job, const size_t& p_range_count)
+	{
+		size_t completed = 0;
+		for (size_t range = m_next_range++; range < p_range_count; range = m_next_range++)
+		{
+			p_job(range);
+			completed++;
+		}
+
+		std::unique_lock lock(m_mutex);
+		m_ranges_complete += completed;
+	}
+
+	void ThreadPool::worker_loop(std::stop_token p_stop_token)
+	{
+		uint64_t last_generation = 0;
+
+		while (true)
+		{
+			const std::function<void(size_t)>* job = nullptr;
+			size_t range_count                     = 0;
+			{
+				std::unique_lock lock(m_mutex);
+				// A worker waking after the job completed sees m_job == nullptr and keeps waiting for the next one.
+				if (!m_job_available.wait(lock, p_stop_token, [&]() { return m_job != nullptr && m_job_generation != last_generation; }))
+					return; // Stop requested
+
+				last_generation = m_job_generation;
+				job             = m_job;
+				range_count     = m_range_count;
+				m_active_workers++;
+			}
+
+			execute_ranges(*job, range_count);
+
+			{
+				std::unique_lock lock(m_mutex);
+				m_active_workers--;
+			}
+			m_job_complete.notify_all();
+		}
+	}
+} // namespace Utility
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace Utility
+{
+	// A fixed set of worker threads that execute parallel_for jobs, the calling thread also participates in each job.
+	// Workers sleep between jobs so the pool can be kept for the lifetime of a system and reused every tick without spawning threads.
+	class ThreadPool
+	{
+	public:
+		//@param p_thread_count Total threads used by a job including the calling thread. 0 uses std::thread::hardware_concurrency.
+		ThreadPool(size_t p_thread_count = 0);
+		~ThreadPool();
+		ThreadPool(const ThreadPool&)            = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		// Split [0, p_count) into contiguous ranges and call p_function(begin, end) for each range across the pool. Blocks until all ranges complete.
+		// Ranges are not run in any particular order. For deterministic results write outputs per index rather than appending to shared containers.
+		//@param p_min_range_size Fewest indices per range, small jobs run on fewer threads or directly on the calling thread.
+		template <typename Func>
+		void parallel_for(const size_t& p_count, const Func& p_function, const size_t& p_min_range_size = 64)
+		{
+			if (p_count == 0)
+				return;
+
+			const size_t range_count = std::min(get_thread_count(), (p_count + p_min_range_size - 1) / p_min_range_size);
+			if (range_count <= 1)
+			{
+				p_function(size_t(0), p_count);
+				return;
+			}
+
+			const std::function<void(size_t)> job = [&](const size_t& p_range)
+			{
+				p_function(p_count * p_range / range_count, p_count * (p_range + 1) / range_count);
+			};
+			run(job, range_count);
+		}
+
+		[[nodiscard]] size_t get_thread_count() const { return m_workers.size() + 1; }
+
+	private:
+		void run(const std::function<void(size_t)>& p_job, const size_t& p_range_count);
+		// Claim and execute ranges of the current job until none remain.
+		void execute_ranges(const std::function<void(size_t)>& p_job, const size_t& p_range_count);
+		void worker_loop(std::stop_token p_stop_token);
+
+		std::vector<std::jthread> m_workers;
+
+		std::mutex m_mutex; // Guards all the members below except m_next_range.
+		std::condition_variable_any m_job_available;
+		std::condition_variable m_job_complete;
+		const std::function<void(size_t)>* m_job = nullptr; // The current job or nullptr between jobs.
+		size_t m_range_count        = 0;
+		size_t m_ranges_complete    = 0;
+		size_t m_active_workers     = 0; // Workers currently executing ranges of m_job.
+		uint64_t m_job_generation   = 0; // Incremented per job so a worker joins each job at most once.
+		std::atomic<size_t> m_next_range = 0;
+	};
+} // namespace Utility